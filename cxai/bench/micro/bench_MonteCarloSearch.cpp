@@ -0,0 +1,87 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    bench_MonteCarloSearch.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Micro-benchmarks for the MonteCarloSearch class.
+ *
+ * Each iteration is a search with a fixed playout budget from the empty board, so that the
+ * playouts per second of every thread count can be compared. Benchmarks are named after their
+ * arguments, for example <tt>MonteCarloSearch_search/players:2/threads:4/real_time</tt>.
+ * Thread counts above the number of hardware threads only measure the cost of sharing the
+ * tree.
+ *
+ **************************************************************************************************/
+
+#include <chrono>
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <cxbase/include/DefaultPlayers.h>
+
+#include <include/MonteCarloSearch.h>
+
+
+namespace
+{
+
+const std::uint64_t NB_PLAYOUTS{20000};  // The playout budget of each search.
+
+/***********************************************************************************************//**
+ * Playouts per second, from the empty board: the classic 6 by 7, connect four Game for two (2)
+ * players, and a 7 by 8, connect four Game for four (4) players.
+ *
+ **************************************************************************************************/
+void MonteCarloSearch_search(benchmark::State& p_state)
+{
+    const int nbPlayers{static_cast<int>(p_state.range(0))};
+    const int nbThreads{static_cast<int>(p_state.range(1))};
+
+    const bool isClassic{nbPlayers == 2};
+
+    const cxbase::Game game{cxbase::defaultPlayers(nbPlayers),
+                            std::make_shared<cxbase::GameBoard>(isClassic ? 6 : 7, isClassic ? 7 : 8),
+                            4};
+
+    cxai::MonteCarloSearch search{nbThreads};
+
+    std::uint64_t nbPlayouts{0};
+
+    for(auto _ : p_state)
+    {
+        const cxai::MonteCarloSearch::Result result{search.search(game, std::chrono::minutes{1}, NB_PLAYOUTS)};
+
+        nbPlayouts += result.m_nbPlayouts;
+    }
+
+    p_state.counters["playouts/s"] = benchmark::Counter(static_cast<double>(nbPlayouts), benchmark::Counter::kIsRate);
+}
+BENCHMARK(MonteCarloSearch_search)->ArgNames({"players", "threads"})
+                                  ->ArgsProduct({{2, 4}, {1, 2, 4, 8}})
+                                  ->UseRealTime()
+                                  ->Unit(benchmark::kMillisecond);
+
+} // unamed namespace
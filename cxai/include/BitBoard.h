@@ -0,0 +1,469 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    BitBoard.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a compact two players board representation.
+ *
+ **************************************************************************************************/
+
+#ifndef BITBOARD_H_3F8C1D62_9A4E_4B07_8E15_C27D6A90B4E3
+#define BITBOARD_H_3F8C1D62_9A4E_4B07_8E15_C27D6A90B4E3
+
+#include <cstdint>
+#include <string>
+
+#include <cxutil/include/ContractException.h>
+
+#include <cxbase/include/Game.h>
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class BitBoard
+ *
+ * @brief A two players Connect X position, packed in two 64 bits words.
+ *
+ * Each Column uses @c nbRows() + 1 consecutive bits, the bottom Row being the least
+ * significant one. The extra bit on top of each Column is a sentinel which is never set: it
+ * keeps alignments from wrapping from one Column to the next. This is why a BitBoard can only
+ * represent GameBoards for which <tt>(nbRows() + 1) * nbColumns()</tt> is at most 64.
+ *
+ * Two words are stored: the Discs of the Player whose turn it is and the Discs of both Players.
+ * Playing a move is then only a few arithmetic operations, and so are win checks, which makes
+ * the BitBoard well suited for search algorithms. Moves are exchanged as single bit masks to
+ * avoid any conversion in the inner loops.
+ *
+ * Unlike a cxbase::Game, a BitBoard does not check if the Game is over when a move is played.
+ * Callers are expected to check for winning moves (see @c isWinningMove()) before playing them.
+ *
+ * @invariant <tt>(nbRows() + 1) * nbColumns()</tt> is at most 64.
+ * @invariant The @a inARow value is at least two (2).
+ *
+ **************************************************************************************************/
+class BitBoard
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor. Creates an empty BitBoard.
+     *
+     * @param[in] p_nbRows     The number of Rows.
+     * @param[in] p_nbColumns  The number of Columns.
+     * @param[in] p_inARow     The @a inARow value.
+     *
+     * @pre The number of Rows and Columns are positive.
+     * @pre <tt>(p_nbRows + 1) * p_nbColumns</tt> is at most 64.
+     * @pre @c p_inARow is at least two (2).
+     *
+     **********************************************************************************************/
+    BitBoard(int p_nbRows, int p_nbColumns, int p_inARow);
+
+
+    /*******************************************************************************************//**
+     * Creates a BitBoard from a cxbase::Game.
+     *
+     * @param[in] p_game The Game.
+     *
+     * @pre The Game has exactly two (2) Players.
+     * @pre The Game's GameBoard fits in a BitBoard.
+     *
+     * @return A BitBoard holding the same position, the active Player being the one to move.
+     *
+     **********************************************************************************************/
+    static BitBoard fromGame(const cxbase::Game& p_game);
+
+
+    /*******************************************************************************************//**
+     * Creates a BitBoard from a position key.
+     *
+     * @param[in] p_nbRows     The number of Rows.
+     * @param[in] p_nbColumns  The number of Columns.
+     * @param[in] p_inARow     The @a inARow value.
+     * @param[in] p_key        A key, as given by @c key() for a board of the same size.
+     *
+     * @pre The board size is valid (see the constructor).
+     * @pre The key is valid for this board size.
+     *
+     * @return The BitBoard whose @c key() is @c p_key.
+     *
+     **********************************************************************************************/
+    static BitBoard fromKey(int p_nbRows, int p_nbColumns, int p_inARow, std::uint64_t p_key);
+
+///@}
+
+///@{ @name Data access
+
+    int nbRows()    const {return m_nbRows;}    ///< Number of Rows accessor.
+    int nbColumns() const {return m_nbColumns;} ///< Number of Columns accessor.
+    int inARow()    const {return m_inARow;}    ///< @a inARow value accessor.
+    int nbMoves()   const {return m_nbMoves;}   ///< Number of moves played so far.
+
+
+    /*******************************************************************************************//**
+     * Number of Positions accessor.
+     *
+     * @return The number of Positions on the board.
+     *
+     **********************************************************************************************/
+    int nbPositions() const {return m_nbRows * m_nbColumns;}
+
+
+    /*******************************************************************************************//**
+     * Position key.
+     *
+     * The key is unique for every position of a given board size: it can be used as is in a
+     * transposition table.
+     *
+     * @return The key.
+     *
+     **********************************************************************************************/
+    std::uint64_t key() const {return m_current + m_mask;}
+
+
+    /*******************************************************************************************//**
+     * Symmetric position key.
+     *
+     * A position and its mirror image (left and right swapped) have the same value. This key
+     * is the same for both of them: it is the smallest of their keys.
+     *
+     * @return The key.
+     *
+     **********************************************************************************************/
+    std::uint64_t symmetricKey() const
+    {
+        // Each Column of the key only depends on the Discs of that Column, so mirroring the key
+        // is the same as mirroring the position:
+        const int           columnShift{m_nbRows + 1};
+        const std::uint64_t columnBits {(std::uint64_t{1} << columnShift) - 1};
+        const std::uint64_t direct     {key()};
+
+        std::uint64_t mirrored{0};
+
+        for(int column{0}, mirror{m_nbColumns - 1}; column < m_nbColumns; ++column, --mirror)
+        {
+            mirrored |= ((direct >> (column * columnShift)) & columnBits) << (mirror * columnShift);
+        }
+
+        return direct < mirrored ? direct : mirrored;
+    }
+
+
+    /*******************************************************************************************//**
+     * Mask of a Column.
+     *
+     * @param[in] p_column The Column subscript.
+     *
+     * @return A mask holding every Position of the Column.
+     *
+     **********************************************************************************************/
+    std::uint64_t columnMask(int p_column) const
+    {
+        return ((std::uint64_t{1} << m_nbRows) - 1) << (p_column * (m_nbRows + 1));
+    }
+
+///@}
+
+///@{ @name Moves
+
+    /*******************************************************************************************//**
+     * Checks if a Column can be played.
+     *
+     * @param[in] p_column The Column subscript.
+     *
+     * @pre The Column subscript is between 0 and @c nbColumns() - 1.
+     *
+     * @return @c true if the Column is not full, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool canPlay(int p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Plays in a Column, for the Player whose turn it is.
+     *
+     * @param[in] p_column The Column subscript.
+     *
+     * @pre The Column can be played.
+     *
+     **********************************************************************************************/
+    void play(int p_column);
+
+
+    /*******************************************************************************************//**
+     * Plays a sequence of Columns.
+     *
+     * Columns are given as characters, from '1' for the leftmost Column. This is the notation
+     * used by most Connect 4 position databases.
+     *
+     * @param[in] p_sequence The sequence of Columns.
+     *
+     * @return The number of moves played. Playing stops at the first invalid character, full
+     *         Column or winning move.
+     *
+     **********************************************************************************************/
+    int play(const std::string& p_sequence);
+
+
+    /*******************************************************************************************//**
+     * Plays a move, for the Player whose turn it is.
+     *
+     * @param[in] p_move The move, as a single bit mask taken from @c possible().
+     *
+     **********************************************************************************************/
+    void playMove(std::uint64_t p_move)
+    {
+        m_current ^= m_mask;
+        m_mask    |= p_move;
+        ++m_nbMoves;
+    }
+
+
+    /*******************************************************************************************//**
+     * Possible moves.
+     *
+     * @return A mask holding the next free Position of every Column which is not full.
+     *
+     **********************************************************************************************/
+    std::uint64_t possible() const {return (m_mask + m_bottomMask) & m_boardMask;}
+
+
+    /*******************************************************************************************//**
+     * Checks if playing in a Column wins the Game for the Player whose turn it is.
+     *
+     * @param[in] p_column The Column subscript.
+     *
+     * @pre The Column can be played.
+     *
+     * @return @c true if the move wins, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool isWinningMove(int p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Checks if the Player whose turn it is can win on this move.
+     *
+     * @return @c true if at least one winning move exists, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool canWinNext() const {return (winningPositions() & possible()) != 0;}
+
+
+    /*******************************************************************************************//**
+     * Moves which do not lose immediately.
+     *
+     * A move loses immediately if the opponent can win right after it, either because it does
+     * not block an opponent winning Position, or because it gives access to the Position right
+     * over it.
+     *
+     * @pre The Player whose turn it is cannot win on this move.
+     *
+     * @return A mask of the possible moves which do not give the opponent an immediate win.
+     *         Zero (0) is returned if every move loses.
+     *
+     **********************************************************************************************/
+    std::uint64_t possibleNonLosingMoves() const
+    {
+        std::uint64_t       possibleMask{possible()};
+        const std::uint64_t opponentWin {opponentWinningPositions()};
+        const std::uint64_t forcedMoves {possibleMask & opponentWin};
+
+        if(forcedMoves)
+        {
+            if(forcedMoves & (forcedMoves - 1))
+            {
+                // More than one forced move: the opponent wins anyway.
+                return 0;
+            }
+
+            possibleMask = forcedMoves;
+        }
+
+        // Never play right under an opponent winning Position:
+        return possibleMask & ~(opponentWin >> 1);
+    }
+
+
+    /*******************************************************************************************//**
+     * Scores a move for move ordering.
+     *
+     * @param[in] p_move The move, as a single bit mask taken from @c possible().
+     *
+     * @return The number of winning Positions the Player whose turn it is has after the move.
+     *
+     **********************************************************************************************/
+    int moveScore(std::uint64_t p_move) const
+    {
+        return popcount(computeWinningPositions(m_current | p_move, m_mask));
+    }
+
+///@}
+
+
+private:
+
+    static const int MAX_IN_A_ROW{64}; ///< Bigger alignments can't fit in a BitBoard.
+
+    std::uint64_t winningPositions()         const {return computeWinningPositions(m_current, m_mask);}
+    std::uint64_t opponentWinningPositions() const {return computeWinningPositions(m_current ^ m_mask, m_mask);}
+
+    std::uint64_t computeWinningPositions(std::uint64_t p_discs, std::uint64_t p_mask) const;
+    std::uint64_t alignments(std::uint64_t p_discs, int p_shift) const;
+    static std::uint64_t alignmentsOfFour(std::uint64_t p_discs, int p_shift);
+
+    static int popcount(std::uint64_t p_mask) {return __builtin_popcountll(p_mask);}
+
+    void checkInvariant() const;
+
+    int           m_nbRows;        ///< The number of Rows.
+    int           m_nbColumns;     ///< The number of Columns.
+    int           m_inARow;        ///< The @a inARow value.
+    int           m_nbMoves;       ///< The number of moves played.
+    std::uint64_t m_current;       ///< The Discs of the Player whose turn it is.
+    std::uint64_t m_mask;          ///< The Discs of both Players.
+    std::uint64_t m_bottomMask;    ///< The bottom Position of every Column.
+    std::uint64_t m_boardMask;     ///< Every Position of the board.
+    bool          m_isConnectFour; ///< Connect four, with alignments short enough to be unrolled.
+
+};
+
+
+/***********************************************************************************************//**
+ * Computes the winning Positions for a set of Discs, i.e. the free Positions which would
+ * complete an alignment of @a inARow Discs if played.
+ *
+ * @param[in] p_discs The Discs of one Player.
+ * @param[in] p_mask  The Discs of both Players.
+ *
+ * @return The winning Positions. Some of them might not be directly playable.
+ *
+ **************************************************************************************************/
+inline std::uint64_t BitBoard::computeWinningPositions(std::uint64_t p_discs, std::uint64_t p_mask) const
+{
+    const int columnShift{m_nbRows + 1};
+
+    std::uint64_t winning;
+
+    if(m_isConnectFour)
+    {
+        winning = alignmentsOfFour(p_discs, 1)               |   // Vertical
+                  alignmentsOfFour(p_discs, columnShift)     |   // Horizontal
+                  alignmentsOfFour(p_discs, columnShift - 1) |   // Diagonal downward
+                  alignmentsOfFour(p_discs, columnShift + 1);    // Diagonal upward
+    }
+    else
+    {
+        winning = alignments(p_discs, 1)               |
+                  alignments(p_discs, columnShift)     |
+                  alignments(p_discs, columnShift - 1) |
+                  alignments(p_discs, columnShift + 1);
+    }
+
+    return winning & (m_boardMask ^ p_mask);
+}
+
+
+/***********************************************************************************************//**
+ * Same as @c alignments(), unrolled for an @a inARow value of four (4). This is by far the
+ * most common case, and the one search speed matters the most for.
+ *
+ * @param[in] p_discs The Discs of one Player.
+ * @param[in] p_shift The distance between two consecutive bits in the direction.
+ *
+ * @pre Three (3) times the distance is less than 64, so that no shift is undefined. The
+ *      constructor only enables this path for boards short enough for the diagonals.
+ *
+ * @return The completing bits. Occupied bits are not filtered out.
+ *
+ **************************************************************************************************/
+inline std::uint64_t BitBoard::alignmentsOfFour(std::uint64_t p_discs, int p_shift)
+{
+    PRECONDITION(p_shift > 0 && 3 * p_shift < 64);
+
+    const std::uint64_t twoBefore{(p_discs << p_shift) & (p_discs << 2 * p_shift)};
+    const std::uint64_t twoAfter {(p_discs >> p_shift) & (p_discs >> 2 * p_shift)};
+
+    return (twoBefore & (p_discs << 3 * p_shift)) |
+           (twoBefore & (p_discs >> p_shift))     |
+           (twoAfter  & (p_discs << p_shift))     |
+           (twoAfter  & (p_discs >> 3 * p_shift));
+}
+
+
+/***********************************************************************************************//**
+ * Finds every bit which would complete an alignment of @a inARow Discs in one direction.
+ *
+ * A bit completes an alignment if it has @a a Discs right before it and @a b Discs right after
+ * it, with <tt>a + b = inARow - 1</tt>. Bits on the sentinel Row are never set, so alignments
+ * can't wrap from one Column to the next.
+ *
+ * @param[in] p_discs The Discs of one Player.
+ * @param[in] p_shift The distance between two consecutive bits in the direction.
+ *
+ * @return The completing bits. Occupied bits are not filtered out.
+ *
+ **************************************************************************************************/
+inline std::uint64_t BitBoard::alignments(std::uint64_t p_discs, int p_shift) const
+{
+    // The bound is guaranteed by the constructor, it only spares the compiler from proving it:
+    const int needed{(m_inARow < MAX_IN_A_ROW ? m_inARow : MAX_IN_A_ROW) - 1};
+
+    // before[k] (resp. after[k]) has a bit set when the k bits before (resp. after) it are Discs:
+    std::uint64_t before[MAX_IN_A_ROW];
+    std::uint64_t after [MAX_IN_A_ROW];
+
+    before[0] = ~std::uint64_t{0};
+    after [0] = ~std::uint64_t{0};
+
+    for(int k{1}; k <= needed; ++k)
+    {
+        const int distance{k * p_shift};
+
+        before[k] = distance < 64 ? before[k - 1] & (p_discs << distance) : 0;
+        after [k] = distance < 64 ? after [k - 1] & (p_discs >> distance) : 0;
+    }
+
+    std::uint64_t completing{0};
+
+    for(int k{0}; k <= needed; ++k)
+    {
+        completing |= before[k] & after[needed - k];
+    }
+
+    return completing;
+}
+
+} // namespace cxai
+
+#endif /* BITBOARD_H_3F8C1D62_9A4E_4B07_8E15_C27D6A90B4E3 */
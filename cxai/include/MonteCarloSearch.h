@@ -0,0 +1,216 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    MonteCarloSearch.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a parallel Monte Carlo tree search engine.
+ *
+ **************************************************************************************************/
+
+#ifndef MONTECARLOSEARCH_H_5B8E2D17_C3A4_4F96_A0E1_7D4C92B6F358
+#define MONTECARLOSEARCH_H_5B8E2D17_C3A4_4F96_A0E1_7D4C92B6F358
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <cxbase/include/Game.h>
+
+#include "MultiPlayerBoard.h"
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class MonteCarloSearch
+ *
+ * @brief Chooses a move for the active Player by Monte Carlo tree search (UCT).
+ *
+ * Random Games (playouts) are played from the current position, and a tree of the most
+ * promising moves is grown from their results. Each tree node holds the number of playouts
+ * that went through it and the total reward they brought to the Player who moved into it: one
+ * (1) for a win, one over the number of Players for a draw and nothing for a loss. This works
+ * for any number of Players and any board size, since no evaluation function is needed.
+ *
+ * The search runs on several threads sharing a single tree (tree parallelism):
+ *
+ *  @li Node statistics are atomic counters: no lock is ever taken.
+ *  @li A thread going down a node adds a <em> virtual loss </em> to it, removed when its
+ *      playout result is backed up. This steers the other threads towards other moves.
+ *  @li Nodes are taken from a pool allocated once, and all the children of a node are created
+ *      at once by the single thread that wins the right to expand it.
+ *  @li Each thread plays its playouts on its own MultiPlayerBoard.
+ *
+ * A search stops when its time budget or its playout budget is spent, whichever comes first.
+ * The most visited move is then chosen. With a single thread and a playout budget, a search is
+ * reproducible for a given seed.
+ *
+ **************************************************************************************************/
+class MonteCarloSearch
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The result of a search.
+     *
+     **********************************************************************************************/
+    struct Result
+    {
+        int                       m_column;     ///< The chosen Column.
+        double                    m_value;      ///< The average reward of the chosen move.
+        std::uint64_t             m_nbPlayouts; ///< The number of playouts.
+        std::size_t               m_nbNodes;    ///< The number of tree nodes created.
+        std::chrono::microseconds m_elapsed;    ///< The search duration.
+
+
+        /***************************************************************************************//**
+         * Search speed.
+         *
+         * @return The number of playouts per second.
+         *
+         ******************************************************************************************/
+        double playoutsPerSecond() const
+        {
+            const double seconds{static_cast<double>(m_elapsed.count()) / 1e6};
+
+            return seconds > 0.0 ? static_cast<double>(m_nbPlayouts) / seconds : 0.0;
+        }
+    };
+
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor.
+     *
+     * @param[in] p_nbThreads The number of search threads.
+     * @param[in] p_maxNbNodes The maximum number of tree nodes. Each node uses thirty-two (32)
+     *                         bytes. When the pool is exhausted, the tree stops growing but
+     *                         playouts go on.
+     * @param[in] p_seed      The seed of the random playouts.
+     *
+     * @pre The number of threads is positive.
+     * @pre The pool can hold the root node and its children (65 nodes).
+     *
+     **********************************************************************************************/
+    MonteCarloSearch(int           p_nbThreads  = defaultNbThreads(),
+                     std::size_t   p_maxNbNodes = defaultMaxNbNodes(),
+                     std::uint64_t p_seed       = 0);
+
+///@}
+
+///@{ @name Searching
+
+    /*******************************************************************************************//**
+     * Searches for the best move of the active Player.
+     *
+     * @param[in] p_game        The Game.
+     * @param[in] p_timeBudget  The time budget.
+     * @param[in] p_maxPlayouts The playout budget.
+     *
+     * @pre The Game is not over.
+     * @pre The Game has at most @c MultiPlayerBoard::maxNbPlayers() Players.
+     * @pre The playout budget is positive.
+     *
+     * @return The chosen Column, along with search statistics.
+     *
+     **********************************************************************************************/
+    Result search(const cxbase::Game&       p_game,
+                  std::chrono::milliseconds p_timeBudget,
+                  std::uint64_t             p_maxPlayouts = std::numeric_limits<std::uint64_t>::max());
+
+///@}
+
+///@{ @name Data access
+
+    int nbThreads() const {return m_nbThreads;}             ///< Number of search threads accessor.
+
+
+    /*******************************************************************************************//**
+     * Default number of search threads.
+     *
+     * @return The number of hardware threads, or one (1) if it is unknown.
+     *
+     **********************************************************************************************/
+    static int defaultNbThreads();
+
+
+    /*******************************************************************************************//**
+     * Default maximum number of tree nodes.
+     *
+     * @return A number of nodes using 64 MiB.
+     *
+     **********************************************************************************************/
+    static std::size_t defaultMaxNbNodes() {return std::size_t{1} << 21;}
+
+///@}
+
+
+private:
+
+    struct Node
+    {
+        std::atomic<std::uint64_t> m_rewards;       ///< Sum of rewards, in 1 / nbPlayers units.
+        std::atomic<std::uint32_t> m_visits;        ///< Number of playouts backed up.
+        std::atomic<std::uint32_t> m_virtualLosses; ///< Number of playouts under way.
+        std::atomic<std::int32_t>  m_firstChild;    ///< Index of the first child, see the implementation.
+        std::int32_t               m_nbChildren;    ///< Number of children, set before the first child index.
+        std::int8_t                m_column;        ///< The move leading to this node.
+        std::int8_t                m_player;        ///< The Player who made it.
+    };
+
+    void         work(const MultiPlayerBoard& p_board, std::uint64_t p_seed);
+    void         playout(MultiPlayerBoard& p_board, std::mt19937_64& p_random, std::vector<int>& p_columns, std::vector<std::int32_t>& p_path);
+    bool         expand(std::int32_t p_node, const MultiPlayerBoard& p_board);
+    std::int32_t select(std::int32_t p_node) const;
+    bool         isBudgetSpent();
+
+    int                                         m_nbThreads;        ///< The number of search threads.
+    std::size_t                                 m_maxNbNodes;       ///< The size of the node pool.
+    std::uint64_t                               m_seed;             ///< The seed of the random playouts.
+    int                                         m_nbPlayers;        ///< The number of Players of the searched Game.
+    std::unique_ptr<Node[]>                     m_nodes;            ///< The node pool. The root is the first node.
+    std::atomic<std::size_t>                    m_nbNodes;          ///< The number of nodes in use.
+    std::atomic<std::uint64_t>                  m_nbPlayouts;       ///< The number of playouts started.
+    std::uint64_t                               m_maxPlayouts;      ///< The playout budget.
+    std::chrono::steady_clock::time_point       m_deadline;         ///< When the search must stop.
+    std::atomic<bool>                           m_isBudgetSpent;    ///< The search must stop.
+    std::vector<int>                            m_centreOrder;      ///< Columns, from the centre outwards.
+
+};
+
+} // namespace cxai
+
+#endif /* MONTECARLOSEARCH_H_5B8E2D17_C3A4_4F96_A0E1_7D4C92B6F358 */
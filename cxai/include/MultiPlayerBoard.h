@@ -0,0 +1,252 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    MultiPlayerBoard.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a search board supporting any number of Players.
+ *
+ **************************************************************************************************/
+
+#ifndef MULTIPLAYERBOARD_H_2C7E9A41_B35D_4F80_9D16_E48A0C5B73F2
+#define MULTIPLAYERBOARD_H_2C7E9A41_B35D_4F80_9D16_E48A0C5B73F2
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <cxutil/include/ContractException.h>
+
+#include <cxbase/include/Game.h>
+#include <cxbase/include/LiveWindows.h>
+#include <cxbase/include/WinningLines.h>
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class MultiPlayerBoard
+ *
+ * @brief A Connect X position for search algorithms, with any number of Players.
+ *
+ * A MultiPlayerBoard is created from a cxbase::Game and then explored with @c play() and
+ * @c undo(). Unlike a Game, it lets any Player move at any time: this is needed by search
+ * algorithms which, like best-reply search, do not follow the turn order.
+ *
+ * The winning windows are followed with a cxbase::LiveWindows, the accounting a cxbase::Game
+ * uses for its own scores, as moves are made and unmade. This gives, for the windows containing
+ * the played Position only:
+ *
+ *  @li Win detection: a Player wins when one of its windows is full.
+ *  @li A heuristic score per Player, which sums a weight for every window holding only Discs
+ *      of this Player. The weights are the Game's (see cxbase::Game::evaluationWeights()), so
+ *      that a MultiPlayerBoard scores a position as its Game does, and engines follow the
+ *      weights registered for the shape. Unlike the Game, which follows vertical windows
+ *      through the top of each Column, all windows are counted the same way.
+ *
+ * The hash is the same as the one of a cxbase::Game holding the same position.
+ *
+ * @invariant The number of Players is between two (2) and @c maxNbPlayers().
+ *
+ **************************************************************************************************/
+class MultiPlayerBoard
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor. Copies the position of a Game.
+     *
+     * @param[in] p_game The Game.
+     *
+     * @pre The Game has at most @c maxNbPlayers() Players.
+     *
+     **********************************************************************************************/
+    explicit MultiPlayerBoard(const cxbase::Game& p_game);
+
+///@}
+
+///@{ @name Data access
+
+    int nbRows()       const {return m_lines->nbRows();}    ///< Number of Rows accessor.
+    int nbColumns()    const {return m_lines->nbColumns();} ///< Number of Columns accessor.
+    int inARow()       const {return m_lines->inARow();}    ///< @a inARow value accessor.
+    int nbPlayers()    const {return m_nbPlayers;}          ///< Number of Players accessor.
+    int activePlayer() const {return m_activePlayer;}       ///< Index of the Player to move.
+    int nbDiscs()      const {return m_nbDiscs;}            ///< Number of Discs on the board.
+
+
+    /*******************************************************************************************//**
+     * Checks if a Player has won.
+     *
+     * @return @c true if a Player has completed a window, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool isWon() const {return m_winner >= 0;}
+
+
+    /*******************************************************************************************//**
+     * Winner accessor.
+     *
+     * @pre A Player has won.
+     *
+     * @return The index of the first Player who completed a window.
+     *
+     **********************************************************************************************/
+    int winner() const;
+
+
+    /*******************************************************************************************//**
+     * Checks if every Position is occupied.
+     *
+     * @return @c true if the board is full, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool isFull() const {return m_nbDiscs == nbRows() * nbColumns();}
+
+
+    /*******************************************************************************************//**
+     * Checks if a Column can be played.
+     *
+     * @param[in] p_column The Column subscript.
+     *
+     * @pre The Column subscript is between 0 and @c nbColumns() - 1.
+     *
+     * @return @c true if the Column is not full, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool canPlay(int p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Position hash accessor.
+     *
+     * @return The hash, equal to @c cxbase::Game::hash() for the same position and active
+     *         Player.
+     *
+     **********************************************************************************************/
+    std::uint64_t hash() const {return m_hash;}
+
+
+    /*******************************************************************************************//**
+     * Heuristic score of a Player.
+     *
+     * @param[in] p_player The index of the Player.
+     *
+     * @pre The index is between 0 and @c nbPlayers() - 1.
+     *
+     * @return The sum of the weights of the windows holding only Discs of the Player, as
+     *         @c cxbase::Game::score() gives it. This is always positive or zero (0).
+     *
+     **********************************************************************************************/
+    std::int64_t score(int p_player) const;
+
+
+    /*******************************************************************************************//**
+     * Maximum number of Players.
+     *
+     * @return The maximum number of Players a MultiPlayerBoard supports.
+     *
+     **********************************************************************************************/
+    static int maxNbPlayers() {return 10;}
+
+///@}
+
+///@{ @name Moves
+
+    /*******************************************************************************************//**
+     * Plays in a Column for the active Player. The next Player in the turn order becomes
+     * active.
+     *
+     * @param[in] p_column The Column subscript.
+     *
+     * @pre The Column can be played.
+     *
+     **********************************************************************************************/
+    void play(int p_column);
+
+
+    /*******************************************************************************************//**
+     * Plays in a Column for any Player.
+     *
+     * @param[in] p_column      The Column subscript.
+     * @param[in] p_player      The index of the Player who plays.
+     * @param[in] p_nextPlayer  The index of the Player to move next.
+     *
+     * @pre The Column can be played.
+     * @pre Both Player indexes are between 0 and @c nbPlayers() - 1.
+     *
+     **********************************************************************************************/
+    void play(int p_column, int p_player, int p_nextPlayer);
+
+
+    /*******************************************************************************************//**
+     * Takes back the last move made with @c play(). The winner, the scores, the hash and the
+     * active Player are restored.
+     *
+     * @pre At least one move has been made with @c play().
+     *
+     **********************************************************************************************/
+    void undo();
+
+///@}
+
+
+private:
+
+    struct Move
+    {
+        int m_column;           ///< The Column played.
+        int m_player;           ///< The Player who played.
+        int m_activePlayer;     ///< The active Player before the move.
+        int m_winner;           ///< The winner before the move.
+    };
+
+    void addDisc   (int p_row, int p_column, int p_player);
+    void removeDisc(int p_row, int p_column, int p_player);
+
+    void checkInvariant() const;
+
+    std::shared_ptr<const cxbase::WinningLines> m_lines;        ///< The windows for the board shape.
+    int                                         m_nbPlayers;    ///< The number of Players.
+    int                                         m_activePlayer; ///< The Player to move.
+    int                                         m_winner;       ///< The winner, or -1.
+    int                                         m_nbDiscs;      ///< The number of Discs on the board.
+    std::uint64_t                               m_hash;         ///< The Zobrist hash.
+    std::vector<std::uint64_t>                  m_playerKeys;   ///< The Zobrist Disc key of each Player.
+    std::vector<int>                            m_heights;      ///< The number of Discs in each Column.
+    cxbase::LiveWindows                         m_windows;      ///< The Discs of each Player, by window.
+    std::vector<Move>                           m_moves;        ///< The moves made with play().
+
+};
+
+} // namespace cxai
+
+#endif /* MULTIPLAYERBOARD_H_2C7E9A41_B35D_4F80_9D16_E48A0C5B73F2 */
@@ -0,0 +1,237 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    MultiPlayerSearch.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a search engine for Games with any number of Players.
+ *
+ **************************************************************************************************/
+
+#ifndef MULTIPLAYERSEARCH_H_71D3F0B8_4A29_4C6E_8B57_0E92C4A1D6F8
+#define MULTIPLAYERSEARCH_H_71D3F0B8_4A29_4C6E_8B57_0E92C4A1D6F8
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <cxbase/include/Game.h>
+
+#include "MultiPlayerBoard.h"
+#include "SharedTranspositionTable.h"
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class MultiPlayerSearch
+ *
+ * @brief Chooses a move for the active Player of a Game with any number of Players.
+ *
+ * Three classic search algorithms are offered (see @c Mode):
+ *
+ *  @li <b>Max-n</b>: every Player maximizes its own value. Values are shares of a constant
+ *      total (@c maxSum()), which allows shallow pruning: a subtree is cut off as soon as the
+ *      Player to move is sure to get more than what the Player above would let it have.
+ *  @li <b>Paranoid</b>: the searching Player assumes every opponent plays against it. This
+ *      turns the Game into a two sides Game, searched with alpha-beta pruning.
+ *  @li <b>Best-reply</b>: like paranoid, but between two moves of the searching Player, only
+ *      the single strongest opponent move is considered (the other opponents pass). This
+ *      reaches much deeper than paranoid search when there are many Players.
+ *
+ * Non terminal positions are scored from the heuristic scores of a MultiPlayerBoard, which are
+ * updated incrementally as moves are made and unmade. Each Player gets a share of @c maxSum()
+ * proportional to its score. A win is worth the whole @c maxSum() to the winner.
+ *
+ * The search is iteratively deepened until the time budget runs out, so an answer is always
+ * given on time, even on 64 by 64 boards. An immediately winning move is always played.
+ *
+ * The SharedTranspositionTable is kept by every search and every mode of the engine: it holds
+ * the best move found for each position, used to order moves, and for the paranoid and
+ * best-reply modes, value bounds. Table entries are aged at the start of each search.
+ *
+ **************************************************************************************************/
+class MultiPlayerSearch
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The search algorithms.
+     *
+     **********************************************************************************************/
+    enum class Mode: int
+    {
+        MaxN,       ///< Every Player maximizes its own value.
+        Paranoid,   ///< Every opponent minimizes the value of the searching Player.
+        BestReply   ///< Paranoid, with only the best opponent reply considered.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief The result of a search.
+     *
+     **********************************************************************************************/
+    struct Result
+    {
+        int           m_column;     ///< The chosen Column.
+        int           m_depth;      ///< The depth of the last completed iteration.
+        int           m_value;      ///< The value of the chosen move for the searching Player.
+        std::uint64_t m_nbNodes;    ///< The number of positions explored.
+    };
+
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor.
+     *
+     * @param[in] p_mode           The search algorithm.
+     * @param[in] p_tableSizeInMiB The SharedTranspositionTable memory budget, in MiB.
+     *
+     * @pre The memory budget is positive.
+     *
+     **********************************************************************************************/
+    explicit MultiPlayerSearch(Mode p_mode, std::size_t p_tableSizeInMiB = defaultTableSizeInMiB());
+
+///@}
+
+///@{ @name Searching
+
+    /*******************************************************************************************//**
+     * Searches for the best move of the active Player.
+     *
+     * @param[in] p_game     The Game.
+     * @param[in] p_budget   The time budget. Only completed iterations are taken into account,
+     *                       but the first one is always completed.
+     * @param[in] p_maxDepth The maximum search depth, in moves.
+     *
+     * @pre The Game is not over.
+     * @pre The Game has at most @c MultiPlayerBoard::maxNbPlayers() Players.
+     * @pre The maximum depth is positive.
+     *
+     * @return The chosen Column, along with search statistics.
+     *
+     **********************************************************************************************/
+    Result search(const cxbase::Game& p_game, std::chrono::milliseconds p_budget, int p_maxDepth = 64);
+
+
+    /*******************************************************************************************//**
+     * Searches for the best move of the active Player.
+     *
+     * @param[in] p_board    The position. It is explored in place and restored before
+     *                       returning.
+     * @param[in] p_budget   The time budget.
+     * @param[in] p_maxDepth The maximum search depth, in moves.
+     *
+     * @pre No Player has won and the board is not full.
+     * @pre The maximum depth is positive.
+     *
+     * @return The chosen Column, along with search statistics.
+     *
+     **********************************************************************************************/
+    Result search(MultiPlayerBoard& p_board, std::chrono::milliseconds p_budget, int p_maxDepth = 64);
+
+///@}
+
+///@{ @name Data access
+
+    Mode mode() const {return m_mode;}                  ///< Search algorithm accessor.
+    void setMode(Mode p_mode) {m_mode = p_mode;}        ///< Search algorithm mutator.
+
+    const SharedTranspositionTable& table() const {return m_table;} ///< SharedTranspositionTable accessor.
+
+
+    /*******************************************************************************************//**
+     * Sum of the values of all Players.
+     *
+     * @return The total value shared by the Players in every position.
+     *
+     **********************************************************************************************/
+    static int maxSum() {return 1 << 16;}
+
+
+    /*******************************************************************************************//**
+     * Default SharedTranspositionTable memory budget.
+     *
+     * @return A memory budget, in MiB.
+     *
+     **********************************************************************************************/
+    static std::size_t defaultTableSizeInMiB() {return 16;}
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Clears the SharedTranspositionTable.
+     *
+     **********************************************************************************************/
+    void clearTable();
+
+///@}
+
+
+private:
+
+    using Values = std::array<int, 10>;
+
+    using Bound = SharedTranspositionTable::Bound;
+
+    bool isTimeUp();
+    void order(int p_bestColumn, std::vector<int>& p_columns) const;
+    void evaluate(const MultiPlayerBoard& p_board, Values& p_values) const;
+    int  rootValue(const MultiPlayerBoard& p_board) const;
+    int  terminalValue(const MultiPlayerBoard& p_board, int p_depth) const;
+
+    void store(std::uint64_t p_key, int p_depth, int p_value, Bound p_bound, int p_column);
+
+    void maxN     (MultiPlayerBoard& p_board, int p_depth, int p_parentBest, Values& p_values);
+    int  paranoid (MultiPlayerBoard& p_board, int p_depth, int p_alpha, int p_beta);
+    int  bestReply(MultiPlayerBoard& p_board, int p_depth, int p_alpha, int p_beta, bool p_isRootTurn);
+
+    bool searchRoot(MultiPlayerBoard& p_board, int p_depth, Result& p_result);
+
+    Mode                                  m_mode;           ///< The search algorithm.
+    SharedTranspositionTable              m_table;          ///< The cached search results.
+    std::uint64_t                         m_salt;           ///< Separates table values by mode and searching Player.
+    int                                   m_rootPlayer;     ///< The searching Player.
+    std::uint64_t                         m_nbNodes;        ///< The number of explored positions.
+    std::chrono::steady_clock::time_point m_deadline;       ///< When the search must stop.
+    bool                                  m_canStop;        ///< At least one iteration is completed.
+    bool                                  m_isTimeUp;       ///< The deadline has been reached.
+    std::vector<int>                      m_centreOrder;    ///< Columns, from the centre outwards.
+    std::vector<std::vector<int>>         m_moveLists;      ///< Move list buffers, one per remaining depth.
+
+};
+
+} // namespace cxai
+
+#endif /* MULTIPLAYERSEARCH_H_71D3F0B8_4A29_4C6E_8B57_0E92C4A1D6F8 */
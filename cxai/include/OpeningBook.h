@@ -0,0 +1,195 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    OpeningBook.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a memory-mapped opening book.
+ *
+ **************************************************************************************************/
+
+#ifndef OPENINGBOOK_H_3F9D6B20_E4A7_4C18_B5E2_90A7C3D1F846
+#define OPENINGBOOK_H_3F9D6B20_E4A7_4C18_B5E2_90A7C3D1F846
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cxutil/include/MappedFile.h>
+#include <cxutil/include/ReturnCode.h>
+
+#include <cxbase/include/Game.h>
+
+#include "BitBoard.h"
+#include "Solver.h"
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class OpeningBook
+ *
+ * @brief The best Column and score of every early position of a board shape.
+ *
+ * An opening book is a binary file made by an OpeningBookBuilder. It holds a @c Header followed
+ * by one @c Entry per position, sorted by key. Positions are keyed by their symmetric key (see
+ * BitBoard::symmetricKey()), so a position and its mirror image share an entry. The best Column
+ * is stored as seen from the position with the smallest key. Numbers are stored in the byte
+ * order of the machine which built the book.
+ *
+ * The file is mapped in memory, not read: opening a book is immediate whatever its size, and
+ * processes using the same book share its pages. A lookup is a binary search in the mapped
+ * entries, which allocates nothing.
+ *
+ **************************************************************************************************/
+class OpeningBook
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The file header.
+     *
+     **********************************************************************************************/
+    struct Header
+    {
+        char          m_magic[8];       ///< "CXBOOK" followed by two zeros (0).
+        std::uint32_t m_version;        ///< The file format version.
+        std::uint8_t  m_nbRows;         ///< The number of Rows of the board.
+        std::uint8_t  m_nbColumns;      ///< The number of Columns of the board.
+        std::uint8_t  m_inARow;         ///< The @a inARow value.
+        std::uint8_t  m_maxNbMoves;     ///< Positions with up to this number of moves are stored.
+        std::uint64_t m_nbEntries;      ///< The number of entries following the header.
+        std::uint64_t m_reserved;       ///< Zero (0).
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief A position entry.
+     *
+     **********************************************************************************************/
+    struct Entry
+    {
+        std::uint64_t m_key;            ///< The position symmetric key.
+        std::int8_t   m_score;          ///< The position score (see Solver).
+        std::uint8_t  m_column;         ///< The best Column, for the position with this key.
+        std::uint8_t  m_reserved[6];    ///< Zeros (0).
+    };
+
+
+    /*******************************************************************************************//**
+     * Current file format version.
+     *
+     * @return The version written by the OpeningBookBuilder and expected by @c open().
+     *
+     **********************************************************************************************/
+    static std::uint32_t version() {return 1;}
+
+
+    /*******************************************************************************************//**
+     * File magic number.
+     *
+     * @return The eight (8) first bytes of every opening book.
+     *
+     **********************************************************************************************/
+    static const char* magic() {return "CXBOOK\0";}
+
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Opens an opening book. Any book previously opened is closed first.
+     *
+     * @param[in] p_path The book file path.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be mapped or is
+     *         not a valid opening book.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode open(const std::string& p_path);
+
+
+    /*******************************************************************************************//**
+     * Closes the opening book.
+     *
+     **********************************************************************************************/
+    void close();
+
+///@}
+
+///@{ @name Data access
+
+    bool        isOpen()     const {return m_header != nullptr;}            ///< Checks if a book is open.
+    int         nbRows()     const {return isOpen() ? m_header->m_nbRows     : 0;} ///< Number of Rows accessor.
+    int         nbColumns()  const {return isOpen() ? m_header->m_nbColumns  : 0;} ///< Number of Columns accessor.
+    int         inARow()     const {return isOpen() ? m_header->m_inARow     : 0;} ///< @a inARow value accessor.
+    int         maxNbMoves() const {return isOpen() ? m_header->m_maxNbMoves : 0;} ///< Deepest stored positions.
+    std::size_t size()       const {return isOpen() ? static_cast<std::size_t>(m_header->m_nbEntries) : 0;} ///< Number of entries.
+
+
+    /*******************************************************************************************//**
+     * Looks up a position.
+     *
+     * @param[in]  p_board  The position.
+     * @param[out] p_result The best Column and the score of the position, untouched if it is not
+     *                      in the book.
+     *
+     * @return @c true if the position is in the book, @c false if it is not, if the board shape
+     *         is not the one of the book or if no book is open.
+     *
+     **********************************************************************************************/
+    bool lookup(const BitBoard& p_board, Solver::Result& p_result) const;
+
+
+    /*******************************************************************************************//**
+     * Looks up the position of a Game.
+     *
+     * @param[in]  p_game   The Game.
+     * @param[out] p_result The best Column and the score of the position, untouched if it is not
+     *                      in the book.
+     *
+     * @return @c true if the position is in the book, @c false otherwise. Games which do not
+     *         have two (2) Players never are.
+     *
+     **********************************************************************************************/
+    bool lookup(const cxbase::Game& p_game, Solver::Result& p_result) const;
+
+///@}
+
+
+private:
+
+    cxutil::MappedFile m_file;                  ///< The mapped book file.
+    const Header*      m_header {nullptr};      ///< The header, in the mapped file.
+    const Entry*       m_entries{nullptr};      ///< The entries, in the mapped file.
+
+};
+
+} // namespace cxai
+
+#endif /* OPENINGBOOK_H_3F9D6B20_E4A7_4C18_B5E2_90A7C3D1F846 */
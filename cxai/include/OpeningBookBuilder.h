@@ -0,0 +1,154 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    OpeningBookBuilder.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for an opening book builder.
+ *
+ **************************************************************************************************/
+
+#ifndef OPENINGBOOKBUILDER_H_A84C1E36_7B2D_4F05_9C63_E1D07B5A28F4
+#define OPENINGBOOKBUILDER_H_A84C1E36_7B2D_4F05_9C63_E1D07B5A28F4
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <cxutil/include/ReturnCode.h>
+
+#include "BitBoard.h"
+#include "OpeningBook.h"
+#include "Solver.h"
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class OpeningBookBuilder
+ *
+ * @brief Solves every early position of a board shape and writes them as an OpeningBook.
+ *
+ * Positions are enumerated from the empty board, up to a maximum number of moves. A position
+ * and its mirror image are only kept once. Positions in which a Player already has a winning
+ * move are left out: the Solver finds those moves without searching.
+ *
+ * The positions are then solved in parallel: each thread has its own Solver and takes the
+ * next unsolved position until none is left. Building a book is as long as solving all of its
+ * positions, so deep books for big boards take hours.
+ *
+ **************************************************************************************************/
+class OpeningBookBuilder
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor. Enumerates the positions of the book.
+     *
+     * @param[in] p_nbRows     The number of Rows.
+     * @param[in] p_nbColumns  The number of Columns.
+     * @param[in] p_inARow     The @a inARow value.
+     * @param[in] p_maxNbMoves Positions with up to this number of moves are kept.
+     *
+     * @pre The board shape fits in a BitBoard.
+     * @pre The maximum number of moves is at least zero (0) and smaller than the number of
+     *      Positions on the board.
+     *
+     **********************************************************************************************/
+    OpeningBookBuilder(int p_nbRows, int p_nbColumns, int p_inARow, int p_maxNbMoves);
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Solves every position of the book.
+     *
+     * @param[in] p_nbThreads      The number of threads.
+     * @param[in] p_nbTableEntries The number of TranspositionTable entries of each thread's
+     *                             Solver.
+     *
+     * @pre The number of threads is positive.
+     *
+     **********************************************************************************************/
+    void build(int p_nbThreads, std::size_t p_nbTableEntries = Solver::defaultNbTableEntries());
+
+
+    /*******************************************************************************************//**
+     * Writes the book.
+     *
+     * @param[in] p_path The book file path.
+     *
+     * @pre @c build() has been called.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be written.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode write(const std::string& p_path) const;
+
+///@}
+
+///@{ @name Data access
+
+    /*******************************************************************************************//**
+     * Book entries accessor.
+     *
+     * @return The entries, sorted by key. Scores and Columns are only set once @c build() has
+     *         been called.
+     *
+     **********************************************************************************************/
+    const std::vector<OpeningBook::Entry>& entries() const {return m_entries;}
+
+
+    bool isBuilt() const {return m_isBuilt;} ///< Checks if the positions have been solved.
+
+///@}
+
+
+private:
+
+    void enumerate(const BitBoard& p_board, std::unordered_set<std::uint64_t>& p_visited);
+    void solve(std::size_t p_nbTableEntries);
+
+    BitBoard                        m_empty;      ///< The empty board.
+    int                             m_maxNbMoves; ///< Positions with up to this number of moves are kept.
+    std::vector<OpeningBook::Entry> m_entries;    ///< The book entries.
+    std::vector<BitBoard>           m_positions;  ///< The position of each entry.
+    std::atomic<std::size_t>        m_next;       ///< The next position to solve.
+    bool                            m_isBuilt;    ///< The positions have been solved.
+
+};
+
+} // namespace cxai
+
+#endif /* OPENINGBOOKBUILDER_H_A84C1E36_7B2D_4F05_9C63_E1D07B5A28F4 */
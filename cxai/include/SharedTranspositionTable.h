@@ -0,0 +1,276 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    SharedTranspositionTable.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a transposition table shared by many search threads.
+ *
+ **************************************************************************************************/
+
+#ifndef SHAREDTRANSPOSITIONTABLE_H_A4C61F2E_7B30_4D58_92E7_3F0B8D15C6A9
+#define SHAREDTRANSPOSITIONTABLE_H_A4C61F2E_7B30_4D58_92E7_3F0B8D15C6A9
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class SharedTranspositionTable
+ *
+ * @brief A fixed size cache of search results, safely shared by many threads without locks.
+ *
+ * The table is made of buckets, each filling exactly one 64 bytes cache line. A position key
+ * selects a bucket, and a bucket holds up to @c nbEntriesPerBucket() entries, so a lookup
+ * costs at most one cache miss. The @c prefetch() method lets a search start loading the
+ * bucket of a position it is about to look up.
+ *
+ * Each entry is two 64 bits words: the packed data and the key XOR the packed data. Words are
+ * read and written separately, without locks, so two threads writing the same entry at once
+ * may leave it with the words of two different writes. Such a torn entry does not verify (its
+ * key XOR its data gives back no key that is looked up) and is simply ignored.
+ *
+ * When a bucket is full, the entry replaced is the one with the least depth, entries from
+ * previous searches being considered shallower (see @c newSearch()). An entry for the same
+ * key is replaced unless it was searched deeper during the same search.
+ *
+ * The table counts probes, hits and the stores that evict a live entry of another position,
+ * and estimates how much of it is used by the current search. These figures are meant to tune
+ * the table size. Each thread counts in its own cache line, and the counts are only added up
+ * by @c statistics(), so counting adds no contention between threads. Past
+ * @c NB_COUNTER_SLOTS threads, some share their counts and a few increments may be lost.
+ *
+ * The Solver does not use this table: it always searches to the end of the Game, so depths and
+ * search numbers do not help it choose which entries to keep, and its values fit in 16 bits.
+ * Its TranspositionTable packs a key and a value in a single word, which holds twice as many
+ * entries per MiB and can never be torn.
+ *
+ **************************************************************************************************/
+class SharedTranspositionTable
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The kind of value stored.
+     *
+     **********************************************************************************************/
+    enum class Bound: std::uint8_t
+    {
+        None,   ///< No value, only a move.
+        Exact,  ///< The exact value.
+        Lower,  ///< A lower bound of the value.
+        Upper   ///< An upper bound of the value.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief A search result.
+     *
+     **********************************************************************************************/
+    struct Entry
+    {
+        int   m_value;  ///< The value found.
+        int   m_depth;  ///< The depth searched, from 0 to 127.
+        Bound m_bound;  ///< The kind of value.
+        int   m_move;   ///< The best move, from -1 (none) to 127.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief Usage counters, since construction or the last call to @c resetStatistics().
+     *
+     **********************************************************************************************/
+    struct Statistics
+    {
+        std::uint64_t m_nbProbes;       ///< The number of lookups.
+        std::uint64_t m_nbHits;         ///< The number of lookups finding their key.
+        std::uint64_t m_nbStores;       ///< The number of stores.
+        std::uint64_t m_nbCollisions;   ///< The number of stores evicting another live position.
+
+        double hitRate() const       {return m_nbProbes == 0 ? 0.0 : static_cast<double>(m_nbHits) / static_cast<double>(m_nbProbes);}        ///< Hits per lookup.
+        double collisionRate() const {return m_nbStores == 0 ? 0.0 : static_cast<double>(m_nbCollisions) / static_cast<double>(m_nbStores);} ///< Evictions per store.
+    };
+
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor. The number of buckets is the largest power of two (2) fitting the budget.
+     *
+     * @param[in] p_sizeInMiB The memory budget, in MiB.
+     *
+     * @pre The budget is positive.
+     *
+     **********************************************************************************************/
+    explicit SharedTranspositionTable(std::size_t p_sizeInMiB);
+
+///@}
+
+///@{ @name Data access
+
+    std::size_t nbBuckets()   const {return m_mask + 1;}                           ///< Number of buckets accessor.
+    std::size_t nbEntries()   const {return nbBuckets() * nbEntriesPerBucket();}   ///< Number of entries accessor.
+    std::size_t sizeInBytes() const {return nbBuckets() * sizeof(Bucket);}         ///< Memory used by the buckets.
+
+    static std::size_t nbEntriesPerBucket() {return NB_SLOTS;}                     ///< Number of entries per bucket.
+
+
+    /*******************************************************************************************//**
+     * Looks up a position.
+     *
+     * @param[in]  p_key   The position key.
+     * @param[out] p_entry The entry stored for the key, untouched if there is none.
+     *
+     * @return @c true if an entry is stored for the key, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool probe(std::uint64_t p_key, Entry& p_entry) const;
+
+
+    /*******************************************************************************************//**
+     * Hints the processor to start loading the bucket of a position.
+     *
+     * @param[in] p_key The position key.
+     *
+     **********************************************************************************************/
+    void prefetch(std::uint64_t p_key) const
+    {
+#if defined(__GNUC__)
+        __builtin_prefetch(&m_buckets[p_key & m_mask]);
+#else
+        (void)p_key;
+#endif
+    }
+
+
+    /*******************************************************************************************//**
+     * Usage counters accessor.
+     *
+     * @return The usage counters.
+     *
+     **********************************************************************************************/
+    Statistics statistics() const;
+
+
+    /*******************************************************************************************//**
+     * Estimates how full the table is, from a sample of its buckets.
+     *
+     * @return The proportion of entries, from 0 to 1, stored during the current search.
+     *
+     **********************************************************************************************/
+    double fillRate() const;
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Stores a search result for a position.
+     *
+     * @param[in] p_key   The position key.
+     * @param[in] p_entry The search result.
+     *
+     * @pre The depth is between 0 and 127.
+     * @pre The move is between -1 and 127.
+     *
+     **********************************************************************************************/
+    void store(std::uint64_t p_key, const Entry& p_entry);
+
+
+    /*******************************************************************************************//**
+     * Starts a new search. Entries stored before are kept, but are the first to be replaced.
+     *
+     **********************************************************************************************/
+    void newSearch();
+
+
+    /*******************************************************************************************//**
+     * Erases every entry. Must not be called while other threads use the table.
+     *
+     **********************************************************************************************/
+    void clear();
+
+
+    /*******************************************************************************************//**
+     * Sets every usage counter to zero (0). Must not be called while other threads use the
+     * table.
+     *
+     **********************************************************************************************/
+    void resetStatistics();
+
+///@}
+
+
+private:
+
+    static const std::size_t NB_SLOTS = 4;
+    static const std::size_t CACHE_LINE_SIZE = 64;
+    static const std::size_t NB_COUNTER_SLOTS = 64;
+
+    struct Slot
+    {
+        std::atomic<std::uint64_t> m_check;     ///< The key XOR the data.
+        std::atomic<std::uint64_t> m_data;      ///< The packed entry, zero (0) if unused.
+    };
+
+    struct Bucket
+    {
+        Slot m_slots[NB_SLOTS];
+    };
+
+    struct Counters
+    {
+        std::atomic<std::uint64_t> m_nbProbes;      ///< The number of lookups.
+        std::atomic<std::uint64_t> m_nbHits;        ///< The number of lookups finding their key.
+        std::atomic<std::uint64_t> m_nbStores;      ///< The number of stores.
+        std::atomic<std::uint64_t> m_nbCollisions;  ///< The number of evicting stores.
+        unsigned char              m_padding[CACHE_LINE_SIZE - 4 * sizeof(std::atomic<std::uint64_t>)];
+    };
+
+    static_assert(sizeof(Bucket) == CACHE_LINE_SIZE, "A bucket must fill a cache line.");
+    static_assert(sizeof(Counters) == CACHE_LINE_SIZE, "Counters must fill a cache line.");
+
+    std::uint8_t  age(std::uint64_t p_data) const;
+    Counters&     counters() const;
+
+    std::unique_ptr<unsigned char[]>    m_memory;           ///< The allocated memory, with room for alignment.
+    Bucket*                             m_buckets;          ///< The buckets, aligned on a cache line.
+    Counters*                           m_counters;         ///< The counters of each thread, after the buckets.
+    std::size_t                         m_mask;             ///< The number of buckets minus one (1).
+    std::uint8_t                        m_generation;       ///< The current search number, modulo 64.
+
+};
+
+} // namespace cxai
+
+#endif /* SHAREDTRANSPOSITIONTABLE_H_A4C61F2E_7B30_4D58_92E7_3F0B8D15C6A9 */
@@ -0,0 +1,284 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    Solver.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a two players perfect play solver.
+ *
+ **************************************************************************************************/
+
+#ifndef SOLVER_H_8E27B4C1_6F3D_4A59_B0D8_15C9E2A7F364
+#define SOLVER_H_8E27B4C1_6F3D_4A59_B0D8_15C9E2A7F364
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "BitBoard.h"
+#include "TranspositionTable.h"
+
+
+namespace cxai
+{
+
+class OpeningBook;
+
+/***********************************************************************************************//**
+ * @class Solver
+ *
+ * @brief Computes the game theoretic value of two players Connect X positions.
+ *
+ * The Solver runs a negamax search with alpha-beta pruning down to the end of the Game. It
+ * relies on the following to keep the search tractable:
+ *
+ *  @li Moves giving the opponent an immediate win are never explored.
+ *  @li Moves are explored centre Columns first, then by the number of winning Positions they
+ *      create. The move which caused a cutoff the last time a position was searched, if any,
+ *      is always explored first.
+ *  @li Results are cached in a TranspositionTable as lower or upper bounds. A position and its
+ *      mirror image share their entry.
+ *  @li The score is found by iterative deepening on the score window: a sequence of null window
+ *      searches narrows the score bounds until they meet. Early wins or losses are probed first
+ *      since they are the cheapest to prove.
+ *
+ * <b>Scores</b> are always given from the point of view of the Player whose turn it is. Zero
+ * (0) is a draw. A positive score means the Player to move can force a win: the score is one
+ * (1) plus the number of Discs this Player still has in hand after the winning move, so faster
+ * wins get higher scores. A negative score is a forced loss, using the same scale for the
+ * opponent.
+ *
+ * The TranspositionTable is kept from one call to the next, which speeds up the analysis of
+ * related positions. It is cleared when the board size changes.
+ *
+ * An OpeningBook may be given to the Solver: positions found in the book are not searched,
+ * whether they are analyzed directly or reached during a search.
+ *
+ * <b>Threads</b>: a Solver may search with several threads (Lazy SMP). Every thread runs the
+ * same null window searches, sharing the TranspositionTable, and the first one to finish
+ * gives the result. The helper threads explore equally good moves in a different order, so
+ * they fill the table with results the others soon need. Since each null window search has a
+ * single answer, scores and best Columns do not depend on the number of threads. The helper
+ * threads live as long as the Solver and sleep between searches.
+ *
+ **************************************************************************************************/
+class Solver
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The result of a position analysis.
+     *
+     **********************************************************************************************/
+    struct Result
+    {
+        int m_column;   ///< The best Column to play.
+        int m_score;    ///< The position score, with perfect play from both Players.
+    };
+
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor.
+     *
+     * @param[in] p_nbTableEntries The number of TranspositionTable entries. Each entry uses
+     *                             eight (8) bytes.
+     * @param[in] p_nbThreads      The number of search threads.
+     *
+     * @pre The number of entries is at least 65536.
+     * @pre The number of threads is positive.
+     *
+     **********************************************************************************************/
+    explicit Solver(std::size_t p_nbTableEntries = defaultNbTableEntries(), int p_nbThreads = 1);
+
+
+    /*******************************************************************************************//**
+     * Destructor. Stops the helper threads.
+     *
+     **********************************************************************************************/
+    ~Solver();
+
+///@}
+
+///@{ @name Solving
+
+    /*******************************************************************************************//**
+     * Computes the score of a position.
+     *
+     * @param[in] p_board The position.
+     *
+     * @pre No alignment is already completed on the board.
+     *
+     * @return The position score, with perfect play from both Players.
+     *
+     **********************************************************************************************/
+    int solve(const BitBoard& p_board);
+
+
+    /*******************************************************************************************//**
+     * Computes the score and the best Column to play for a position.
+     *
+     * When more than one Column leads to the best score, the most central one is given.
+     *
+     * @param[in] p_board The position.
+     *
+     * @pre No alignment is already completed on the board.
+     * @pre The board is not full.
+     *
+     * @return The best Column and the position score.
+     *
+     **********************************************************************************************/
+    Result analyze(const BitBoard& p_board);
+
+///@}
+
+///@{ @name Data access
+
+    /*******************************************************************************************//**
+     * Number of explored nodes accessor.
+     *
+     * @return The number of positions explored by all threads since construction or since the
+     *         last call to @c reset().
+     *
+     **********************************************************************************************/
+    std::uint64_t nbExploredNodes() const;
+
+
+    /*******************************************************************************************//**
+     * Number of search threads accessor.
+     *
+     * @return The number of threads searching each position.
+     *
+     **********************************************************************************************/
+    int nbThreads() const {return static_cast<int>(m_workers.size());}
+
+
+    /*******************************************************************************************//**
+     * Minimum score accessor.
+     *
+     * @param[in] p_board A board.
+     *
+     * @return The lowest possible score for the board size: the opponent wins with its last
+     *         Disc.
+     *
+     **********************************************************************************************/
+    static int minScore(const BitBoard& p_board);
+
+
+    /*******************************************************************************************//**
+     * Maximum score accessor.
+     *
+     * @param[in] p_board A board.
+     *
+     * @return The highest possible score for the board size: the first Player wins as early as
+     *         possible.
+     *
+     **********************************************************************************************/
+    static int maxScore(const BitBoard& p_board);
+
+
+    /*******************************************************************************************//**
+     * Default number of TranspositionTable entries.
+     *
+     * @return A prime number of entries using 64 MiB.
+     *
+     **********************************************************************************************/
+    static std::size_t defaultNbTableEntries() {return 8388593;}
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Clears the TranspositionTable and the explored nodes count.
+     *
+     **********************************************************************************************/
+    void reset();
+
+
+    /*******************************************************************************************//**
+     * Sets the OpeningBook to consult before searching.
+     *
+     * @param[in] p_book The OpeningBook, or @c nullptr to search every position. It must outlive
+     *                   its use by the Solver. Books made for other board shapes are ignored.
+     *
+     **********************************************************************************************/
+    void setOpeningBook(const OpeningBook* p_book) {m_book = p_book;}
+
+///@}
+
+
+private:
+
+    struct Worker
+    {
+        std::uint64_t    m_nbExploredNodes; ///< The number of positions explored by the thread.
+        std::vector<int> m_columnOrder;     ///< The Columns, in the thread exploration order.
+    };
+
+    int  search(const BitBoard& p_board, int p_alpha, int p_beta);
+    void runHelper(std::size_t p_worker);
+    void help(Worker& p_worker, const BitBoard& p_board, int p_alpha, int p_beta, int& p_score);
+    int  negamax(Worker& p_worker, const BitBoard& p_board, int p_alpha, int p_beta);
+    void prepareFor(const BitBoard& p_board);
+
+    const std::vector<int>& columnOrder() const {return m_workers.front().m_columnOrder;}
+
+    TranspositionTable  m_table;            ///< The cached search results.
+    const OpeningBook*  m_book;             ///< The OpeningBook, if any.
+    int                 m_bookNbMoves;      ///< Book positions have at most this number of moves.
+    std::vector<Worker> m_workers;          ///< The state of each search thread. The first is the caller's.
+    std::atomic<bool>   m_isStopped;        ///< A thread has finished the current search.
+
+    std::vector<std::thread> m_helpers;       ///< The helper threads, one per Worker but the first.
+    std::mutex               m_mutex;         ///< Guards the search request below.
+    std::condition_variable  m_newSearch;     ///< Wakes the helpers up for a search or to quit.
+    std::condition_variable  m_helpersDone;   ///< Wakes the caller up when all helpers are done.
+    std::uint64_t            m_searchId;      ///< Incremented for each search given to the helpers.
+    std::size_t              m_nbBusyHelpers; ///< The number of helpers still on the current search.
+    bool                     m_isQuitting;    ///< The helpers must end.
+    const BitBoard*          m_board;         ///< The position of the current search.
+    int                      m_alpha;         ///< The score window lower bound of the current search.
+    int                      m_beta;          ///< The score window upper bound of the current search.
+    int                      m_score;         ///< The result of the current search.
+
+    int                 m_nbRows;           ///< The number of Rows of the boards in the table.
+    int                 m_inARow;           ///< The @a inARow value of the boards in the table.
+    int                 m_minScore;         ///< The minimum score for the current board size.
+    int                 m_maxScore;         ///< The maximum score for the current board size.
+
+};
+
+} // namespace cxai
+
+#endif /* SOLVER_H_8E27B4C1_6F3D_4A59_B0D8_15C9E2A7F364 */
@@ -0,0 +1,288 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    Tablebase.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a memory-mapped Connect X tablebase.
+ *
+ **************************************************************************************************/
+
+#ifndef TABLEBASE_H_C2E05A7B_94D1_4F3E_8B6A_5D17E3C90F28
+#define TABLEBASE_H_C2E05A7B_94D1_4F3E_8B6A_5D17E3C90F28
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cxutil/include/MappedFile.h>
+#include <cxutil/include/ReturnCode.h>
+
+#include <cxbase/include/Game.h>
+
+#include "BitBoard.h"
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class Tablebase
+ *
+ * @brief The outcome of every reachable position of a board shape, with perfect play.
+ *
+ * A tablebase is a binary file made by a TablebaseGenerator. It holds, in this order:
+ *
+ *  @li A @c Header.
+ *  @li A directory of <tt>2^directoryBits + 1</tt> entry indexes: the entries of the keys whose
+ *      @c directoryBits most significant bits (of the @c (nbRows + 1) * nbColumns key bits) are
+ *      @a b start at index @a b of the directory and end where the next bucket starts.
+ *  @li The position keys (see BitBoard::key()), sorted. Since the directory bits of a key are
+ *      given by its bucket, only the other bits are stored, on @c keyBytes bytes, least
+ *      significant byte first. A 6 by 7 key, for example, takes four (4) bytes instead of eight
+ *      (8).
+ *  @li One value byte per key: the outcome in the two (2) least significant bits and the
+ *      distance to the result, in plies, in the others.
+ *
+ * Every position reachable from the empty board is stored, except those in which a Player has
+ * already won. The header and directory numbers are stored in the byte order of the machine
+ * which made the tablebase.
+ *
+ * The file is mapped in memory, not read. A probe reads one directory entry, then binary
+ * searches a bucket of a few keys, which usually lie in the same page: nothing is computed but
+ * a few comparisons, and nothing is allocated.
+ *
+ **************************************************************************************************/
+class Tablebase
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief A position outcome, for the Player to move.
+     *
+     **********************************************************************************************/
+    enum class Outcome : std::uint8_t
+    {
+        Loss = 0,
+        Draw = 1,
+        Win  = 2,
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief The result of a probe.
+     *
+     **********************************************************************************************/
+    struct Result
+    {
+        Outcome m_outcome;  ///< The outcome, with perfect play from both Players.
+        int     m_distance; ///< The number of plies until the Game ends, with perfect play.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief The file header.
+     *
+     **********************************************************************************************/
+    struct Header
+    {
+        char          m_magic[8];       ///< "CXTBASE" followed by a zero (0).
+        std::uint32_t m_version;        ///< The file format version.
+        std::uint8_t  m_nbRows;         ///< The number of Rows of the board.
+        std::uint8_t  m_nbColumns;      ///< The number of Columns of the board.
+        std::uint8_t  m_inARow;         ///< The @a inARow value.
+        std::uint8_t  m_directoryBits;  ///< The number of key bits indexing the directory.
+        std::uint64_t m_nbEntries;      ///< The number of positions.
+        std::uint8_t  m_keyBytes;       ///< The number of bytes of each stored key.
+        std::uint8_t  m_reserved[7];    ///< Zeros (0).
+    };
+
+
+    /*******************************************************************************************//**
+     * Current file format version.
+     *
+     * @return The version written by the TablebaseGenerator and expected by @c open().
+     *
+     **********************************************************************************************/
+    static std::uint32_t version() {return 2;}
+
+
+    /*******************************************************************************************//**
+     * File magic number.
+     *
+     * @return The eight (8) first bytes of every tablebase.
+     *
+     **********************************************************************************************/
+    static const char* magic() {return "CXTBASE";}
+
+
+    /*******************************************************************************************//**
+     * Encodes a Result in a value byte.
+     *
+     * @param[in] p_result The Result.
+     *
+     * @return The value byte.
+     *
+     **********************************************************************************************/
+    static std::uint8_t encode(const Result& p_result)
+    {
+        return static_cast<std::uint8_t>((p_result.m_distance << 2) | static_cast<int>(p_result.m_outcome));
+    }
+
+
+    /*******************************************************************************************//**
+     * Decodes a value byte.
+     *
+     * @param[in] p_value The value byte.
+     *
+     * @return The Result.
+     *
+     **********************************************************************************************/
+    static Result decode(std::uint8_t p_value)
+    {
+        return Result{static_cast<Outcome>(p_value & 0x3), p_value >> 2};
+    }
+
+
+    /*******************************************************************************************//**
+     * Result of a move.
+     *
+     * @param[in] p_next The Result of the position reached by the move, for the opponent.
+     *
+     * @return The Result of playing the move, for the Player to move.
+     *
+     **********************************************************************************************/
+    static Result throughMove(const Result& p_next);
+
+
+    /*******************************************************************************************//**
+     * Ranks a Result, from the point of view of the Player to move: the fastest win is the
+     * best, then draws, then losses, the slowest loss being the least bad.
+     *
+     * @param[in] p_result The Result.
+     *
+     * @return A rank, higher for better Results.
+     *
+     **********************************************************************************************/
+    static int rank(const Result& p_result);
+
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Opens a tablebase. Any tablebase previously opened is closed first.
+     *
+     * @param[in] p_path The tablebase file path.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be mapped or is
+     *         not a valid tablebase.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode open(const std::string& p_path);
+
+
+    /*******************************************************************************************//**
+     * Closes the tablebase.
+     *
+     **********************************************************************************************/
+    void close();
+
+///@}
+
+///@{ @name Data access
+
+    bool        isOpen()    const {return m_header != nullptr;}                                ///< Checks if a tablebase is open.
+    int         nbRows()    const {return isOpen() ? m_header->m_nbRows    : 0;}                ///< Number of Rows accessor.
+    int         nbColumns() const {return isOpen() ? m_header->m_nbColumns : 0;}                ///< Number of Columns accessor.
+    int         inARow()    const {return isOpen() ? m_header->m_inARow    : 0;}                ///< @a inARow value accessor.
+    std::size_t size()      const {return isOpen() ? static_cast<std::size_t>(m_header->m_nbEntries) : 0;} ///< Number of positions.
+
+
+    /*******************************************************************************************//**
+     * Probes a position.
+     *
+     * @param[in]  p_board  The position.
+     * @param[out] p_result The outcome of the position and its distance, untouched if it is not
+     *                      in the tablebase.
+     *
+     * @return @c true if the position is in the tablebase, @c false if it is not (a Player has
+     *         already won), if the board shape is not the one of the tablebase or if no
+     *         tablebase is open.
+     *
+     **********************************************************************************************/
+    bool probe(const BitBoard& p_board, Result& p_result) const;
+
+
+    /*******************************************************************************************//**
+     * Probes the position of a Game.
+     *
+     * @param[in]  p_game   The Game.
+     * @param[out] p_result The outcome of the position and its distance, untouched if it is not
+     *                      in the tablebase.
+     *
+     * @return @c true if the position is in the tablebase, @c false otherwise. Games which do not
+     *         have two (2) Players never are.
+     *
+     **********************************************************************************************/
+    bool probe(const cxbase::Game& p_game, Result& p_result) const;
+
+
+    /*******************************************************************************************//**
+     * Finds a perfect move: the fastest win, else a draw, else the slowest loss.
+     *
+     * @param[in] p_board The position.
+     *
+     * @pre The board is not full.
+     *
+     * @return The Column to play, or -1 if the position is not in the tablebase (see
+     *         @c probe()) or if the tablebase is corrupted.
+     *
+     **********************************************************************************************/
+    int bestColumn(const BitBoard& p_board) const;
+
+///@}
+
+
+private:
+
+    std::uint64_t storedKey(std::uint64_t p_index) const;
+
+    cxutil::MappedFile   m_file;                 ///< The mapped tablebase file.
+    const Header*        m_header   {nullptr};   ///< The header, in the mapped file.
+    const std::uint64_t* m_directory{nullptr};   ///< The bucket directory, in the mapped file.
+    const std::uint8_t*  m_keys     {nullptr};   ///< The sorted stored keys, in the mapped file.
+    const std::uint8_t*  m_values   {nullptr};   ///< The value of each key, in the mapped file.
+    int                  m_keyShift {0};         ///< Shifts a key to its directory bucket.
+    std::uint64_t        m_keyMask  {0};         ///< Keeps the stored bits of a key.
+    int                  m_keyBytes {0};         ///< The number of bytes of each stored key.
+
+};
+
+} // namespace cxai
+
+#endif /* TABLEBASE_H_C2E05A7B_94D1_4F3E_8B6A_5D17E3C90F28 */
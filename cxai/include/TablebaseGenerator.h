@@ -0,0 +1,165 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    TablebaseGenerator.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a retrograde analysis tablebase generator.
+ *
+ **************************************************************************************************/
+
+#ifndef TABLEBASEGENERATOR_H_71B4E9D2_3C58_4A06_A1F7_E82D60B5C94A
+#define TABLEBASEGENERATOR_H_71B4E9D2_3C58_4A06_A1F7_E82D60B5C94A
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <cxutil/include/ReturnCode.h>
+
+#include "BitBoard.h"
+#include "Tablebase.h"
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class TablebaseGenerator
+ *
+ * @brief Computes the outcome of every reachable position of a board shape and writes them as
+ *        a Tablebase.
+ *
+ * The generation runs in two passes over the positions, grouped by number of moves:
+ *
+ *  @li Forward, from the empty board, every reachable position is enumerated. Positions in
+ *      which the Player to move has a winning move are kept, but not expanded: the Game ends
+ *      with that move.
+ *  @li Backward (retrograde analysis), from the full boards to the empty board, each position
+ *      gets the best Result among its moves, which are all in the next group and already
+ *      known.
+ *
+ * Each group is a sorted vector of keys, so the memory used is about nine (9) bytes per
+ * position. Only small boards or small @a inARow values are tractable: the 4 by 5, connect four
+ * board has less than three (3) million positions and the 5 by 5 one about forty (40) million.
+ * The 6 by 7, connect four board has trillions, but the 6 by 7, connect three board has about
+ * 182 million, which fit in the default maximum number of positions.
+ *
+ **************************************************************************************************/
+class TablebaseGenerator
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor.
+     *
+     * @param[in] p_nbRows     The number of Rows.
+     * @param[in] p_nbColumns  The number of Columns.
+     * @param[in] p_inARow     The @a inARow value.
+     *
+     * @pre The board shape fits in a BitBoard.
+     *
+     **********************************************************************************************/
+    TablebaseGenerator(int p_nbRows, int p_nbColumns, int p_inARow);
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Computes the outcome of every reachable position.
+     *
+     * @param[in] p_maxNbPositions The maximum number of positions, to bound the memory used.
+     *
+     * @return A ReturnCode holding an error if there are more positions than allowed. Nothing
+     *         is then generated.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode generate(std::size_t p_maxNbPositions = defaultMaxNbPositions());
+
+
+    /*******************************************************************************************//**
+     * Writes the tablebase.
+     *
+     * @param[in] p_path The tablebase file path.
+     *
+     * @pre @c generate() has succeeded.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be written.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode write(const std::string& p_path) const;
+
+///@}
+
+///@{ @name Data access
+
+    bool        isGenerated() const {return m_isGenerated;} ///< Checks if the positions have been solved.
+    std::size_t size()        const;                       ///< Number of positions.
+
+
+    /*******************************************************************************************//**
+     * Number of positions with an Outcome.
+     *
+     * @param[in] p_outcome The Outcome, for the Player to move.
+     *
+     * @return The number of positions with this Outcome.
+     *
+     **********************************************************************************************/
+    std::size_t nbPositions(Tablebase::Outcome p_outcome) const;
+
+
+    /*******************************************************************************************//**
+     * Default maximum number of positions.
+     *
+     * @return A number of positions using about 2 GiB.
+     *
+     **********************************************************************************************/
+    static std::size_t defaultMaxNbPositions() {return std::size_t{1} << 28;}
+
+///@}
+
+
+private:
+
+    cxutil::ReturnCode enumerate(std::size_t p_maxNbPositions);
+    void solve();
+
+    BitBoard                                m_empty;       ///< The empty board.
+    std::vector<std::vector<std::uint64_t>> m_keys;        ///< The sorted keys, by number of moves.
+    std::vector<std::vector<std::uint8_t>>  m_values;      ///< The value of each key, by number of moves.
+    bool                                    m_isGenerated; ///< The positions have been solved.
+
+};
+
+} // namespace cxai
+
+#endif /* TABLEBASEGENERATOR_H_71B4E9D2_3C58_4A06_A1F7_E82D60B5C94A */
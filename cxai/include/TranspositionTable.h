@@ -0,0 +1,147 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    TranspositionTable.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a transposition table.
+ *
+ **************************************************************************************************/
+
+#ifndef TRANSPOSITIONTABLE_H_D51A7E3B_0C64_4F92_9B2E_7A18C3F5E640
+#define TRANSPOSITIONTABLE_H_D51A7E3B_0C64_4F92_9B2E_7A18C3F5E640
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+
+namespace cxai
+{
+
+/***********************************************************************************************//**
+ * @class TranspositionTable
+ *
+ * @brief A fixed size cache of search results, indexed by position key.
+ *
+ * A key is stored in the entry at index <tt>key % size()</tt>, overwriting any previous
+ * content: the table never grows. Each entry is a single 64 bits word holding a 16 bits value
+ * in its low bits and <tt>key / size()</tt> in the others. Together with the entry index, this
+ * is enough to tell keys apart, so a lookup only touches one word. The value zero (0) is
+ * reserved to mean that nothing is stored for a key.
+ *
+ * Since an entry is a single word, read and written atomically, the table can be shared by
+ * several search threads without locks: a lookup sees either the old or the new content of an
+ * entry, never a mix of both.
+ *
+ **************************************************************************************************/
+class TranspositionTable
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor.
+     *
+     * @param[in] p_nbEntries The number of entries. A prime number gives a better spread of the
+     *                        keys.
+     *
+     * @pre The number of entries is at least 65536, so any key quotient fits in 48 bits.
+     *
+     **********************************************************************************************/
+    explicit TranspositionTable(std::size_t p_nbEntries);
+
+///@}
+
+///@{ @name Data access
+
+    /*******************************************************************************************//**
+     * Number of entries accessor.
+     *
+     * @return The number of entries in the table.
+     *
+     **********************************************************************************************/
+    std::size_t size() const {return m_size;}
+
+
+    /*******************************************************************************************//**
+     * Gets the value stored for a key.
+     *
+     * @param[in] p_key The key.
+     *
+     * @return The value stored for the key, or zero (0) if there is none.
+     *
+     **********************************************************************************************/
+    std::uint16_t get(std::uint64_t p_key) const
+    {
+        const std::uint64_t entry{m_entries[index(p_key)].load(std::memory_order_relaxed)};
+
+        return (entry >> 16) == quotient(p_key) ? static_cast<std::uint16_t>(entry) : 0;
+    }
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Stores a value for a key. Any previous value for the same entry is lost.
+     *
+     * @param[in] p_key   The key.
+     * @param[in] p_value The value. Zero (0) erases the entry.
+     *
+     **********************************************************************************************/
+    void put(std::uint64_t p_key, std::uint16_t p_value)
+    {
+        m_entries[index(p_key)].store((quotient(p_key) << 16) | p_value, std::memory_order_relaxed);
+    }
+
+
+    /*******************************************************************************************//**
+     * Erases every entry.
+     *
+     **********************************************************************************************/
+    void reset();
+
+///@}
+
+
+private:
+
+    std::size_t   index   (std::uint64_t p_key) const {return static_cast<std::size_t>(p_key % m_size);}
+    std::uint64_t quotient(std::uint64_t p_key) const {return p_key / m_size;}
+
+    std::size_t                                 m_size;     ///< The number of entries.
+    std::unique_ptr<std::atomic<std::uint64_t>[]> m_entries;  ///< The key quotient and value of each entry.
+
+};
+
+} // namespace cxai
+
+#endif /* TRANSPOSITIONTABLE_H_D51A7E3B_0C64_4F92_9B2E_7A18C3F5E640 */
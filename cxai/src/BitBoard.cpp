@@ -0,0 +1,198 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    BitBoard.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a compact two players board representation.
+ *
+ **************************************************************************************************/
+
+#include <cxbase/include/GameBoard.h>
+
+#include "../include/BitBoard.h"
+
+
+using namespace cxai;
+
+
+BitBoard::BitBoard(int p_nbRows, int p_nbColumns, int p_inARow): m_nbRows{p_nbRows},
+                                                                 m_nbColumns{p_nbColumns},
+                                                                 m_inARow{p_inARow},
+                                                                 m_nbMoves{0},
+                                                                 m_current{0},
+                                                                 m_mask{0},
+                                                                 m_bottomMask{0},
+                                                                 m_boardMask{0},
+                                                                 m_isConnectFour{p_inARow == 4 && 3 * (p_nbRows + 2) < 64}
+{
+    PRECONDITION(p_nbRows > 0);
+    PRECONDITION(p_nbColumns > 0);
+    PRECONDITION((p_nbRows + 1) * p_nbColumns <= 64);
+    PRECONDITION(p_inARow >= 2);
+    PRECONDITION(p_inARow < MAX_IN_A_ROW);
+
+    // alignmentsOfFour() shifts by up to three (3) times nbRows + 2 bits (upward diagonals).
+    // Taller boards use the general alignments(), which skips shifts of 64 bits or more:
+    ASSERTION(!m_isConnectFour || 3 * (m_nbRows + 2) < 64);
+
+    for(int column{0}; column < m_nbColumns; ++column)
+    {
+        m_bottomMask |= std::uint64_t{1} << (column * (m_nbRows + 1));
+        m_boardMask  |= columnMask(column);
+    }
+
+    INVARIANTS();
+}
+
+
+BitBoard BitBoard::fromGame(const cxbase::Game& p_game)
+{
+    PRECONDITION(p_game.nbPlayers() == 2);
+
+    const cxbase::GameBoard& gameboard{p_game.gameboard()};
+
+    BitBoard board{gameboard.nbRows(), gameboard.nbColumns(), p_game.inARowValue()};
+
+    const cxbase::DiscId activeDisc{p_game.discIdOf(p_game.activePlayerIndex())};
+
+    for(int column{0}; column < board.m_nbColumns; ++column)
+    {
+        for(int row{0}; row < board.m_nbRows; ++row)
+        {
+            const cxbase::DiscId discId{gameboard.discId(cxbase::Position{cxbase::Row{row}, cxbase::Column{column}})};
+
+            if(discId == cxbase::DiscPalette::noDiscId())
+            {
+                break;
+            }
+
+            const std::uint64_t bit{std::uint64_t{1} << (column * (board.m_nbRows + 1) + row)};
+
+            board.m_mask |= bit;
+
+            if(discId == activeDisc)
+            {
+                board.m_current |= bit;
+            }
+
+            ++board.m_nbMoves;
+        }
+    }
+
+    return board;
+}
+
+
+BitBoard BitBoard::fromKey(int p_nbRows, int p_nbColumns, int p_inARow, std::uint64_t p_key)
+{
+    BitBoard board{p_nbRows, p_nbColumns, p_inARow};
+
+    const int           columnShift{p_nbRows + 1};
+    const std::uint64_t columnBits {(std::uint64_t{1} << columnShift) - 1};
+
+    PRECONDITION(columnShift * p_nbColumns == 64 || (p_key >> (columnShift * p_nbColumns)) == 0);
+
+    // A Column holding h Discs adds 2^h - 1 to its Discs in the key, so its part of the key is
+    // in [2^h - 1, 2^(h + 1) - 2]. These ranges do not overlap, which gives back h:
+    for(int column{0}; column < p_nbColumns; ++column)
+    {
+        const std::uint64_t value{(p_key >> (column * columnShift)) & columnBits};
+
+        PRECONDITION(value < columnBits);
+
+        int height{0};
+
+        while((std::uint64_t{2} << height) - 1 <= value)
+        {
+            ++height;
+        }
+
+        const std::uint64_t mask{(std::uint64_t{1} << height) - 1};
+
+        board.m_mask    |= mask << (column * columnShift);
+        board.m_current |= (value - mask) << (column * columnShift);
+        board.m_nbMoves += height;
+    }
+
+    return board;
+}
+
+
+bool BitBoard::canPlay(int p_column) const
+{
+    PRECONDITION(p_column >= 0);
+    PRECONDITION(p_column < m_nbColumns);
+
+    return (possible() & columnMask(p_column)) != 0;
+}
+
+
+void BitBoard::play(int p_column)
+{
+    PRECONDITION(canPlay(p_column));
+
+    playMove(possible() & columnMask(p_column));
+
+    INVARIANTS();
+}
+
+
+int BitBoard::play(const std::string& p_sequence)
+{
+    int nbPlayed{0};
+
+    for(const char move : p_sequence)
+    {
+        const int column{move - '1'};
+
+        if(column < 0 || column >= m_nbColumns || !canPlay(column) || isWinningMove(column))
+        {
+            break;
+        }
+
+        play(column);
+        ++nbPlayed;
+    }
+
+    return nbPlayed;
+}
+
+
+bool BitBoard::isWinningMove(int p_column) const
+{
+    PRECONDITION(canPlay(p_column));
+
+    return (winningPositions() & possible() & columnMask(p_column)) != 0;
+}
+
+
+void BitBoard::checkInvariant() const
+{
+    INVARIANT((m_nbRows + 1) * m_nbColumns <= 64);
+    INVARIANT(m_inARow >= 2);
+}
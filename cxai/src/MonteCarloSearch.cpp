@@ -0,0 +1,428 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    MonteCarloSearch.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a parallel Monte Carlo tree search engine.
+ *
+ **************************************************************************************************/
+
+#include <cmath>
+#include <functional>
+#include <thread>
+
+#include <cxutil/include/ContractException.h>
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/MonteCarloSearch.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+// Values of Node::m_firstChild when a node has no children:
+const std::int32_t UNEXPANDED{-1};    // Children may be created.
+const std::int32_t EXPANDING {-2};    // Another thread is creating the children.
+const std::int32_t LEAF      {-3};    // The node pool is exhausted.
+
+const std::size_t  MIN_NB_NODES{65};  // The root and at most 64 children.
+const double       EXPLORATION {1.41421356};
+const std::uint64_t SEED_STEP  {0x9E3779B97F4A7C15ull};
+
+} // unamed namespace
+
+
+MonteCarloSearch::MonteCarloSearch(int p_nbThreads, std::size_t p_maxNbNodes, std::uint64_t p_seed): m_nbThreads{p_nbThreads},
+                                                                                                     m_maxNbNodes{p_maxNbNodes},
+                                                                                                     m_seed{p_seed},
+                                                                                                     m_nbPlayers{2},
+                                                                                                     m_nodes{new Node[p_maxNbNodes]},
+                                                                                                     m_nbNodes{0},
+                                                                                                     m_nbPlayouts{0},
+                                                                                                     m_maxPlayouts{0},
+                                                                                                     m_isBudgetSpent{false}
+{
+    PRECONDITION(p_nbThreads > 0);
+    PRECONDITION(p_maxNbNodes >= MIN_NB_NODES);
+}
+
+
+MonteCarloSearch::Result MonteCarloSearch::search(const cxbase::Game&       p_game,
+                                                  std::chrono::milliseconds p_timeBudget,
+                                                  std::uint64_t             p_maxPlayouts)
+{
+    PRECONDITION(!p_game.isWon());
+    PRECONDITION(!p_game.isDraw());
+    PRECONDITION(p_maxPlayouts > 0);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    m_deadline = start + p_timeBudget;
+
+    const MultiPlayerBoard board{p_game};
+
+    m_nbPlayers = board.nbPlayers();
+
+    const int nbColumns{board.nbColumns()};
+
+    m_centreOrder.clear();
+
+    for(int i{0}; i < nbColumns; ++i)
+    {
+        m_centreOrder.push_back(nbColumns / 2 + (1 - 2 * (i % 2)) * (i + 1) / 2);
+    }
+
+    Node& root{m_nodes[0]};
+
+    root.m_rewards.store(0);
+    root.m_visits.store(0);
+    root.m_virtualLosses.store(0);
+    root.m_firstChild.store(UNEXPANDED);
+    root.m_nbChildren = 0;
+    root.m_column     = -1;
+    root.m_player     = -1;
+
+    m_nbNodes.store(1);
+    m_nbPlayouts.store(0);
+    m_maxPlayouts = p_maxPlayouts;
+    m_isBudgetSpent.store(false);
+
+    // Every thread starts from the same children:
+    const bool isRootExpanded{expand(0, board)};
+    ASSERTION(isRootExpanded);
+    (void)isRootExpanded;
+
+    std::vector<std::thread> helpers;
+
+    for(int thread{1}; thread < m_nbThreads; ++thread)
+    {
+        helpers.emplace_back(&MonteCarloSearch::work, this, std::cref(board), m_seed + static_cast<std::uint64_t>(thread) * SEED_STEP);
+    }
+
+    work(board, m_seed);
+
+    for(std::thread& helper : helpers)
+    {
+        helper.join();
+    }
+
+    // The most visited move is the most reliable:
+    const std::int32_t firstChild{root.m_firstChild.load()};
+    std::int32_t       best      {firstChild};
+
+    for(std::int32_t child{firstChild}; child < firstChild + root.m_nbChildren; ++child)
+    {
+        if(m_nodes[static_cast<std::size_t>(child)].m_visits.load() > m_nodes[static_cast<std::size_t>(best)].m_visits.load())
+        {
+            best = child;
+        }
+    }
+
+    const Node&         chosen{m_nodes[static_cast<std::size_t>(best)]};
+    const std::uint32_t visits{chosen.m_visits.load()};
+
+    Result result;
+
+    result.m_column     = chosen.m_column;
+    result.m_value      = visits == 0 ? 0.0 : static_cast<double>(chosen.m_rewards.load()) / (static_cast<double>(visits) * m_nbPlayers);
+    result.m_nbPlayouts = std::min(m_nbPlayouts.load(), m_maxPlayouts);
+    result.m_nbNodes    = std::min(m_nbNodes.load(), m_maxNbNodes);
+    result.m_elapsed    = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    return result;
+}
+
+
+int MonteCarloSearch::defaultNbThreads()
+{
+    const unsigned int nbHardwareThreads{std::thread::hardware_concurrency()};
+
+    return nbHardwareThreads == 0 ? 1 : static_cast<int>(nbHardwareThreads);
+}
+
+
+/***********************************************************************************************//**
+ * Runs playouts until the budget is spent. This is the body of every search thread.
+ *
+ * @param[in] p_board The searched position, copied into a board private to the thread.
+ * @param[in] p_seed  The seed of the thread random playouts.
+ *
+ **************************************************************************************************/
+void MonteCarloSearch::work(const MultiPlayerBoard& p_board, std::uint64_t p_seed)
+{
+    MultiPlayerBoard          board{p_board};
+    std::mt19937_64           random{p_seed};
+    std::vector<int>          columns;
+    std::vector<std::int32_t> path;
+
+    columns.reserve(static_cast<std::size_t>(board.nbColumns()));
+    path.reserve(static_cast<std::size_t>(board.nbRows() * board.nbColumns()) + 1);
+
+    while(!isBudgetSpent())
+    {
+        playout(board, random, columns, path);
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Runs one playout: goes down the tree, possibly grows it, plays randomly until the end of the
+ * Game and backs up the result.
+ *
+ * @param[in,out] p_board   The thread board, restored before returning.
+ * @param[in,out] p_random  The thread random number generator.
+ * @param[out]    p_columns A buffer for the playable Columns.
+ * @param[out]    p_path    A buffer for the nodes gone through.
+ *
+ **************************************************************************************************/
+void MonteCarloSearch::playout(MultiPlayerBoard&          p_board,
+                               std::mt19937_64&           p_random,
+                               std::vector<int>&          p_columns,
+                               std::vector<std::int32_t>& p_path)
+{
+    int nbMoves{0};
+
+    p_path.clear();
+    p_path.push_back(0);
+
+    // Selection and expansion:
+    std::int32_t node{0};
+
+    while(!p_board.isWon() && !p_board.isFull())
+    {
+        Node& current{m_nodes[static_cast<std::size_t>(node)]};
+
+        if(current.m_firstChild.load(std::memory_order_acquire) < 0)
+        {
+            // A node is only expanded once a playout has gone through it:
+            if(current.m_visits.load(std::memory_order_relaxed) == 0 || !expand(node, p_board))
+            {
+                break;
+            }
+        }
+
+        node = select(node);
+
+        Node& child{m_nodes[static_cast<std::size_t>(node)]};
+
+        child.m_virtualLosses.fetch_add(1, std::memory_order_relaxed);
+        p_board.play(child.m_column);
+        ++nbMoves;
+        p_path.push_back(node);
+    }
+
+    // Random playout:
+    if(!p_board.isWon() && !p_board.isFull())
+    {
+        p_columns.clear();
+
+        for(int column{0}; column < p_board.nbColumns(); ++column)
+        {
+            if(p_board.canPlay(column))
+            {
+                p_columns.push_back(column);
+            }
+        }
+
+        while(!p_board.isWon() && !p_board.isFull())
+        {
+            const std::size_t index {static_cast<std::size_t>(p_random() % p_columns.size())};
+            const int         column{p_columns[index]};
+
+            p_board.play(column);
+            ++nbMoves;
+
+            if(!p_board.canPlay(column))
+            {
+                p_columns[index] = p_columns.back();
+                p_columns.pop_back();
+            }
+        }
+    }
+
+    // Backup:
+    const int winner{p_board.isWon() ? p_board.winner() : -1};
+
+    for(const std::int32_t visited : p_path)
+    {
+        Node& current{m_nodes[static_cast<std::size_t>(visited)]};
+
+        if(current.m_player >= 0)
+        {
+            const int reward{winner < 0 ? 1 : (current.m_player == winner ? m_nbPlayers : 0)};
+
+            current.m_rewards.fetch_add(static_cast<std::uint64_t>(reward), std::memory_order_relaxed);
+            current.m_virtualLosses.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        current.m_visits.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    for(int move{0}; move < nbMoves; ++move)
+    {
+        p_board.undo();
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Creates the children of a node, one for each playable Column. Only one thread may expand a
+ * given node: the others go on with a playout from the node.
+ *
+ * @param[in] p_node  The node.
+ * @param[in] p_board The position of the node.
+ *
+ * @return @c true if the node has children, @c false otherwise.
+ *
+ **************************************************************************************************/
+bool MonteCarloSearch::expand(std::int32_t p_node, const MultiPlayerBoard& p_board)
+{
+    Node& node{m_nodes[static_cast<std::size_t>(p_node)]};
+
+    std::int32_t expected{UNEXPANDED};
+
+    if(!node.m_firstChild.compare_exchange_strong(expected, EXPANDING, std::memory_order_acq_rel))
+    {
+        return expected >= 0;
+    }
+
+    std::int32_t nbChildren{0};
+
+    for(const int column : m_centreOrder)
+    {
+        if(p_board.canPlay(column))
+        {
+            ++nbChildren;
+        }
+    }
+
+    const std::size_t first{m_nbNodes.fetch_add(static_cast<std::size_t>(nbChildren), std::memory_order_relaxed)};
+
+    if(first + static_cast<std::size_t>(nbChildren) > m_maxNbNodes)
+    {
+        node.m_firstChild.store(LEAF, std::memory_order_release);
+
+        return false;
+    }
+
+    std::size_t child{first};
+
+    for(const int column : m_centreOrder)
+    {
+        if(p_board.canPlay(column))
+        {
+            Node& created{m_nodes[child++]};
+
+            created.m_rewards.store(0, std::memory_order_relaxed);
+            created.m_visits.store(0, std::memory_order_relaxed);
+            created.m_virtualLosses.store(0, std::memory_order_relaxed);
+            created.m_firstChild.store(UNEXPANDED, std::memory_order_relaxed);
+            created.m_nbChildren = 0;
+            created.m_column     = static_cast<std::int8_t>(column);
+            created.m_player     = static_cast<std::int8_t>(p_board.activePlayer());
+        }
+    }
+
+    node.m_nbChildren = nbChildren;
+    node.m_firstChild.store(static_cast<std::int32_t>(first), std::memory_order_release);
+
+    return true;
+}
+
+
+/***********************************************************************************************//**
+ * Chooses the child to go down, with the UCB1 formula. Playouts under way count as losses.
+ *
+ * @param[in] p_node An expanded node.
+ *
+ * @return The chosen child. Unvisited children come first, from the centre outwards.
+ *
+ **************************************************************************************************/
+std::int32_t MonteCarloSearch::select(std::int32_t p_node) const
+{
+    const Node& node{m_nodes[static_cast<std::size_t>(p_node)]};
+
+    const std::int32_t first{node.m_firstChild.load(std::memory_order_acquire)};
+    const double       logParentVisits{std::log(static_cast<double>(node.m_visits.load(std::memory_order_relaxed) +
+                                                                    node.m_virtualLosses.load(std::memory_order_relaxed) + 1u))};
+
+    std::int32_t best{first};
+    double       bestScore{-1.0};
+
+    for(std::int32_t index{first}; index < first + node.m_nbChildren; ++index)
+    {
+        const Node& child{m_nodes[static_cast<std::size_t>(index)]};
+
+        const std::uint32_t visits{child.m_visits.load(std::memory_order_relaxed) +
+                                   child.m_virtualLosses.load(std::memory_order_relaxed)};
+
+        if(visits == 0)
+        {
+            return index;
+        }
+
+        const double mean {static_cast<double>(child.m_rewards.load(std::memory_order_relaxed)) / (static_cast<double>(visits) * m_nbPlayers)};
+        const double score{mean + EXPLORATION * std::sqrt(logParentVisits / visits)};
+
+        if(score > bestScore)
+        {
+            best      = index;
+            bestScore = score;
+        }
+    }
+
+    return best;
+}
+
+
+/***********************************************************************************************//**
+ * Checks the budgets and, if one playout more is allowed, counts it.
+ *
+ * @return @c true if the search must stop.
+ *
+ **************************************************************************************************/
+bool MonteCarloSearch::isBudgetSpent()
+{
+    if(m_isBudgetSpent.load(std::memory_order_relaxed))
+    {
+        return true;
+    }
+
+    if(std::chrono::steady_clock::now() >= m_deadline ||
+       m_nbPlayouts.fetch_add(1, std::memory_order_relaxed) >= m_maxPlayouts)
+    {
+        m_isBudgetSpent.store(true, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    return false;
+}
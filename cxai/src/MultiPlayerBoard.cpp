@@ -0,0 +1,217 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    MultiPlayerBoard.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a search board supporting any number of Players.
+ *
+ **************************************************************************************************/
+
+#include <cxutil/include/narrow_cast.h>
+
+#include <cxbase/include/Zobrist.h>
+
+#include "../include/MultiPlayerBoard.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const int NOBODY{-1};
+
+} // unamed namespace
+
+
+MultiPlayerBoard::MultiPlayerBoard(const cxbase::Game& p_game): m_nbPlayers{p_game.nbPlayers()},
+                                                                m_activePlayer{p_game.activePlayerIndex()},
+                                                                m_winner{NOBODY},
+                                                                m_nbDiscs{0},
+                                                                m_hash{0}
+{
+    PRECONDITION(p_game.nbPlayers() <= maxNbPlayers());
+
+    const cxbase::GameBoard& gameboard{p_game.gameboard()};
+
+    m_lines = cxbase::WinningLines::forShape(gameboard.nbRows(), gameboard.nbColumns(), p_game.inARowValue());
+
+    for(int player{0}; player < m_nbPlayers; ++player)
+    {
+        m_playerKeys.push_back(cxbase::Zobrist::discKey(gameboard.palette().disc(p_game.discIdOf(player))));
+    }
+
+    m_heights.assign(cxutil::narrow_cast<std::size_t>(gameboard.nbColumns()), 0);
+
+    // The Game's weights, with vertical windows counted like the others:
+    m_windows = cxbase::LiveWindows{m_lines,
+                                    m_nbPlayers,
+                                    std::make_shared<const cxbase::EvaluationWeights>(p_game.evaluationWeights()),
+                                    true};
+
+    // Copy the Game position:
+    for(int column{0}; column < nbColumns(); ++column)
+    {
+        for(int row{0}; row < nbRows(); ++row)
+        {
+            const cxbase::DiscId discId{gameboard.discId(cxbase::Position{cxbase::Row{row}, cxbase::Column{column}})};
+
+            if(discId == cxbase::DiscPalette::noDiscId())
+            {
+                break;
+            }
+
+            int player{0};
+
+            while(player < m_nbPlayers && p_game.discIdOf(player) != discId)
+            {
+                ++player;
+            }
+
+            ASSERTION(player < m_nbPlayers);
+
+            addDisc(row, column, player);
+        }
+    }
+
+    m_hash ^= cxbase::Zobrist::turnKey(m_activePlayer);
+
+    INVARIANTS();
+}
+
+
+int MultiPlayerBoard::winner() const
+{
+    PRECONDITION(isWon());
+
+    return m_winner;
+}
+
+
+bool MultiPlayerBoard::canPlay(int p_column) const
+{
+    PRECONDITION(p_column >= 0);
+    PRECONDITION(p_column < nbColumns());
+
+    return m_heights[cxutil::narrow_cast<std::size_t>(p_column)] < nbRows();
+}
+
+
+std::int64_t MultiPlayerBoard::score(int p_player) const
+{
+    PRECONDITION(p_player >= 0);
+    PRECONDITION(p_player < m_nbPlayers);
+
+    return m_windows.score(p_player);
+}
+
+
+void MultiPlayerBoard::play(int p_column)
+{
+    play(p_column, m_activePlayer, (m_activePlayer + 1) % m_nbPlayers);
+}
+
+
+void MultiPlayerBoard::play(int p_column, int p_player, int p_nextPlayer)
+{
+    PRECONDITION(canPlay(p_column));
+    PRECONDITION(p_player >= 0 && p_player < m_nbPlayers);
+    PRECONDITION(p_nextPlayer >= 0 && p_nextPlayer < m_nbPlayers);
+
+    m_moves.push_back(Move{p_column, p_player, m_activePlayer, m_winner});
+
+    addDisc(m_heights[cxutil::narrow_cast<std::size_t>(p_column)], p_column, p_player);
+
+    m_hash ^= cxbase::Zobrist::turnKey(m_activePlayer) ^ cxbase::Zobrist::turnKey(p_nextPlayer);
+    m_activePlayer = p_nextPlayer;
+}
+
+
+void MultiPlayerBoard::undo()
+{
+    PRECONDITION(!m_moves.empty());
+
+    const Move move{m_moves.back()};
+    m_moves.pop_back();
+
+    removeDisc(m_heights[cxutil::narrow_cast<std::size_t>(move.m_column)] - 1, move.m_column, move.m_player);
+
+    m_hash ^= cxbase::Zobrist::turnKey(m_activePlayer) ^ cxbase::Zobrist::turnKey(move.m_activePlayer);
+    m_activePlayer = move.m_activePlayer;
+    m_winner       = move.m_winner;
+}
+
+
+/***********************************************************************************************//**
+ * Adds a Disc on top of a Column and updates every window containing it.
+ *
+ * @param[in] p_row     The Row where the Disc lands.
+ * @param[in] p_column  The Column.
+ * @param[in] p_player  The index of the Player owning the Disc.
+ *
+ **************************************************************************************************/
+void MultiPlayerBoard::addDisc(int p_row, int p_column, int p_player)
+{
+    ++m_heights[static_cast<std::size_t>(p_column)];
+    ++m_nbDiscs;
+    m_hash ^= cxbase::Zobrist::positionKey(p_row, p_column, m_playerKeys[static_cast<std::size_t>(p_player)]);
+
+    m_windows.addDisc(cxbase::Position{cxbase::Row{p_row}, cxbase::Column{p_column}}, p_player);
+
+    // Nobody had a full window before this Disc, so a full window now is the Player's:
+    if(m_winner == NOBODY && m_windows.nbLiveWindows(p_player, 0) > 0)
+    {
+        m_winner = p_player;
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Removes the Disc on top of a Column and updates every window containing it.
+ *
+ * @param[in] p_row     The Row of the Disc.
+ * @param[in] p_column  The Column.
+ * @param[in] p_player  The index of the Player owning the Disc.
+ *
+ **************************************************************************************************/
+void MultiPlayerBoard::removeDisc(int p_row, int p_column, int p_player)
+{
+    --m_heights[static_cast<std::size_t>(p_column)];
+    --m_nbDiscs;
+    m_hash ^= cxbase::Zobrist::positionKey(p_row, p_column, m_playerKeys[static_cast<std::size_t>(p_player)]);
+
+    m_windows.removeDisc(cxbase::Position{cxbase::Row{p_row}, cxbase::Column{p_column}}, p_player);
+}
+
+
+void MultiPlayerBoard::checkInvariant() const
+{
+    INVARIANT(m_nbPlayers >= 2);
+    INVARIANT(m_nbPlayers <= maxNbPlayers());
+}
@@ -0,0 +1,683 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    MultiPlayerSearch.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a search engine for Games with any number of Players.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+
+#include <cxutil/include/ContractException.h>
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/MultiPlayerSearch.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::uint64_t NODES_BETWEEN_CLOCK_CHECKS{1024};
+
+// Table keys are salted so that values searched for different modes or Players never mix:
+const std::uint64_t MODE_SALT  {0x9E3779B97F4A7C15ull};
+const std::uint64_t PLAYER_SALT{0xC2B2AE3D27D4EB4Full};
+
+} // unamed namespace
+
+
+MultiPlayerSearch::MultiPlayerSearch(Mode p_mode, std::size_t p_tableSizeInMiB): m_mode{p_mode},
+                                                                                 m_table{p_tableSizeInMiB},
+                                                                                 m_salt{0},
+                                                                                 m_rootPlayer{0},
+                                                                                 m_nbNodes{0},
+                                                                                 m_canStop{false},
+                                                                                 m_isTimeUp{false}
+{
+}
+
+
+MultiPlayerSearch::Result MultiPlayerSearch::search(const cxbase::Game& p_game, std::chrono::milliseconds p_budget, int p_maxDepth)
+{
+    PRECONDITION(!p_game.isWon());
+    PRECONDITION(!p_game.isDraw());
+
+    MultiPlayerBoard board{p_game};
+
+    return search(board, p_budget, p_maxDepth);
+}
+
+
+MultiPlayerSearch::Result MultiPlayerSearch::search(MultiPlayerBoard& p_board, std::chrono::milliseconds p_budget, int p_maxDepth)
+{
+    PRECONDITION(!p_board.isWon());
+    PRECONDITION(!p_board.isFull());
+    PRECONDITION(p_maxDepth > 0);
+
+    m_deadline   = std::chrono::steady_clock::now() + p_budget;
+    m_canStop    = false;
+    m_isTimeUp   = false;
+    m_nbNodes    = 0;
+    m_rootPlayer = p_board.activePlayer();
+    m_salt       = static_cast<std::uint64_t>(static_cast<int>(m_mode) + 1) * MODE_SALT ^
+                   static_cast<std::uint64_t>(m_rootPlayer + 1) * PLAYER_SALT;
+
+    m_table.newSearch();
+
+    const int nbColumns{p_board.nbColumns()};
+
+    m_centreOrder.clear();
+
+    for(int i{0}; i < nbColumns; ++i)
+    {
+        m_centreOrder.push_back(nbColumns / 2 + (1 - 2 * (i % 2)) * (i + 1) / 2);
+    }
+
+    const int maxDepth{std::min(p_maxDepth, p_board.nbRows() * nbColumns - p_board.nbDiscs())};
+
+    m_moveLists.resize(static_cast<std::size_t>(maxDepth) + 1);
+
+    Result result{-1, 0, 0, 0};
+
+    // An immediately winning move needs no search:
+    for(const int column : m_centreOrder)
+    {
+        if(p_board.canPlay(column))
+        {
+            p_board.play(column);
+            const bool isWinning{p_board.isWon()};
+            p_board.undo();
+
+            if(isWinning)
+            {
+                result.m_column  = column;
+                result.m_depth   = 1;
+                result.m_value   = maxSum();
+                result.m_nbNodes = static_cast<std::uint64_t>(nbColumns);
+
+                return result;
+            }
+
+            if(result.m_column < 0)
+            {
+                result.m_column = column;
+            }
+        }
+    }
+
+    for(int depth{1}; depth <= maxDepth; ++depth)
+    {
+        if(!searchRoot(p_board, depth, result))
+        {
+            break;
+        }
+
+        m_canStop = true;
+
+        if(result.m_value >= maxSum() || std::chrono::steady_clock::now() >= m_deadline)
+        {
+            break;
+        }
+    }
+
+    result.m_nbNodes = m_nbNodes;
+
+    return result;
+}
+
+
+void MultiPlayerSearch::clearTable()
+{
+    m_table.clear();
+}
+
+
+/***********************************************************************************************//**
+ * Checks the clock every few nodes.
+ *
+ * @return @c true if the search must be abandoned.
+ *
+ **************************************************************************************************/
+bool MultiPlayerSearch::isTimeUp()
+{
+    ++m_nbNodes;
+
+    if(m_canStop && m_nbNodes % NODES_BETWEEN_CLOCK_CHECKS == 0 && std::chrono::steady_clock::now() >= m_deadline)
+    {
+        m_isTimeUp = true;
+    }
+
+    return m_isTimeUp;
+}
+
+
+/***********************************************************************************************//**
+ * Lists the Columns in the order they should be tried.
+ *
+ * @param[in]  p_bestColumn The best Column known for the position, or -1.
+ * @param[out] p_columns    The Columns: the best known first, then from the centre outwards.
+ *
+ **************************************************************************************************/
+void MultiPlayerSearch::order(int p_bestColumn, std::vector<int>& p_columns) const
+{
+    p_columns.clear();
+
+    if(p_bestColumn >= 0)
+    {
+        p_columns.push_back(p_bestColumn);
+    }
+
+    for(const int column : m_centreOrder)
+    {
+        if(column != p_bestColumn)
+        {
+            p_columns.push_back(column);
+        }
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Shares @c maxSum() between the Players, in proportion to their heuristic scores.
+ *
+ * @param[in]  p_board  The position, neither won nor full.
+ * @param[out] p_values The value of each Player.
+ *
+ **************************************************************************************************/
+void MultiPlayerSearch::evaluate(const MultiPlayerBoard& p_board, Values& p_values) const
+{
+    double total{0.0};
+
+    for(int player{0}; player < p_board.nbPlayers(); ++player)
+    {
+        total += static_cast<double>(p_board.score(player) + 1);
+    }
+
+    for(int player{0}; player < p_board.nbPlayers(); ++player)
+    {
+        const double share{static_cast<double>(p_board.score(player) + 1) / total};
+
+        p_values[static_cast<std::size_t>(player)] = static_cast<int>(share * maxSum());
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Evaluates a position for the searching Player.
+ *
+ * @param[in] p_board The position, neither won nor full.
+ *
+ * @return The share of @c maxSum() of the searching Player.
+ *
+ **************************************************************************************************/
+int MultiPlayerSearch::rootValue(const MultiPlayerBoard& p_board) const
+{
+    Values values;
+    evaluate(p_board, values);
+
+    return values[static_cast<std::size_t>(m_rootPlayer)];
+}
+
+
+/***********************************************************************************************//**
+ * Values a won or full position for the searching Player, in the paranoid and best-reply modes.
+ * Earlier wins and later losses are preferred.
+ *
+ * @param[in] p_board The position, won or full.
+ * @param[in] p_depth The remaining search depth.
+ *
+ * @return The value of the position for the searching Player.
+ *
+ **************************************************************************************************/
+int MultiPlayerSearch::terminalValue(const MultiPlayerBoard& p_board, int p_depth) const
+{
+    if(!p_board.isWon())
+    {
+        return maxSum() / p_board.nbPlayers();
+    }
+
+    return p_board.winner() == m_rootPlayer ? maxSum() + p_depth : -p_depth;
+}
+
+
+/***********************************************************************************************//**
+ * Stores a search result in the SharedTranspositionTable.
+ *
+ * @param[in] p_key    The salted position key.
+ * @param[in] p_depth  The depth searched.
+ * @param[in] p_value  The value found.
+ * @param[in] p_bound  The kind of value found.
+ * @param[in] p_column The best Column found.
+ *
+ **************************************************************************************************/
+void MultiPlayerSearch::store(std::uint64_t p_key, int p_depth, int p_value, Bound p_bound, int p_column)
+{
+    m_table.store(p_key, SharedTranspositionTable::Entry{p_value, std::min(p_depth, 127), p_bound, p_column});
+}
+
+
+/***********************************************************************************************//**
+ * Max-n search with shallow pruning.
+ *
+ * @param[in]  p_board      The position.
+ * @param[in]  p_depth      The remaining depth.
+ * @param[in]  p_parentBest The value already secured by the Player who moved into this position.
+ * @param[out] p_values     The value of the position for each Player.
+ *
+ **************************************************************************************************/
+void MultiPlayerSearch::maxN(MultiPlayerBoard& p_board, int p_depth, int p_parentBest, Values& p_values)
+{
+    if(isTimeUp())
+    {
+        return;
+    }
+
+    const int nbPlayers{p_board.nbPlayers()};
+
+    if(p_board.isWon())
+    {
+        p_values.fill(0);
+        p_values[static_cast<std::size_t>(p_board.winner())] = maxSum();
+
+        return;
+    }
+
+    if(p_board.isFull())
+    {
+        p_values.fill(maxSum() / nbPlayers);
+
+        return;
+    }
+
+    if(p_depth == 0)
+    {
+        evaluate(p_board, p_values);
+
+        return;
+    }
+
+    const std::uint64_t key{p_board.hash() ^ m_salt};
+    SharedTranspositionTable::Entry known;
+
+    std::vector<int>& columns{m_moveLists[static_cast<std::size_t>(p_depth)]};
+    order(m_table.probe(key, known) ? known.m_move : -1, columns);
+
+    const std::size_t player{static_cast<std::size_t>(p_board.activePlayer())};
+
+    int    bestColumn{-1};
+    Values childValues;
+
+    for(const int column : columns)
+    {
+        if(!p_board.canPlay(column))
+        {
+            continue;
+        }
+
+        p_board.play(column);
+        maxN(p_board, p_depth - 1, bestColumn < 0 ? 0 : p_values[player], childValues);
+        p_board.undo();
+
+        if(m_isTimeUp)
+        {
+            return;
+        }
+
+        if(bestColumn < 0 || childValues[player] > p_values[player])
+        {
+            bestColumn = column;
+            p_values   = childValues;
+
+            // Shallow pruning: the parent cannot get more than what is left:
+            if(p_values[player] >= maxSum() - p_parentBest)
+            {
+                break;
+            }
+        }
+    }
+
+    store(key, p_depth, 0, Bound::None, bestColumn);
+}
+
+
+/***********************************************************************************************//**
+ * Paranoid search, with alpha-beta pruning.
+ *
+ * @param[in] p_board The position.
+ * @param[in] p_depth The remaining depth.
+ * @param[in] p_alpha The value the searching Player is already sure to get.
+ * @param[in] p_beta  The value the opponents are already sure to hold the searching Player to.
+ *
+ * @return The value of the position for the searching Player.
+ *
+ **************************************************************************************************/
+int MultiPlayerSearch::paranoid(MultiPlayerBoard& p_board, int p_depth, int p_alpha, int p_beta)
+{
+    if(isTimeUp())
+    {
+        return 0;
+    }
+
+    if(p_board.isWon() || p_board.isFull())
+    {
+        return terminalValue(p_board, p_depth);
+    }
+
+    if(p_depth == 0)
+    {
+        return rootValue(p_board);
+    }
+
+    const std::uint64_t key{p_board.hash() ^ m_salt};
+    SharedTranspositionTable::Entry known;
+    int                             hint{-1};
+
+    if(m_table.probe(key, known))
+    {
+        hint = known.m_move;
+
+        if(known.m_depth >= p_depth)
+        {
+            if(known.m_bound == Bound::Exact)
+            {
+                return known.m_value;
+            }
+
+            if(known.m_bound == Bound::Lower)
+            {
+                p_alpha = std::max(p_alpha, known.m_value);
+            }
+            else if(known.m_bound == Bound::Upper)
+            {
+                p_beta = std::min(p_beta, known.m_value);
+            }
+
+            if(p_alpha >= p_beta)
+            {
+                return known.m_value;
+            }
+        }
+    }
+
+    std::vector<int>& columns{m_moveLists[static_cast<std::size_t>(p_depth)]};
+    order(hint, columns);
+
+    const bool isMaximizing{p_board.activePlayer() == m_rootPlayer};
+    const int  alpha{p_alpha};
+    const int  beta {p_beta};
+
+    int bestColumn{-1};
+    int bestValue {0};
+
+    for(const int column : columns)
+    {
+        if(!p_board.canPlay(column))
+        {
+            continue;
+        }
+
+        p_board.play(column);
+        const int value{paranoid(p_board, p_depth - 1, p_alpha, p_beta)};
+        p_board.undo();
+
+        if(m_isTimeUp)
+        {
+            return 0;
+        }
+
+        if(bestColumn < 0 || (isMaximizing ? value > bestValue : value < bestValue))
+        {
+            bestColumn = column;
+            bestValue  = value;
+        }
+
+        if(isMaximizing)
+        {
+            p_alpha = std::max(p_alpha, value);
+        }
+        else
+        {
+            p_beta = std::min(p_beta, value);
+        }
+
+        if(p_alpha >= p_beta)
+        {
+            break;
+        }
+    }
+
+    const Bound bound{bestValue <= alpha ? Bound::Upper : (bestValue >= beta ? Bound::Lower : Bound::Exact)};
+    store(key, p_depth, bestValue, bound, bestColumn);
+
+    return bestValue;
+}
+
+
+/***********************************************************************************************//**
+ * Best-reply search, with alpha-beta pruning. Between two moves of the searching Player, every
+ * move of every opponent is tried, but only the strongest is kept.
+ *
+ * @param[in] p_board      The position.
+ * @param[in] p_depth      The remaining depth.
+ * @param[in] p_alpha      The value the searching Player is already sure to get.
+ * @param[in] p_beta       The value the opponents are already sure to hold the searching Player
+ *                         to.
+ * @param[in] p_isRootTurn @c true if the searching Player moves, @c false if the opponents do.
+ *
+ * @return The value of the position for the searching Player.
+ *
+ **************************************************************************************************/
+int MultiPlayerSearch::bestReply(MultiPlayerBoard& p_board, int p_depth, int p_alpha, int p_beta, bool p_isRootTurn)
+{
+    if(isTimeUp())
+    {
+        return 0;
+    }
+
+    if(p_board.isWon() || p_board.isFull())
+    {
+        return terminalValue(p_board, p_depth);
+    }
+
+    if(p_depth == 0)
+    {
+        return rootValue(p_board);
+    }
+
+    const std::uint64_t key{p_board.hash() ^ m_salt};
+    SharedTranspositionTable::Entry known;
+    int                             hint{-1};
+
+    if(m_table.probe(key, known))
+    {
+        hint = known.m_move;
+
+        if(known.m_depth >= p_depth)
+        {
+            if(known.m_bound == Bound::Exact)
+            {
+                return known.m_value;
+            }
+
+            if(known.m_bound == Bound::Lower)
+            {
+                p_alpha = std::max(p_alpha, known.m_value);
+            }
+            else if(known.m_bound == Bound::Upper)
+            {
+                p_beta = std::min(p_beta, known.m_value);
+            }
+
+            if(p_alpha >= p_beta)
+            {
+                return known.m_value;
+            }
+        }
+    }
+
+    std::vector<int>& columns{m_moveLists[static_cast<std::size_t>(p_depth)]};
+    order(hint, columns);
+
+    const int alpha{p_alpha};
+    const int beta {p_beta};
+    const int nextOpponent{(m_rootPlayer + 1) % p_board.nbPlayers()};
+
+    int bestColumn{-1};
+    int bestValue {0};
+
+    for(int player{0}; player < p_board.nbPlayers() && p_alpha < p_beta; ++player)
+    {
+        // The searching Player moves alone, any opponent may answer:
+        if(p_isRootTurn != (player == m_rootPlayer))
+        {
+            continue;
+        }
+
+        for(const int column : columns)
+        {
+            if(!p_board.canPlay(column))
+            {
+                continue;
+            }
+
+            p_board.play(column, player, p_isRootTurn ? nextOpponent : m_rootPlayer);
+            const int value{bestReply(p_board, p_depth - 1, p_alpha, p_beta, !p_isRootTurn)};
+            p_board.undo();
+
+            if(m_isTimeUp)
+            {
+                return 0;
+            }
+
+            if(bestColumn < 0 || (p_isRootTurn ? value > bestValue : value < bestValue))
+            {
+                bestColumn = column;
+                bestValue  = value;
+            }
+
+            if(p_isRootTurn)
+            {
+                p_alpha = std::max(p_alpha, value);
+            }
+            else
+            {
+                p_beta = std::min(p_beta, value);
+            }
+
+            if(p_alpha >= p_beta)
+            {
+                break;
+            }
+        }
+    }
+
+    const Bound bound{bestValue <= alpha ? Bound::Upper : (bestValue >= beta ? Bound::Lower : Bound::Exact)};
+    store(key, p_depth, bestValue, bound, bestColumn);
+
+    return bestValue;
+}
+
+
+/***********************************************************************************************//**
+ * Searches every move of the searching Player to a fixed depth.
+ *
+ * @param[in]  p_board  The position.
+ * @param[in]  p_depth  The depth, in moves.
+ * @param[out] p_result Updated with the best move, if the search completes.
+ *
+ * @return @c false if the time ran out before the search completed.
+ *
+ **************************************************************************************************/
+bool MultiPlayerSearch::searchRoot(MultiPlayerBoard& p_board, int p_depth, Result& p_result)
+{
+    std::vector<int> columns;
+    order(p_result.m_column, columns);
+
+    int bestColumn{-1};
+    int bestValue {0};
+
+    for(const int column : columns)
+    {
+        if(!p_board.canPlay(column))
+        {
+            continue;
+        }
+
+        int value{0};
+
+        if(m_mode == Mode::MaxN)
+        {
+            Values values;
+
+            p_board.play(column);
+            maxN(p_board, p_depth - 1, bestColumn < 0 ? 0 : bestValue, values);
+            p_board.undo();
+
+            value = values[static_cast<std::size_t>(m_rootPlayer)];
+        }
+        else
+        {
+            const int alpha{bestColumn < 0 ? -p_depth - 1 : bestValue};
+            const int beta {maxSum() + p_depth + 1};
+
+            if(m_mode == Mode::Paranoid)
+            {
+                p_board.play(column);
+                value = paranoid(p_board, p_depth - 1, alpha, beta);
+            }
+            else
+            {
+                p_board.play(column, m_rootPlayer, (m_rootPlayer + 1) % p_board.nbPlayers());
+                value = bestReply(p_board, p_depth - 1, alpha, beta, false);
+            }
+
+            p_board.undo();
+        }
+
+        if(m_isTimeUp)
+        {
+            return false;
+        }
+
+        if(bestColumn < 0 || value > bestValue)
+        {
+            bestColumn = column;
+            bestValue  = value;
+        }
+    }
+
+    p_result.m_column = bestColumn;
+    p_result.m_depth  = p_depth;
+    p_result.m_value  = std::min(bestValue, maxSum());
+
+    return true;
+}
@@ -0,0 +1,145 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    OpeningBook.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a memory-mapped opening book.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include "../include/OpeningBook.h"
+
+
+using namespace cxai;
+
+
+cxutil::ReturnCode OpeningBook::open(const std::string& p_path)
+{
+    close();
+
+    cxutil::ReturnCode status{m_file.open(p_path)};
+
+    if(!status.isOk())
+    {
+        return status;
+    }
+
+    const std::size_t headerSize{sizeof(Header)};
+
+    if(m_file.size() < headerSize)
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is too small to be an opening book."};
+    }
+
+    const Header* header{reinterpret_cast<const Header*>(m_file.data())};
+
+    if(std::memcmp(header->m_magic, magic(), sizeof(header->m_magic)) != 0 || header->m_version != version())
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is not a supported opening book."};
+    }
+
+    // The entry count is checked against the file size, never multiplied, since it may be
+    // anything in a corrupted file:
+    const std::size_t entriesSize{m_file.size() - headerSize};
+
+    if(entriesSize % sizeof(Entry) != 0 || header->m_nbEntries != entriesSize / sizeof(Entry))
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is truncated."};
+    }
+
+    m_header  = header;
+    m_entries = reinterpret_cast<const Entry*>(m_file.data() + headerSize);
+
+    return cxutil::ReturnCode{};
+}
+
+
+void OpeningBook::close()
+{
+    m_header  = nullptr;
+    m_entries = nullptr;
+
+    m_file.close();
+}
+
+
+bool OpeningBook::lookup(const BitBoard& p_board, Solver::Result& p_result) const
+{
+    if(!isOpen()                          ||
+       p_board.nbMoves()   >  maxNbMoves() ||
+       p_board.nbRows()    != nbRows()     ||
+       p_board.nbColumns() != nbColumns()  ||
+       p_board.inARow()    != inARow())
+    {
+        return false;
+    }
+
+    const std::uint64_t key{p_board.symmetricKey()};
+    const Entry*        end{m_entries + size()};
+
+    const Entry* entry{std::lower_bound(m_entries, end, key, [](const Entry& p_entry, std::uint64_t p_key)
+                                                             {
+                                                                 return p_entry.m_key < p_key;
+                                                             })};
+
+    if(entry == end || entry->m_key != key)
+    {
+        return false;
+    }
+
+    // The Column is stored as seen from the position with the smallest key:
+    const int column{entry->m_column};
+
+    p_result.m_column = key == p_board.key() ? column : p_board.nbColumns() - 1 - column;
+    p_result.m_score  = entry->m_score;
+
+    return true;
+}
+
+
+bool OpeningBook::lookup(const cxbase::Game& p_game, Solver::Result& p_result) const
+{
+    if(!isOpen()                                 ||
+       p_game.nbPlayers()             != 2         ||
+       p_game.gameboard().nbRows()    != nbRows()  ||
+       p_game.gameboard().nbColumns() != nbColumns())
+    {
+        return false;
+    }
+
+    return lookup(BitBoard::fromGame(p_game), p_result);
+}
@@ -0,0 +1,208 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    OpeningBookBuilder.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for an opening book builder.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <thread>
+
+#include <cxutil/include/ContractException.h>
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/OpeningBookBuilder.h"
+
+
+using namespace cxai;
+
+
+OpeningBookBuilder::OpeningBookBuilder(int p_nbRows, int p_nbColumns, int p_inARow, int p_maxNbMoves)
+ : m_empty{p_nbRows, p_nbColumns, p_inARow}
+ , m_maxNbMoves{p_maxNbMoves}
+ , m_next{0}
+ , m_isBuilt{false}
+{
+    PRECONDITION(p_maxNbMoves >= 0);
+    PRECONDITION(p_maxNbMoves < m_empty.nbPositions());
+
+    std::unordered_set<std::uint64_t> visited;
+
+    enumerate(m_empty, visited);
+
+    // Sort the entries by key, keeping each position next to its entry:
+    std::vector<std::size_t> order(m_entries.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+
+    std::sort(order.begin(), order.end(), [this](std::size_t p_lhs, std::size_t p_rhs)
+                                          {
+                                              return m_entries[p_lhs].m_key < m_entries[p_rhs].m_key;
+                                          });
+
+    std::vector<OpeningBook::Entry> entries;
+    std::vector<BitBoard>           positions;
+
+    entries.reserve(order.size());
+    positions.reserve(order.size());
+
+    for(const std::size_t index : order)
+    {
+        entries.push_back(m_entries[index]);
+        positions.push_back(m_positions[index]);
+    }
+
+    m_entries.swap(entries);
+    m_positions.swap(positions);
+}
+
+
+void OpeningBookBuilder::build(int p_nbThreads, std::size_t p_nbTableEntries)
+{
+    PRECONDITION(p_nbThreads > 0);
+
+    m_next.store(0);
+
+    std::vector<std::thread> helpers;
+
+    for(int thread{1}; thread < p_nbThreads; ++thread)
+    {
+        helpers.emplace_back(&OpeningBookBuilder::solve, this, p_nbTableEntries);
+    }
+
+    solve(p_nbTableEntries);
+
+    for(std::thread& helper : helpers)
+    {
+        helper.join();
+    }
+
+    m_isBuilt = true;
+}
+
+
+cxutil::ReturnCode OpeningBookBuilder::write(const std::string& p_path) const
+{
+    PRECONDITION(m_isBuilt);
+
+    OpeningBook::Header header;
+
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.m_magic, OpeningBook::magic(), sizeof(header.m_magic));
+
+    header.m_version    = OpeningBook::version();
+    header.m_nbRows     = cxutil::narrow_cast<std::uint8_t>(m_empty.nbRows());
+    header.m_nbColumns  = cxutil::narrow_cast<std::uint8_t>(m_empty.nbColumns());
+    header.m_inARow     = cxutil::narrow_cast<std::uint8_t>(m_empty.inARow());
+    header.m_maxNbMoves = cxutil::narrow_cast<std::uint8_t>(m_maxNbMoves);
+    header.m_nbEntries  = m_entries.size();
+
+    std::ofstream file{p_path, std::ios::binary | std::ios::trunc};
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_entries.data()), static_cast<std::streamsize>(m_entries.size() * sizeof(OpeningBook::Entry)));
+    file.close();
+
+    if(!file)
+    {
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, "Unable to write " + p_path + "."};
+    }
+
+    return cxutil::ReturnCode{};
+}
+
+
+/***********************************************************************************************//**
+ * Adds a position, and the positions following it, to the book. A position already added, or
+ * whose mirror image was, is skipped with its whole subtree.
+ *
+ * @param[in]     p_board   The position.
+ * @param[in,out] p_visited The symmetric keys of the positions already added. Keys are unique
+ *                          for the whole board shape, so a single set covers every depth.
+ *
+ **************************************************************************************************/
+void OpeningBookBuilder::enumerate(const BitBoard& p_board, std::unordered_set<std::uint64_t>& p_visited)
+{
+    if(p_board.canWinNext() || !p_visited.insert(p_board.symmetricKey()).second)
+    {
+        return;
+    }
+
+    OpeningBook::Entry entry;
+
+    std::memset(&entry, 0, sizeof(entry));
+    entry.m_key = p_board.symmetricKey();
+
+    m_entries.push_back(entry);
+    m_positions.push_back(p_board);
+
+    if(p_board.nbMoves() == m_maxNbMoves)
+    {
+        return;
+    }
+
+    for(int column{0}; column < p_board.nbColumns(); ++column)
+    {
+        if(p_board.canPlay(column))
+        {
+            BitBoard next{p_board};
+            next.play(column);
+
+            enumerate(next, p_visited);
+        }
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Body of a build thread: solves the next unsolved position until there is none left.
+ *
+ * @param[in] p_nbTableEntries The number of TranspositionTable entries of the thread's Solver.
+ *
+ **************************************************************************************************/
+void OpeningBookBuilder::solve(std::size_t p_nbTableEntries)
+{
+    Solver solver{p_nbTableEntries};
+
+    for(std::size_t index{m_next++}; index < m_entries.size(); index = m_next++)
+    {
+        const BitBoard&      board {m_positions[index]};
+        const Solver::Result result{solver.analyze(board)};
+
+        // The Column is stored as seen from the position with the smallest key:
+        const int column{board.key() == m_entries[index].m_key ? result.m_column
+                                                               : board.nbColumns() - 1 - result.m_column};
+
+        m_entries[index].m_score  = cxutil::narrow_cast<std::int8_t>(result.m_score);
+        m_entries[index].m_column = cxutil::narrow_cast<std::uint8_t>(column);
+    }
+}
@@ -0,0 +1,351 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    SharedTranspositionTable.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a transposition table shared by many search threads.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <new>
+
+#include <cxutil/include/ContractException.h>
+
+#include "../include/SharedTranspositionTable.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+// Layout of a packed entry:
+//
+//   bits  0 to 31 : the value, as an unsigned integer.
+//   bits 32 to 39 : the depth.
+//   bits 40 to 47 : the move plus one (1), so that no move is zero (0).
+//   bits 48 to 49 : the bound.
+//   bits 50 to 55 : the search number (generation) modulo 64.
+//   bit  63       : set for every stored entry, so that a used entry is never zero (0).
+//
+const int           DEPTH_SHIFT     {32};
+const int           MOVE_SHIFT      {40};
+const int           BOUND_SHIFT     {48};
+const int           GENERATION_SHIFT{50};
+const std::uint64_t USED_BIT        {std::uint64_t{1} << 63};
+const std::uint8_t  GENERATION_MASK {63};
+
+const int           MAX_DEPTH       {127};
+const int           AGE_PENALTY     {8};    // Depth lost by an entry for each search it is old.
+const std::size_t   FILL_SAMPLE     {1000}; // Number of buckets sampled by fillRate().
+
+std::uint64_t pack(const SharedTranspositionTable::Entry& p_entry, std::uint8_t p_generation)
+{
+    return static_cast<std::uint64_t>(static_cast<std::uint32_t>(p_entry.m_value))           |
+           static_cast<std::uint64_t>(p_entry.m_depth)                    << DEPTH_SHIFT      |
+           static_cast<std::uint64_t>(p_entry.m_move + 1)                 << MOVE_SHIFT       |
+           static_cast<std::uint64_t>(p_entry.m_bound)                    << BOUND_SHIFT      |
+           static_cast<std::uint64_t>(p_generation)                       << GENERATION_SHIFT |
+           USED_BIT;
+}
+
+int depthOf(std::uint64_t p_data)
+{
+    return static_cast<int>((p_data >> DEPTH_SHIFT) & 0xFF);
+}
+
+int moveOf(std::uint64_t p_data)
+{
+    return static_cast<int>((p_data >> MOVE_SHIFT) & 0xFF) - 1;
+}
+
+SharedTranspositionTable::Entry unpack(std::uint64_t p_data)
+{
+    return SharedTranspositionTable::Entry{static_cast<std::int32_t>(static_cast<std::uint32_t>(p_data)),
+                                           depthOf(p_data),
+                                           static_cast<SharedTranspositionTable::Bound>((p_data >> BOUND_SHIFT) & 0x3),
+                                           moveOf(p_data)};
+}
+
+// Only one thread increments a counter, unless there are more threads than counter slots, so
+// the increment needs no read-modify-write instruction:
+void increment(std::atomic<std::uint64_t>& p_counter)
+{
+    p_counter.store(p_counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+// Threads are numbered in the order they first use a table:
+std::size_t threadNumber()
+{
+    static std::atomic<std::size_t> s_nbThreads{0};
+    thread_local const std::size_t  t_number{s_nbThreads.fetch_add(1)};
+
+    return t_number;
+}
+
+} // unamed namespace
+
+
+const std::size_t SharedTranspositionTable::NB_SLOTS;
+const std::size_t SharedTranspositionTable::CACHE_LINE_SIZE;
+const std::size_t SharedTranspositionTable::NB_COUNTER_SLOTS;
+
+
+SharedTranspositionTable::SharedTranspositionTable(std::size_t p_sizeInMiB): m_buckets{nullptr},
+                                                                             m_counters{nullptr},
+                                                                             m_mask{0},
+                                                                             m_generation{0}
+{
+    PRECONDITION(p_sizeInMiB > 0);
+
+    const std::size_t maxNbBuckets{p_sizeInMiB * (std::size_t{1} << 20) / sizeof(Bucket)};
+
+    std::size_t nbBuckets{1};
+
+    while(nbBuckets * 2 <= maxNbBuckets)
+    {
+        nbBuckets *= 2;
+    }
+
+    m_mask = nbBuckets - 1;
+
+    // Buckets must start on a cache line boundary, and so do the counters which follow them:
+    m_memory.reset(new unsigned char[nbBuckets * sizeof(Bucket) + NB_COUNTER_SLOTS * sizeof(Counters) + CACHE_LINE_SIZE]);
+
+    const std::uintptr_t address{reinterpret_cast<std::uintptr_t>(m_memory.get())};
+    const std::uintptr_t aligned{(address + CACHE_LINE_SIZE - 1) & ~static_cast<std::uintptr_t>(CACHE_LINE_SIZE - 1)};
+
+    m_buckets = reinterpret_cast<Bucket*>(aligned);
+
+    for(std::size_t bucket{0}; bucket < nbBuckets; ++bucket)
+    {
+        new (&m_buckets[bucket]) Bucket;
+    }
+
+    m_counters = reinterpret_cast<Counters*>(m_buckets + nbBuckets);
+
+    for(std::size_t slot{0}; slot < NB_COUNTER_SLOTS; ++slot)
+    {
+        new (&m_counters[slot]) Counters;
+    }
+
+    clear();
+    resetStatistics();
+}
+
+
+bool SharedTranspositionTable::probe(std::uint64_t p_key, Entry& p_entry) const
+{
+    Counters& counters{this->counters()};
+
+    increment(counters.m_nbProbes);
+
+    const Bucket& bucket{m_buckets[p_key & m_mask]};
+
+    for(const Slot& slot : bucket.m_slots)
+    {
+        const std::uint64_t data {slot.m_data.load(std::memory_order_relaxed)};
+        const std::uint64_t check{slot.m_check.load(std::memory_order_relaxed)};
+
+        if(data != 0 && (check ^ data) == p_key)
+        {
+            p_entry = unpack(data);
+            increment(counters.m_nbHits);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+SharedTranspositionTable::Statistics SharedTranspositionTable::statistics() const
+{
+    Statistics statistics{0, 0, 0, 0};
+
+    for(std::size_t slot{0}; slot < NB_COUNTER_SLOTS; ++slot)
+    {
+        statistics.m_nbProbes     += m_counters[slot].m_nbProbes.load(std::memory_order_relaxed);
+        statistics.m_nbHits       += m_counters[slot].m_nbHits.load(std::memory_order_relaxed);
+        statistics.m_nbStores     += m_counters[slot].m_nbStores.load(std::memory_order_relaxed);
+        statistics.m_nbCollisions += m_counters[slot].m_nbCollisions.load(std::memory_order_relaxed);
+    }
+
+    return statistics;
+}
+
+
+double SharedTranspositionTable::fillRate() const
+{
+    const std::size_t nbSampled{std::min(nbBuckets(), FILL_SAMPLE)};
+
+    std::size_t nbUsed{0};
+
+    for(std::size_t bucket{0}; bucket < nbSampled; ++bucket)
+    {
+        for(const Slot& slot : m_buckets[bucket].m_slots)
+        {
+            const std::uint64_t data{slot.m_data.load(std::memory_order_relaxed)};
+
+            if(data != 0 && age(data) == 0)
+            {
+                ++nbUsed;
+            }
+        }
+    }
+
+    return static_cast<double>(nbUsed) / static_cast<double>(nbSampled * NB_SLOTS);
+}
+
+
+void SharedTranspositionTable::store(std::uint64_t p_key, const Entry& p_entry)
+{
+    PRECONDITION(p_entry.m_depth >= 0 && p_entry.m_depth <= MAX_DEPTH);
+    PRECONDITION(p_entry.m_move >= -1 && p_entry.m_move <= MAX_DEPTH);
+
+    Counters& counters{this->counters()};
+
+    increment(counters.m_nbStores);
+
+    Bucket& bucket{m_buckets[p_key & m_mask]};
+
+    Slot*         victim{nullptr};
+    std::uint64_t victimData{0};
+    int           victimWorth{std::numeric_limits<int>::max()};
+    Entry         entry{p_entry};
+
+    for(Slot& slot : bucket.m_slots)
+    {
+        const std::uint64_t data {slot.m_data.load(std::memory_order_relaxed)};
+        const std::uint64_t check{slot.m_check.load(std::memory_order_relaxed)};
+
+        if(data != 0 && (check ^ data) == p_key)
+        {
+            // A deeper result of the current search is worth more:
+            if(age(data) == 0 && depthOf(data) > p_entry.m_depth && p_entry.m_bound != Bound::Exact)
+            {
+                return;
+            }
+
+            if(entry.m_move < 0)
+            {
+                entry.m_move = moveOf(data);
+            }
+
+            const std::uint64_t updated{pack(entry, m_generation)};
+
+            slot.m_data.store(updated, std::memory_order_relaxed);
+            slot.m_check.store(p_key ^ updated, std::memory_order_relaxed);
+
+            return;
+        }
+
+        const int worth{data == 0 ? std::numeric_limits<int>::min() : depthOf(data) - AGE_PENALTY * age(data)};
+
+        if(worth < victimWorth)
+        {
+            victim      = &slot;
+            victimData  = data;
+            victimWorth = worth;
+        }
+    }
+
+    if(victimData != 0 && age(victimData) == 0)
+    {
+        increment(counters.m_nbCollisions);
+    }
+
+    const std::uint64_t data{pack(entry, m_generation)};
+
+    victim->m_data.store(data, std::memory_order_relaxed);
+    victim->m_check.store(p_key ^ data, std::memory_order_relaxed);
+}
+
+
+void SharedTranspositionTable::newSearch()
+{
+    m_generation = static_cast<std::uint8_t>((m_generation + 1) & GENERATION_MASK);
+}
+
+
+void SharedTranspositionTable::clear()
+{
+    for(std::size_t bucket{0}; bucket < nbBuckets(); ++bucket)
+    {
+        for(Slot& slot : m_buckets[bucket].m_slots)
+        {
+            slot.m_check.store(0, std::memory_order_relaxed);
+            slot.m_data.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+void SharedTranspositionTable::resetStatistics()
+{
+    for(std::size_t slot{0}; slot < NB_COUNTER_SLOTS; ++slot)
+    {
+        m_counters[slot].m_nbProbes.store(0);
+        m_counters[slot].m_nbHits.store(0);
+        m_counters[slot].m_nbStores.store(0);
+        m_counters[slot].m_nbCollisions.store(0);
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Number of searches since an entry was stored.
+ *
+ * @param[in] p_data The packed entry.
+ *
+ * @return The number of calls to @c newSearch() since the entry was stored, modulo 64.
+ *
+ **************************************************************************************************/
+std::uint8_t SharedTranspositionTable::age(std::uint64_t p_data) const
+{
+    const std::uint8_t generation{static_cast<std::uint8_t>((p_data >> GENERATION_SHIFT) & GENERATION_MASK)};
+
+    return static_cast<std::uint8_t>((m_generation - generation) & GENERATION_MASK);
+}
+
+
+/***********************************************************************************************//**
+ * Counters of the calling thread.
+ *
+ * @return The counters in which the calling thread counts its probes and stores.
+ *
+ **************************************************************************************************/
+SharedTranspositionTable::Counters& SharedTranspositionTable::counters() const
+{
+    return m_counters[threadNumber() % NB_COUNTER_SLOTS];
+}
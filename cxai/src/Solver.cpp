@@ -0,0 +1,625 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    Solver.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a two players perfect play solver.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+
+#include <cxutil/include/ContractException.h>
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/OpeningBook.h"
+#include "../include/Solver.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const int MAX_NB_COLUMNS {32};  // (nbRows + 1) * nbColumns <= 64, with at least one Row.
+const int BEST_MOVE_SCORE{64};  // Above any number of winning Positions.
+
+
+/***********************************************************************************************//**
+ * @brief Sorts the moves of a position, best move first.
+ *
+ * Moves are added worst first (i.e. in reverse exploration order) with their score. An
+ * insertion sort keeps them sorted: equal scores keep their insertion order, which preserves
+ * the centre first ordering between moves of the same score.
+ *
+ **************************************************************************************************/
+class MoveSorter
+{
+
+public:
+
+    void add(std::uint64_t p_move, int p_column, int p_score)
+    {
+        int position{m_size++};
+
+        for(; position > 0 && m_entries[position - 1].m_score > p_score; --position)
+        {
+            m_entries[position] = m_entries[position - 1];
+        }
+
+        m_entries[position].m_move   = p_move;
+        m_entries[position].m_column = p_column;
+        m_entries[position].m_score  = p_score;
+    }
+
+    bool next(std::uint64_t& p_move, int& p_column)
+    {
+        if(m_size == 0)
+        {
+            return false;
+        }
+
+        --m_size;
+
+        p_move   = m_entries[m_size].m_move;
+        p_column = m_entries[m_size].m_column;
+
+        return true;
+    }
+
+private:
+
+    struct Entry
+    {
+        std::uint64_t m_move;
+        int           m_column;
+        int           m_score;
+    };
+
+    int   m_size{0};
+    Entry m_entries[MAX_NB_COLUMNS];
+
+};
+
+
+/***********************************************************************************************//**
+ * Score of a position in which the Player to move wins right away.
+ *
+ * @param[in] p_board The position.
+ *
+ * @return The score.
+ *
+ **************************************************************************************************/
+int immediateWinScore(const BitBoard& p_board)
+{
+    return (p_board.nbPositions() + 1 - p_board.nbMoves()) / 2;
+}
+
+} // unamed namespace
+
+
+Solver::Solver(std::size_t p_nbTableEntries, int p_nbThreads): m_table{p_nbTableEntries},
+                                                               m_book{nullptr},
+                                                               m_bookNbMoves{-1},
+                                                               m_isStopped{false},
+                                                               m_searchId{0},
+                                                               m_nbBusyHelpers{0},
+                                                               m_isQuitting{false},
+                                                               m_board{nullptr},
+                                                               m_alpha{0},
+                                                               m_beta{0},
+                                                               m_score{0},
+                                                               m_nbRows{0},
+                                                               m_inARow{0},
+                                                               m_minScore{0},
+                                                               m_maxScore{0}
+{
+    PRECONDITION(p_nbThreads > 0);
+
+    m_workers.resize(cxutil::narrow_cast<std::size_t>(p_nbThreads), Worker{0, std::vector<int>{}});
+
+    for(std::size_t worker{1}; worker < m_workers.size(); ++worker)
+    {
+        m_helpers.emplace_back(&Solver::runHelper, this, worker);
+    }
+}
+
+
+Solver::~Solver()
+{
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_isQuitting = true;
+    }
+
+    m_newSearch.notify_all();
+
+    for(std::thread& helper : m_helpers)
+    {
+        helper.join();
+    }
+}
+
+
+int Solver::solve(const BitBoard& p_board)
+{
+    if(p_board.canWinNext())
+    {
+        return immediateWinScore(p_board);
+    }
+
+    if(p_board.nbMoves() == p_board.nbPositions())
+    {
+        return 0;
+    }
+
+    prepareFor(p_board);
+
+    Result result;
+
+    if(p_board.nbMoves() <= m_bookNbMoves && m_book->lookup(p_board, result))
+    {
+        return result.m_score;
+    }
+
+    int min{-(p_board.nbPositions() - p_board.nbMoves()) / 2};
+    int max{(p_board.nbPositions() + 1 - p_board.nbMoves()) / 2};
+
+    // Iterative deepening on the score window. Each null window search tells if the score is
+    // above or below a pivot. Pivots close to zero (0) are tried first: they are proved or
+    // refuted by the shallowest trees.
+    while(min < max)
+    {
+        int pivot{min + (max - min) / 2};
+
+        if(pivot <= 0 && min / 2 < pivot)
+        {
+            pivot = min / 2;
+        }
+        else if(pivot >= 0 && max / 2 > pivot)
+        {
+            pivot = max / 2;
+        }
+
+        const int score{search(p_board, pivot, pivot + 1)};
+
+        if(score <= pivot)
+        {
+            max = score;
+        }
+        else
+        {
+            min = score;
+        }
+    }
+
+    return min;
+}
+
+
+Solver::Result Solver::analyze(const BitBoard& p_board)
+{
+    PRECONDITION(p_board.nbMoves() < p_board.nbPositions());
+
+    prepareFor(p_board);
+
+    if(p_board.canWinNext())
+    {
+        for(const int column : columnOrder())
+        {
+            if(p_board.canPlay(column) && p_board.isWinningMove(column))
+            {
+                return Result{column, immediateWinScore(p_board)};
+            }
+        }
+    }
+
+    Result result;
+
+    if(p_board.nbMoves() <= m_bookNbMoves && m_book->lookup(p_board, result))
+    {
+        return result;
+    }
+
+    const int score{solve(p_board)};
+
+    // Find the first Column (in exploration order) reaching the score. The table is warm, so
+    // each check is a cheap null window search:
+    for(const int column : columnOrder())
+    {
+        if(!p_board.canPlay(column))
+        {
+            continue;
+        }
+
+        BitBoard next{p_board};
+        next.play(column);
+
+        const int columnScore{next.canWinNext() ? -immediateWinScore(next)
+                                                : -search(next, -score, -score + 1)};
+
+        if(columnScore >= score)
+        {
+            return Result{column, score};
+        }
+    }
+
+    ASSERTION(false);
+
+    return Result{columnOrder().front(), score};
+}
+
+
+int Solver::minScore(const BitBoard& p_board)
+{
+    return std::min(0, -p_board.nbPositions() / 2 + p_board.inARow() - 1);
+}
+
+
+int Solver::maxScore(const BitBoard& p_board)
+{
+    return std::max(0, (p_board.nbPositions() + 1) / 2 - p_board.inARow() + 1);
+}
+
+
+std::uint64_t Solver::nbExploredNodes() const
+{
+    std::uint64_t nbExploredNodes{0};
+
+    for(const Worker& worker : m_workers)
+    {
+        nbExploredNodes += worker.m_nbExploredNodes;
+    }
+
+    return nbExploredNodes;
+}
+
+
+void Solver::reset()
+{
+    m_table.reset();
+
+    for(Worker& worker : m_workers)
+    {
+        worker.m_nbExploredNodes = 0;
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Runs a search on every thread. With a single thread, this is a plain call to @c negamax().
+ * Otherwise, the sleeping helpers are woken up and the calling thread searches along with them.
+ *
+ * @param[in] p_board The position.
+ * @param[in] p_alpha The score window lower bound.
+ * @param[in] p_beta  The score window upper bound.
+ *
+ * @return The result of the first thread to finish, see @c negamax().
+ *
+ **************************************************************************************************/
+int Solver::search(const BitBoard& p_board, int p_alpha, int p_beta)
+{
+    if(m_workers.size() == 1)
+    {
+        return negamax(m_workers.front(), p_board, p_alpha, p_beta);
+    }
+
+    m_isStopped.store(false);
+
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+
+        m_board         = &p_board;
+        m_alpha         = p_alpha;
+        m_beta          = p_beta;
+        m_nbBusyHelpers = m_helpers.size();
+        ++m_searchId;
+    }
+
+    m_newSearch.notify_all();
+
+    help(m_workers.front(), p_board, p_alpha, p_beta, m_score);
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_helpersDone.wait(lock, [this](){return m_nbBusyHelpers == 0;});
+
+    return m_score;
+}
+
+
+/***********************************************************************************************//**
+ * Body of a helper thread: waits for a search, runs it, and waits for the next one until the
+ * Solver is destroyed.
+ *
+ * @param[in] p_worker The index of the helper's Worker.
+ *
+ **************************************************************************************************/
+void Solver::runHelper(std::size_t p_worker)
+{
+    std::uint64_t lastSearchId{0};
+
+    std::unique_lock<std::mutex> lock{m_mutex};
+
+    while(true)
+    {
+        m_newSearch.wait(lock, [this, &lastSearchId](){return m_isQuitting || m_searchId != lastSearchId;});
+
+        if(m_isQuitting)
+        {
+            return;
+        }
+
+        lastSearchId = m_searchId;
+
+        const BitBoard& board{*m_board};
+        const int       alpha{m_alpha};
+        const int       beta {m_beta};
+
+        lock.unlock();
+        help(m_workers[p_worker], board, alpha, beta, m_score);
+        lock.lock();
+
+        if(--m_nbBusyHelpers == 0)
+        {
+            m_helpersDone.notify_one();
+        }
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Body of a search thread. The first thread to finish gives the score and stops the others.
+ *
+ * @param[in,out] p_worker The thread state.
+ * @param[in]     p_board  The position.
+ * @param[in]     p_alpha  The score window lower bound.
+ * @param[in]     p_beta   The score window upper bound.
+ * @param[out]    p_score  Set to the search result, if this thread is the first to finish.
+ *
+ **************************************************************************************************/
+void Solver::help(Worker& p_worker, const BitBoard& p_board, int p_alpha, int p_beta, int& p_score)
+{
+    const int score{negamax(p_worker, p_board, p_alpha, p_beta)};
+
+    // A stopped search gives no result:
+    if(!m_isStopped.exchange(true))
+    {
+        p_score = score;
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Negamax search with alpha-beta pruning.
+ *
+ * Values stored in the TranspositionTable are shifted so they are always positive. Upper
+ * bounds are stored in <tt>[1, maxScore - minScore + 1]</tt> and lower bounds above this range.
+ *
+ * When another thread finishes the same search first, the search is abandoned: nothing more is
+ * stored in the TranspositionTable and the result is meaningless.
+ *
+ * @param[in,out] p_worker The state of the searching thread.
+ * @param[in]     p_board  The position.
+ * @param[in]     p_alpha  The score window lower bound.
+ * @param[in]     p_beta   The score window upper bound.
+ *
+ * @pre The Player to move cannot win right away.
+ * @pre @c p_alpha is smaller than @c p_beta.
+ *
+ * @return The exact score if it is inside the window. Otherwise, an upper bound of the score if
+ *         it is at most @c p_alpha, or a lower bound if it is at least @c p_beta.
+ *
+ **************************************************************************************************/
+int Solver::negamax(Worker& p_worker, const BitBoard& p_board, int p_alpha, int p_beta)
+{
+    ++p_worker.m_nbExploredNodes;
+
+    const std::uint64_t candidates{p_board.possibleNonLosingMoves()};
+
+    if(candidates == 0)
+    {
+        // Every move lets the opponent win on the next move:
+        return -(p_board.nbPositions() - p_board.nbMoves()) / 2;
+    }
+
+    if(p_board.nbMoves() >= p_board.nbPositions() - 2)
+    {
+        // Neither Player can win anymore:
+        return 0;
+    }
+
+    // The opponent can't win on its next move, so the score is at least:
+    int min{-(p_board.nbPositions() - 2 - p_board.nbMoves()) / 2};
+
+    if(p_alpha < min)
+    {
+        p_alpha = min;
+
+        if(p_alpha >= p_beta)
+        {
+            return p_alpha;
+        }
+    }
+
+    // Book positions are already solved:
+    Result result;
+
+    if(p_board.nbMoves() <= m_bookNbMoves && m_book->lookup(p_board, result))
+    {
+        return result.m_score;
+    }
+
+    // We can't win on this move, so the score is at most:
+    int max{(p_board.nbPositions() - 1 - p_board.nbMoves()) / 2};
+
+    // In the first half of the Game, entries are shared between a position and its mirror image
+    // (later, mirror images are too rare to pay for the extra work). The best Column is stored
+    // as seen from the position with the smallest key:
+    const std::uint64_t key       {p_board.nbMoves() < p_board.nbPositions() / 2 ? p_board.symmetricKey() : p_board.key()};
+    const bool          isMirrored{key != p_board.key()};
+    const int           stored    {m_table.get(key)};
+    const int           bound     {stored & 0xFF};
+
+    int bestColumn{(stored >> 8) - 1};
+
+    if(isMirrored && bestColumn >= 0)
+    {
+        bestColumn = p_board.nbColumns() - 1 - bestColumn;
+    }
+
+    if(bound != 0)
+    {
+        if(bound > m_maxScore - m_minScore + 1)
+        {
+            min = bound + 2 * m_minScore - m_maxScore - 2;
+
+            if(p_alpha < min)
+            {
+                p_alpha = min;
+
+                if(p_alpha >= p_beta)
+                {
+                    return p_alpha;
+                }
+            }
+        }
+        else
+        {
+            max = bound + m_minScore - 1;
+        }
+    }
+
+    if(p_beta > max)
+    {
+        p_beta = max;
+
+        if(p_alpha >= p_beta)
+        {
+            return p_beta;
+        }
+    }
+
+    // The Column which caused a cutoff last time is tried first, then the others by the number
+    // of winning Positions they create:
+    MoveSorter moves;
+
+    for(auto column = p_worker.m_columnOrder.crbegin(); column != p_worker.m_columnOrder.crend(); ++column)
+    {
+        const std::uint64_t move{candidates & p_board.columnMask(*column)};
+
+        if(move)
+        {
+            moves.add(move, *column, *column == bestColumn ? BEST_MOVE_SCORE : p_board.moveScore(move));
+        }
+    }
+
+    std::uint64_t move;
+    int           column;
+
+    while(moves.next(move, column))
+    {
+        BitBoard next{p_board};
+        next.playMove(move);
+
+        const int score{-negamax(p_worker, next, -p_beta, -p_alpha)};
+
+        if(m_isStopped.load(std::memory_order_relaxed))
+        {
+            return 0;
+        }
+
+        if(score >= p_beta)
+        {
+            const int storedColumn{isMirrored ? p_board.nbColumns() - 1 - column : column};
+
+            m_table.put(key, cxutil::narrow_cast<std::uint16_t>(((storedColumn + 1) << 8) | (score + m_maxScore - 2 * m_minScore + 2)));
+
+            return score;
+        }
+
+        if(score > p_alpha)
+        {
+            p_alpha = score;
+        }
+    }
+
+    m_table.put(key, cxutil::narrow_cast<std::uint16_t>(p_alpha - m_minScore + 1));
+
+    return p_alpha;
+}
+
+
+/***********************************************************************************************//**
+ * Prepares the search for a board. The TranspositionTable is cleared if the board size is not
+ * the same as the last one, since keys are only unique for a given board size. The OpeningBook
+ * is only consulted if it was made for this board size.
+ *
+ * @param[in] p_board The board to search.
+ *
+ **************************************************************************************************/
+void Solver::prepareFor(const BitBoard& p_board)
+{
+    const int nbColumns{p_board.nbColumns()};
+
+    const bool isBookUsable{m_book != nullptr                      &&
+                            m_book->nbRows()    == p_board.nbRows() &&
+                            m_book->nbColumns() == nbColumns        &&
+                            m_book->inARow()    == p_board.inARow()};
+
+    m_bookNbMoves = isBookUsable ? m_book->maxNbMoves() : -1;
+
+    if(p_board.nbRows() == m_nbRows && nbColumns == cxutil::narrow_cast<int>(columnOrder().size()) && p_board.inARow() == m_inARow)
+    {
+        return;
+    }
+
+    m_table.reset();
+
+    m_nbRows   = p_board.nbRows();
+    m_inARow   = p_board.inARow();
+    m_minScore = minScore(p_board);
+    m_maxScore = maxScore(p_board);
+
+    // Centre Columns first, alternating left and right. Each helper thread starts the same
+    // sequence one Column further, so that threads explore equally good moves in different
+    // orders:
+    for(std::size_t worker{0}; worker < m_workers.size(); ++worker)
+    {
+        std::vector<int>& order{m_workers[worker].m_columnOrder};
+
+        order.resize(cxutil::narrow_cast<std::size_t>(nbColumns));
+
+        for(int index{0}; index < nbColumns; ++index)
+        {
+            const int shifted{cxutil::narrow_cast<int>((static_cast<std::size_t>(index) + worker) % static_cast<std::size_t>(nbColumns))};
+
+            order[cxutil::narrow_cast<std::size_t>(index)] = nbColumns / 2 + (1 - 2 * (shifted % 2)) * (shifted + 1) / 2;
+        }
+    }
+}
@@ -0,0 +1,266 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    Tablebase.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a memory-mapped Connect X tablebase.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include <cxutil/include/ContractException.h>
+
+#include "../include/Tablebase.h"
+
+
+using namespace cxai;
+
+
+Tablebase::Result Tablebase::throughMove(const Result& p_next)
+{
+    const Outcome outcome{p_next.m_outcome == Outcome::Win  ? Outcome::Loss :
+                          p_next.m_outcome == Outcome::Loss ? Outcome::Win  : Outcome::Draw};
+
+    return Result{outcome, p_next.m_distance + 1};
+}
+
+
+int Tablebase::rank(const Result& p_result)
+{
+    switch(p_result.m_outcome)
+    {
+        case Outcome::Win:  return 256 - p_result.m_distance;
+        case Outcome::Draw: return 0;
+        case Outcome::Loss: return p_result.m_distance - 256;
+    }
+
+    return 0;
+}
+
+
+cxutil::ReturnCode Tablebase::open(const std::string& p_path)
+{
+    close();
+
+    cxutil::ReturnCode status{m_file.open(p_path)};
+
+    if(!status.isOk())
+    {
+        return status;
+    }
+
+    const std::size_t headerSize{sizeof(Header)};
+
+    if(m_file.size() < headerSize)
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is too small to be a tablebase."};
+    }
+
+    const Header* header{reinterpret_cast<const Header*>(m_file.data())};
+
+    const int keyBits{(header->m_nbRows + 1) * header->m_nbColumns};
+
+    if(std::memcmp(header->m_magic, magic(), sizeof(header->m_magic)) != 0 ||
+       header->m_version != version()                                    ||
+       keyBits > 64                                                      ||
+       header->m_directoryBits > keyBits                                 ||
+       header->m_keyBytes != (keyBits - header->m_directoryBits + 7) / 8)
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is not a supported tablebase."};
+    }
+
+    const std::size_t directorySize{((std::size_t{1} << header->m_directoryBits) + 1) * sizeof(std::uint64_t)};
+    const std::size_t nbEntries    {static_cast<std::size_t>(header->m_nbEntries)};
+
+    if(m_file.size() != headerSize + directorySize + nbEntries * (header->m_keyBytes + sizeof(std::uint8_t)))
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is truncated."};
+    }
+
+    m_header    = header;
+    m_directory = reinterpret_cast<const std::uint64_t*>(m_file.data() + headerSize);
+    m_keys      = m_file.data() + headerSize + directorySize;
+    m_values    = m_keys + nbEntries * header->m_keyBytes;
+    m_keyShift  = keyBits - header->m_directoryBits;
+    m_keyMask   = m_keyShift < 64 ? (std::uint64_t{1} << m_keyShift) - 1 : ~std::uint64_t{0};
+    m_keyBytes  = header->m_keyBytes;
+
+    return cxutil::ReturnCode{};
+}
+
+
+void Tablebase::close()
+{
+    m_header    = nullptr;
+    m_directory = nullptr;
+    m_keys      = nullptr;
+    m_values    = nullptr;
+    m_keyShift  = 0;
+    m_keyMask   = 0;
+    m_keyBytes  = 0;
+
+    m_file.close();
+}
+
+
+bool Tablebase::probe(const BitBoard& p_board, Result& p_result) const
+{
+    if(!isOpen()                          ||
+       p_board.nbRows()    != nbRows()    ||
+       p_board.nbColumns() != nbColumns() ||
+       p_board.inARow()    != inARow())
+    {
+        return false;
+    }
+
+    const std::uint64_t key   {p_board.key()};
+    const std::uint64_t bucket{m_keyShift < 64 ? key >> m_keyShift : 0};
+    const std::uint64_t stored{key & m_keyMask};
+
+    // Lower bound of the stored key in its bucket:
+    std::uint64_t first{m_directory[bucket]};
+    std::uint64_t last {m_directory[bucket + 1]};
+
+    while(first < last)
+    {
+        const std::uint64_t middle{first + (last - first) / 2};
+
+        if(storedKey(middle) < stored)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    if(first == m_directory[bucket + 1] || storedKey(first) != stored)
+    {
+        return false;
+    }
+
+    p_result = decode(m_values[first]);
+
+    return true;
+}
+
+
+bool Tablebase::probe(const cxbase::Game& p_game, Result& p_result) const
+{
+    if(!isOpen()                                 ||
+       p_game.nbPlayers()             != 2         ||
+       p_game.gameboard().nbRows()    != nbRows()  ||
+       p_game.gameboard().nbColumns() != nbColumns())
+    {
+        return false;
+    }
+
+    return probe(BitBoard::fromGame(p_game), p_result);
+}
+
+
+/***********************************************************************************************//**
+ * Reads a stored key.
+ *
+ * @param[in] p_index The index of the key.
+ *
+ * @return The key bits below the directory bits.
+ *
+ **************************************************************************************************/
+std::uint64_t Tablebase::storedKey(std::uint64_t p_index) const
+{
+    const std::uint8_t* bytes{m_keys + p_index * static_cast<std::uint64_t>(m_keyBytes)};
+
+    std::uint64_t key{0};
+
+    for(int byte{m_keyBytes}; byte-- > 0;)
+    {
+        key = (key << 8) | bytes[byte];
+    }
+
+    return key;
+}
+
+
+int Tablebase::bestColumn(const BitBoard& p_board) const
+{
+    PRECONDITION(p_board.nbMoves() < p_board.nbPositions());
+
+    Result current{Outcome::Draw, 0};
+
+    if(!probe(p_board, current))
+    {
+        return -1;
+    }
+
+    int bestColumn{-1};
+    int bestRank  {0};
+
+    for(int column{0}; column < p_board.nbColumns(); ++column)
+    {
+        if(!p_board.canPlay(column))
+        {
+            continue;
+        }
+
+        if(p_board.isWinningMove(column))
+        {
+            return column;
+        }
+
+        BitBoard next{p_board};
+        next.play(column);
+
+        Result result{Outcome::Draw, 0};
+
+        // Positions reached from a stored one are stored, unless the file is corrupted:
+        if(!probe(next, result))
+        {
+            return -1;
+        }
+
+        const int columnRank{rank(throughMove(result))};
+
+        if(bestColumn < 0 || columnRank > bestRank)
+        {
+            bestColumn = column;
+            bestRank   = columnRank;
+        }
+    }
+
+    return bestColumn;
+}
@@ -0,0 +1,406 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    TablebaseGenerator.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a retrograde analysis tablebase generator.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <utility>
+
+#include <cxutil/include/ContractException.h>
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/TablebaseGenerator.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::size_t MAX_BUCKET_SIZE    {16};      // Average number of keys per directory bucket.
+const int         MAX_DIRECTORY_BITS {24};      // The directory uses at most 128 MiB.
+const std::size_t MIN_COMPACTION_SIZE{1 << 20}; // Duplicates are only removed by large batches.
+
+
+/***********************************************************************************************//**
+ * Sorts keys and removes the duplicates.
+ *
+ * @param[in,out] p_keys The keys.
+ *
+ * @return The number of unique keys.
+ *
+ **************************************************************************************************/
+std::size_t compact(std::vector<std::uint64_t>& p_keys)
+{
+    std::sort(p_keys.begin(), p_keys.end());
+    p_keys.erase(std::unique(p_keys.begin(), p_keys.end()), p_keys.end());
+
+    return p_keys.size();
+}
+
+
+/***********************************************************************************************//**
+ * Error returned when a board has too many positions.
+ *
+ * @param[in] p_maxNbPositions The maximum number of positions.
+ *
+ * @return A ReturnCode holding an error, with a message.
+ *
+ **************************************************************************************************/
+cxutil::ReturnCode tooManyPositions(std::size_t p_maxNbPositions)
+{
+    return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, "More than " + std::to_string(p_maxNbPositions) + " positions to generate."};
+}
+
+} // unamed namespace
+
+
+TablebaseGenerator::TablebaseGenerator(int p_nbRows, int p_nbColumns, int p_inARow)
+ : m_empty{p_nbRows, p_nbColumns, p_inARow}
+ , m_isGenerated{false}
+{
+}
+
+
+cxutil::ReturnCode TablebaseGenerator::generate(std::size_t p_maxNbPositions)
+{
+    m_isGenerated = false;
+
+    cxutil::ReturnCode status{enumerate(p_maxNbPositions)};
+
+    if(!status.isOk())
+    {
+        m_keys.clear();
+        m_values.clear();
+
+        return status;
+    }
+
+    solve();
+
+    m_isGenerated = true;
+
+    return status;
+}
+
+
+cxutil::ReturnCode TablebaseGenerator::write(const std::string& p_path) const
+{
+    PRECONDITION(m_isGenerated);
+
+    const std::size_t nbEntries{size()};
+
+    // Size the directory for small buckets:
+    const int keyBits{(m_empty.nbRows() + 1) * m_empty.nbColumns()};
+
+    int directoryBits{0};
+
+    while((nbEntries >> directoryBits) > MAX_BUCKET_SIZE && directoryBits < std::min(keyBits, MAX_DIRECTORY_BITS))
+    {
+        ++directoryBits;
+    }
+
+    // Keys are stored without their directory bits, on whole bytes. A few more directory bits
+    // save a byte per key when the bigger directory costs less than that:
+    const int byteDirectoryBits{keyBits - (keyBits - directoryBits) / 8 * 8};
+
+    if(byteDirectoryBits <= MAX_DIRECTORY_BITS && (std::size_t{1} << byteDirectoryBits) * sizeof(std::uint64_t) < nbEntries)
+    {
+        directoryBits = byteDirectoryBits;
+    }
+
+    const int           keyShift {keyBits - directoryBits};
+    const int           keyBytes {(keyShift + 7) / 8};
+    const std::uint64_t keyMask  {keyShift < 64 ? (std::uint64_t{1} << keyShift) - 1 : ~std::uint64_t{0}};
+    const std::size_t   nbBuckets{std::size_t{1} << directoryBits};
+
+    // Count the keys of each bucket, then turn the counts into start indexes:
+    std::vector<std::uint64_t> directory(nbBuckets + 1, 0);
+
+    for(const std::vector<std::uint64_t>& keys : m_keys)
+    {
+        for(const std::uint64_t key : keys)
+        {
+            ++directory[keyShift < 64 ? static_cast<std::size_t>(key >> keyShift) + 1 : 1];
+        }
+    }
+
+    std::partial_sum(directory.begin(), directory.end(), directory.begin());
+
+    Tablebase::Header header;
+
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.m_magic, Tablebase::magic(), sizeof(header.m_magic));
+
+    header.m_version       = Tablebase::version();
+    header.m_nbRows        = cxutil::narrow_cast<std::uint8_t>(m_empty.nbRows());
+    header.m_nbColumns     = cxutil::narrow_cast<std::uint8_t>(m_empty.nbColumns());
+    header.m_inARow        = cxutil::narrow_cast<std::uint8_t>(m_empty.inARow());
+    header.m_directoryBits = cxutil::narrow_cast<std::uint8_t>(directoryBits);
+    header.m_nbEntries     = nbEntries;
+    header.m_keyBytes      = cxutil::narrow_cast<std::uint8_t>(keyBytes);
+
+    std::ofstream file{p_path, std::ios::binary | std::ios::trunc};
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(directory.data()), static_cast<std::streamsize>(directory.size() * sizeof(std::uint64_t)));
+
+    // Keys are unique for the whole board shape, so merging the sorted groups gives every key
+    // in order. The keys are written in a first merge and their values in a second one, which
+    // needs no more memory than the groups themselves:
+    for(const bool isWritingKeys : {true, false})
+    {
+        typedef std::pair<std::uint64_t, std::size_t> Head; // The next key of a group, and the group.
+
+        std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heads;
+        std::vector<std::size_t>                                         next(m_keys.size(), 0);
+
+        for(std::size_t group{0}; group < m_keys.size(); ++group)
+        {
+            if(!m_keys[group].empty())
+            {
+                heads.emplace(m_keys[group].front(), group);
+            }
+        }
+
+        while(!heads.empty())
+        {
+            const Head        head {heads.top()};
+            const std::size_t group{head.second};
+            const std::size_t index{next[group]++};
+
+            heads.pop();
+
+            if(isWritingKeys)
+            {
+                char bytes[sizeof(std::uint64_t)];
+
+                for(int byte{0}; byte < keyBytes; ++byte)
+                {
+                    bytes[byte] = static_cast<char>(((head.first & keyMask) >> (8 * byte)) & 0xFF);
+                }
+
+                file.write(bytes, keyBytes);
+            }
+            else
+            {
+                file.write(reinterpret_cast<const char*>(&m_values[group][index]), sizeof(std::uint8_t));
+            }
+
+            if(index + 1 < m_keys[group].size())
+            {
+                heads.emplace(m_keys[group][index + 1], group);
+            }
+        }
+    }
+
+    file.close();
+
+    if(!file)
+    {
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, "Unable to write " + p_path + "."};
+    }
+
+    return cxutil::ReturnCode{};
+}
+
+
+std::size_t TablebaseGenerator::size() const
+{
+    std::size_t size{0};
+
+    for(const std::vector<std::uint64_t>& keys : m_keys)
+    {
+        size += keys.size();
+    }
+
+    return size;
+}
+
+
+std::size_t TablebaseGenerator::nbPositions(Tablebase::Outcome p_outcome) const
+{
+    std::size_t nbPositions{0};
+
+    for(const std::vector<std::uint8_t>& values : m_values)
+    {
+        nbPositions += cxutil::narrow_cast<std::size_t>(std::count_if(values.begin(), values.end(), [p_outcome](std::uint8_t p_value)
+                                                                      {
+                                                                          return Tablebase::decode(p_value).m_outcome == p_outcome;
+                                                                      }));
+    }
+
+    return nbPositions;
+}
+
+
+/***********************************************************************************************//**
+ * Forward pass: enumerates the reachable positions, one group per number of moves.
+ *
+ * @param[in] p_maxNbPositions The maximum number of positions.
+ *
+ * @return A ReturnCode holding an error if there are more positions than allowed.
+ *
+ **************************************************************************************************/
+cxutil::ReturnCode TablebaseGenerator::enumerate(std::size_t p_maxNbPositions)
+{
+    const int nbRows   {m_empty.nbRows()};
+    const int nbColumns{m_empty.nbColumns()};
+    const int inARow   {m_empty.inARow()};
+
+    m_keys.assign(1, std::vector<std::uint64_t>{m_empty.key()});
+
+    std::size_t nbPositions{1};
+
+    for(int nbMoves{0}; nbMoves < m_empty.nbPositions(); ++nbMoves)
+    {
+        std::vector<std::uint64_t> next;
+        std::size_t                nbUnique{0};
+
+        for(const std::uint64_t key : m_keys.back())
+        {
+            // Most positions are reached by several move orders. Duplicates are removed as they
+            // pile up, so that they never use much more memory than the positions themselves:
+            if(next.size() > 2 * nbUnique + MIN_COMPACTION_SIZE)
+            {
+                nbUnique = compact(next);
+
+                if(nbPositions + nbUnique > p_maxNbPositions)
+                {
+                    return tooManyPositions(p_maxNbPositions);
+                }
+            }
+
+            const BitBoard board{BitBoard::fromKey(nbRows, nbColumns, inARow, key)};
+
+            if(board.canWinNext())
+            {
+                continue;
+            }
+
+            for(int column{0}; column < nbColumns; ++column)
+            {
+                if(board.canPlay(column))
+                {
+                    BitBoard child{board};
+                    child.play(column);
+
+                    next.push_back(child.key());
+                }
+            }
+        }
+
+        nbPositions += compact(next);
+
+        if(nbPositions > p_maxNbPositions)
+        {
+            return tooManyPositions(p_maxNbPositions);
+        }
+
+        m_keys.push_back(std::move(next));
+    }
+
+    return cxutil::ReturnCode{};
+}
+
+
+/***********************************************************************************************//**
+ * Backward pass: solves the groups from the full boards to the empty board. The positions
+ * reached by a move are always in the next group, which is solved first.
+ *
+ **************************************************************************************************/
+void TablebaseGenerator::solve()
+{
+    const int nbRows   {m_empty.nbRows()};
+    const int nbColumns{m_empty.nbColumns()};
+    const int inARow   {m_empty.inARow()};
+
+    m_values.assign(m_keys.size(), std::vector<std::uint8_t>{});
+
+    for(std::size_t nbMoves{m_keys.size()}; nbMoves-- > 0;)
+    {
+        const std::vector<std::uint64_t>& keys{m_keys[nbMoves]};
+        std::vector<std::uint8_t>&        values{m_values[nbMoves]};
+
+        values.resize(keys.size());
+
+        for(std::size_t index{0}; index < keys.size(); ++index)
+        {
+            const BitBoard board{BitBoard::fromKey(nbRows, nbColumns, inARow, keys[index])};
+
+            Tablebase::Result best{Tablebase::Outcome::Draw, 0};
+
+            if(board.canWinNext())
+            {
+                best = Tablebase::Result{Tablebase::Outcome::Win, 1};
+            }
+            else if(board.nbMoves() < board.nbPositions())
+            {
+                const std::vector<std::uint64_t>& nextKeys  {m_keys[nbMoves + 1]};
+                const std::vector<std::uint8_t>&  nextValues{m_values[nbMoves + 1]};
+
+                bool isFirst{true};
+
+                for(int column{0}; column < nbColumns; ++column)
+                {
+                    if(!board.canPlay(column))
+                    {
+                        continue;
+                    }
+
+                    BitBoard child{board};
+                    child.play(column);
+
+                    const auto found = std::lower_bound(nextKeys.begin(), nextKeys.end(), child.key());
+
+                    ASSERTION(found != nextKeys.end() && *found == child.key());
+
+                    const Tablebase::Result result{Tablebase::throughMove(Tablebase::decode(nextValues[static_cast<std::size_t>(found - nextKeys.begin())]))};
+
+                    if(isFirst || Tablebase::rank(result) > Tablebase::rank(best))
+                    {
+                        best    = result;
+                        isFirst = false;
+                    }
+                }
+            }
+
+            values[index] = Tablebase::encode(best);
+        }
+    }
+}
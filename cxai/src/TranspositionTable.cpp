@@ -0,0 +1,59 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    TranspositionTable.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a transposition table.
+ *
+ **************************************************************************************************/
+
+#include <cxutil/include/ContractException.h>
+
+#include "../include/TranspositionTable.h"
+
+
+using namespace cxai;
+
+
+TranspositionTable::TranspositionTable(std::size_t p_nbEntries): m_size{p_nbEntries}
+{
+    PRECONDITION(p_nbEntries >= 65536);
+
+    m_entries.reset(new std::atomic<std::uint64_t>[p_nbEntries]);
+
+    reset();
+}
+
+
+void TranspositionTable::reset()
+{
+    for(std::size_t entry{0}; entry < m_size; ++entry)
+    {
+        m_entries[entry].store(0, std::memory_order_relaxed);
+    }
+}
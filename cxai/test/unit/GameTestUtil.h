@@ -0,0 +1,93 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    GameTestUtil.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Games and players shared by the cxai unit tests.
+ *
+ **************************************************************************************************/
+
+#ifndef GAMETESTUTIL_H_D460F694_DF8B_4039_93E6_25A08357E360
+#define GAMETESTUTIL_H_D460F694_DF8B_4039_93E6_25A08357E360
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxbase/include/Game.h>
+#include <cxbase/include/GameBoard.h>
+#include <cxbase/include/Player.h>
+
+
+/***********************************************************************************************//**
+ * Creates the players of a test game, named "Player 0", "Player 1", etc.
+ *
+ * @param p_nbPlayers The number of players (at most five).
+ *
+ * @return The players, in playing order.
+ *
+ **************************************************************************************************/
+inline std::vector<std::shared_ptr<cxbase::Player>> players(int p_nbPlayers)
+{
+    const std::vector<cxbase::Disc> discs{cxbase::Disc::blackDisc(),
+                                          cxbase::Disc::redDisc(),
+                                          cxbase::Disc::yellowDisc(),
+                                          cxbase::Disc::blueDisc(),
+                                          cxbase::Disc::greenDisc()};
+
+    std::vector<std::shared_ptr<cxbase::Player>> result;
+
+    for(int player{0}; player < p_nbPlayers; ++player)
+    {
+        result.push_back(std::make_shared<cxbase::Player>(cxutil::Name{"Player " + std::to_string(player)},
+                                                          discs[static_cast<std::size_t>(player)]));
+    }
+
+    return result;
+}
+
+
+/***********************************************************************************************//**
+ * Creates a connect four game on a classic 6 by 7 board, with some moves already played.
+ *
+ * @param p_nbPlayers The number of players (at most five).
+ * @param p_columns   The columns played, in order.
+ *
+ * @return The game.
+ *
+ **************************************************************************************************/
+inline cxbase::Game classicGame(int p_nbPlayers, const std::vector<int>& p_columns)
+{
+    cxbase::Game game{players(p_nbPlayers), std::make_shared<cxbase::GameBoard>(), 4};
+
+    for(const int column : p_columns)
+    {
+        game.makeMove(cxbase::Column{column});
+    }
+
+    return game;
+}
+
+#endif // GAMETESTUTIL_H_D460F694_DF8B_4039_93E6_25A08357E360
@@ -0,0 +1,229 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_BitBoard.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the BitBoard class.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <include/BitBoard.h>
+
+
+using namespace cxai;
+
+
+TEST(BitBoard, Constructor_ClassicShape_EmptyBoard)
+{
+    const BitBoard t_board{6, 7, 4};
+
+    ASSERT_EQ(t_board.nbRows(), 6);
+    ASSERT_EQ(t_board.nbColumns(), 7);
+    ASSERT_EQ(t_board.inARow(), 4);
+    ASSERT_EQ(t_board.nbMoves(), 0);
+    ASSERT_EQ(t_board.nbPositions(), 42);
+    ASSERT_EQ(t_board.key(), 0u);
+
+    for(int column{0}; column < t_board.nbColumns(); ++column)
+    {
+        ASSERT_TRUE(t_board.canPlay(column));
+        ASSERT_FALSE(t_board.isWinningMove(column));
+    }
+}
+
+
+TEST(BitBoard, Constructor_BoardTooLarge_ExceptionThrown)
+{
+    ASSERT_THROW((BitBoard{7, 9, 4}), PreconditionException);
+    ASSERT_THROW((BitBoard{6, 7, 1}), PreconditionException);
+    ASSERT_NO_THROW((BitBoard{7, 8, 4}));
+}
+
+
+TEST(BitBoard, Play_FullColumn_CannotPlay)
+{
+    BitBoard t_board{6, 7, 4};
+
+    ASSERT_EQ(t_board.play("111111"), 6);
+    ASSERT_FALSE(t_board.canPlay(0));
+    ASSERT_THROW(t_board.play(0), PreconditionException);
+}
+
+
+TEST(BitBoard, IsWinningMove_EveryDirection_WinDetected)
+{
+    BitBoard t_vertical{6, 7, 4};
+    ASSERT_EQ(t_vertical.play("121212"), 6);
+    ASSERT_TRUE(t_vertical.isWinningMove(0));
+    ASSERT_FALSE(t_vertical.isWinningMove(1));
+
+    BitBoard t_horizontal{6, 7, 4};
+    ASSERT_EQ(t_horizontal.play("415263"), 6);
+    ASSERT_TRUE(t_horizontal.isWinningMove(6));
+    ASSERT_FALSE(t_horizontal.isWinningMove(2));
+
+    BitBoard t_upward{6, 7, 4};
+    ASSERT_EQ(t_upward.play("1223343446"), 10);
+    ASSERT_TRUE(t_upward.isWinningMove(3));
+
+    BitBoard t_downward{6, 7, 4};
+    ASSERT_EQ(t_downward.play("7665545442"), 10);
+    ASSERT_TRUE(t_downward.isWinningMove(3));
+}
+
+
+TEST(BitBoard, IsWinningMove_TallConnectFourBoard_WinDetected)
+{
+    // Three times the upward diagonal distance is past 64 bits on such a board:
+    BitBoard t_vertical{30, 2, 4};
+    ASSERT_EQ(t_vertical.play("121212"), 6);
+    ASSERT_TRUE(t_vertical.isWinningMove(0));
+    ASSERT_FALSE(t_vertical.isWinningMove(1));
+
+    BitBoard t_blocked{30, 2, 4};
+    ASSERT_EQ(t_blocked.play("1212112"), 7);
+    ASSERT_FALSE(t_blocked.isWinningMove(0));
+    ASSERT_FALSE(t_blocked.isWinningMove(1));
+}
+
+
+TEST(BitBoard, IsWinningMove_NoWrapAroundColumns_NoWin)
+{
+    // Three Discs on top of the first Column and one at the bottom of the second are not
+    // aligned, even if their bits are close:
+    BitBoard t_board{6, 7, 4};
+
+    ASSERT_EQ(t_board.play("6111171716"), 10);
+    ASSERT_FALSE(t_board.isWinningMove(1));
+}
+
+
+TEST(BitBoard, Play_SequenceWithWin_StopsBeforeWin)
+{
+    BitBoard t_board{6, 7, 4};
+
+    ASSERT_EQ(t_board.play("1212121"), 6);
+    ASSERT_EQ(t_board.play("8"), 0);
+    ASSERT_EQ(t_board.nbMoves(), 6);
+}
+
+
+TEST(BitBoard, Key_Transpositions_SameKey)
+{
+    BitBoard t_first{6, 7, 4};
+    BitBoard t_second{6, 7, 4};
+    BitBoard t_third{6, 7, 4};
+
+    t_first.play("4453");
+    t_second.play("5344");
+    t_third.play("4345");
+
+    ASSERT_EQ(t_first.key(), t_second.key());
+    ASSERT_NE(t_first.key(), t_third.key());
+}
+
+
+TEST(BitBoard, PossibleNonLosingMoves_OpponentThreat_OnlyBlockingMove)
+{
+    BitBoard t_board{6, 7, 4};
+
+    ASSERT_EQ(t_board.play("44556"), 5);
+
+    // The first Player threatens both sides, so nothing saves the second Player:
+    ASSERT_EQ(t_board.possibleNonLosingMoves(), 0u);
+
+    BitBoard t_blockable{6, 7, 4};
+
+    ASSERT_EQ(t_blockable.play("11223"), 5);
+    ASSERT_EQ(t_blockable.possibleNonLosingMoves(), t_blockable.possible() & t_blockable.columnMask(3));
+}
+
+
+TEST(BitBoard, InARow_ConnectThree_WinDetected)
+{
+    BitBoard t_board{4, 5, 3};
+
+    ASSERT_EQ(t_board.play("1122"), 4);
+    ASSERT_TRUE(t_board.isWinningMove(2));
+    ASSERT_FALSE(t_board.isWinningMove(3));
+}
+
+
+TEST(BitBoard, FromGame_TwoPlayersGame_SamePosition)
+{
+    auto t_gameboard = std::make_shared<cxbase::GameBoard>();
+    const std::vector<std::shared_ptr<cxbase::Player>> t_players{
+        std::make_shared<cxbase::Player>(cxutil::Name{"First Player" }, cxbase::Disc::blackDisc()),
+        std::make_shared<cxbase::Player>(cxutil::Name{"Second Player"}, cxbase::Disc::redDisc())
+    };
+
+    cxbase::Game t_game{t_players, t_gameboard, 4};
+
+    BitBoard t_expected{6, 7, 4};
+
+    for(const int column : {3, 3, 4, 2, 6})
+    {
+        t_game.makeMove(cxbase::Column{column});
+        t_expected.play(column);
+
+        const BitBoard t_board{BitBoard::fromGame(t_game)};
+
+        ASSERT_EQ(t_board.key(), t_expected.key());
+        ASSERT_EQ(t_board.nbMoves(), t_expected.nbMoves());
+    }
+}
+
+
+TEST(BitBoard, FromKey_PlayedPositions_SamePosition)
+{
+    BitBoard t_expected{6, 7, 4};
+
+    for(const int column : {3, 3, 4, 2, 6, 0})
+    {
+        t_expected.play(column);
+
+        BitBoard t_board{BitBoard::fromKey(6, 7, 4, t_expected.key())};
+
+        ASSERT_EQ(t_board.key(), t_expected.key());
+        ASSERT_EQ(t_board.nbMoves(), t_expected.nbMoves());
+        ASSERT_EQ(t_board.possible(), t_expected.possible());
+
+        // The same Player is to move:
+        t_board.play(1);
+        t_expected.play(1);
+
+        ASSERT_EQ(t_board.key(), t_expected.key());
+    }
+}
+
+
+TEST(BitBoard, FromKey_InvalidKey_ExceptionThrown)
+{
+    // The sentinel bit on top of a Column can't be set alone:
+    ASSERT_THROW(BitBoard::fromKey(6, 7, 4, std::uint64_t{0x7F}), PreconditionException);
+}
@@ -0,0 +1,159 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    test_MonteCarloSearch.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the MonteCarloSearch class.
+ *
+ **************************************************************************************************/
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <include/MonteCarloSearch.h>
+
+#include "GameTestUtil.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::chrono::milliseconds NO_LIMIT{60000};
+
+} // unamed namespace
+
+
+TEST(MonteCarloSearch, Constructor_NoThread_ExceptionThrown)
+{
+    ASSERT_THROW(MonteCarloSearch(0), PreconditionException);
+}
+
+
+TEST(MonteCarloSearch, Search_ImmediateWin_WinningColumnChosen)
+{
+    const cxbase::Game t_game{classicGame(2, {0, 1, 0, 1, 0, 1})};
+
+    MonteCarloSearch t_search{1, 1 << 16};
+
+    const MonteCarloSearch::Result t_result{t_search.search(t_game, NO_LIMIT, 2000)};
+
+    ASSERT_EQ(t_result.m_column, 0);
+    ASSERT_GT(t_result.m_value, 0.9);
+}
+
+
+TEST(MonteCarloSearch, Search_OpponentThreat_ThreatBlocked)
+{
+    const cxbase::Game t_game{classicGame(2, {0, 6, 0, 6, 1, 6})};
+
+    MonteCarloSearch t_search{2, 1 << 16};
+
+    ASSERT_EQ(t_search.search(t_game, NO_LIMIT, 5000).m_column, 6);
+}
+
+
+TEST(MonteCarloSearch, Search_PlayoutBudget_ExactNumberOfPlayouts)
+{
+    const cxbase::Game t_game{classicGame(3, {3})};
+
+    for(const int nbThreads : {1, 4})
+    {
+        MonteCarloSearch t_search{nbThreads, 1 << 16};
+
+        const MonteCarloSearch::Result t_result{t_search.search(t_game, NO_LIMIT, 500)};
+
+        ASSERT_EQ(t_result.m_nbPlayouts, 500u);
+        ASSERT_GT(t_result.m_nbNodes, 1u);
+        ASSERT_GT(t_result.playoutsPerSecond(), 0.0);
+    }
+}
+
+
+TEST(MonteCarloSearch, Search_OneThreadSameSeed_SameResult)
+{
+    const cxbase::Game t_game{classicGame(2, {3, 3, 2})};
+
+    MonteCarloSearch t_first {1, 1 << 16, 42};
+    MonteCarloSearch t_second{1, 1 << 16, 42};
+
+    const MonteCarloSearch::Result t_firstResult {t_first.search(t_game, NO_LIMIT, 1000)};
+    const MonteCarloSearch::Result t_secondResult{t_second.search(t_game, NO_LIMIT, 1000)};
+
+    ASSERT_EQ(t_firstResult.m_column, t_secondResult.m_column);
+    ASSERT_EQ(t_firstResult.m_value, t_secondResult.m_value);
+    ASSERT_EQ(t_firstResult.m_nbNodes, t_secondResult.m_nbNodes);
+}
+
+
+TEST(MonteCarloSearch, Search_SmallNodePool_PlayoutsGoOn)
+{
+    const cxbase::Game t_game{classicGame(2, {})};
+
+    MonteCarloSearch t_search{2, 100};
+
+    const MonteCarloSearch::Result t_result{t_search.search(t_game, NO_LIMIT, 300)};
+
+    ASSERT_EQ(t_result.m_nbPlayouts, 300u);
+    ASSERT_LE(t_result.m_nbNodes, 100u);
+}
+
+
+TEST(MonteCarloSearch, Search_FullColumn_NeverChosen)
+{
+    const cxbase::Game t_game{classicGame(2, {3, 3, 3, 3, 3, 3})};
+
+    MonteCarloSearch t_search{2, 1 << 16};
+
+    ASSERT_NE(t_search.search(t_game, NO_LIMIT, 500).m_column, 3);
+}
+
+
+TEST(MonteCarloSearch, Search_LargestBoardFourPlayers_AnswersWithinBudget)
+{
+    const cxbase::Game t_game{players(4), std::make_shared<cxbase::GameBoard>(64, 64), 4};
+
+    const std::chrono::milliseconds t_budget{200};
+
+    MonteCarloSearch t_search{4, 1 << 16};
+
+    const auto t_start = std::chrono::steady_clock::now();
+
+    const MonteCarloSearch::Result t_result{t_search.search(t_game, t_budget)};
+
+    const auto t_elapsed = std::chrono::steady_clock::now() - t_start;
+
+    ASSERT_GE(t_result.m_column, 0);
+    ASSERT_LT(t_result.m_column, 64);
+    ASSERT_GT(t_result.m_nbPlayouts, 0u);
+    ASSERT_LT(t_elapsed, t_budget + std::chrono::milliseconds{300});
+}
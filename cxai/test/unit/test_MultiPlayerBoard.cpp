@@ -0,0 +1,276 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    test_MultiPlayerBoard.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the MultiPlayerBoard class.
+ *
+ **************************************************************************************************/
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <include/MultiPlayerBoard.h>
+
+#include "GameTestUtil.h"
+
+
+using namespace cxai;
+
+
+TEST(MultiPlayerBoard, Constructor_EmptyGame_MatchesGame)
+{
+    const cxbase::Game t_game{players(3), std::make_shared<cxbase::GameBoard>(), 4};
+
+    const MultiPlayerBoard t_board{t_game};
+
+    ASSERT_EQ(t_board.nbRows(), 6);
+    ASSERT_EQ(t_board.nbColumns(), 7);
+    ASSERT_EQ(t_board.inARow(), 4);
+    ASSERT_EQ(t_board.nbPlayers(), 3);
+    ASSERT_EQ(t_board.activePlayer(), 0);
+    ASSERT_EQ(t_board.nbDiscs(), 0);
+    ASSERT_EQ(t_board.hash(), t_game.hash());
+    ASSERT_FALSE(t_board.isWon());
+    ASSERT_FALSE(t_board.isFull());
+    ASSERT_EQ(t_board.score(0), 0);
+}
+
+
+TEST(MultiPlayerBoard, Play_CornerDisc_ScoresEveryWindowContainingIt)
+{
+    const cxbase::Game t_game{players(2), std::make_shared<cxbase::GameBoard>(), 4};
+
+    MultiPlayerBoard t_board{t_game};
+
+    t_board.play(0);
+
+    // One horizontal, one vertical and one diagonal window hold the corner:
+    ASSERT_EQ(t_board.score(0), 3);
+    ASSERT_EQ(t_board.score(1), 0);
+    ASSERT_EQ(t_board.activePlayer(), 1);
+
+    // The shared horizontal window is no longer open to anyone:
+    t_board.play(1);
+
+    ASSERT_EQ(t_board.score(0), 2);
+}
+
+
+TEST(MultiPlayerBoard, Play_SameMovesAsGame_SameHashAndScoresAsRebuiltBoard)
+{
+    const auto t_players = players(4);
+
+    cxbase::Game     t_game{t_players, std::make_shared<cxbase::GameBoard>(8, 8), 4};
+    MultiPlayerBoard t_board{t_game};
+
+    std::mt19937 t_random{7};
+
+    for(int move{0}; move < 40; ++move)
+    {
+        int t_column{static_cast<int>(t_random() % 8)};
+
+        while(!t_board.canPlay(t_column))
+        {
+            t_column = (t_column + 1) % 8;
+        }
+
+        t_board.play(t_column);
+        t_game.makeMove(cxbase::Column{t_column});
+
+        ASSERT_EQ(t_board.hash(), t_game.hash());
+
+        const MultiPlayerBoard t_rebuilt{t_game};
+
+        for(int player{0}; player < 4; ++player)
+        {
+            ASSERT_EQ(t_board.score(player), t_rebuilt.score(player));
+        }
+
+        ASSERT_EQ(t_board.activePlayer(), t_rebuilt.activePlayer());
+        ASSERT_EQ(t_board.isWon(), t_rebuilt.isWon());
+
+        if(t_board.isWon())
+        {
+            break;
+        }
+    }
+}
+
+
+TEST(MultiPlayerBoard, Score_GameWeights_SameScoresAsGame)
+{
+    cxbase::Game t_game{players(3), std::make_shared<cxbase::GameBoard>(), 4};
+
+    t_game.setEvaluationWeights(std::make_shared<const cxbase::EvaluationWeights>(4, std::vector<std::int64_t>{1, 5, 50, 1000}));
+
+    MultiPlayerBoard t_board{t_game};
+
+    std::mt19937 t_random{11};
+
+    while(!t_board.isWon() && !t_board.isFull())
+    {
+        const int t_column{static_cast<int>(t_random() % 7)};
+
+        if(!t_board.canPlay(t_column))
+        {
+            continue;
+        }
+
+        t_board.play(t_column);
+        t_game.makeMove(cxbase::Column{t_column});
+
+        for(int player{0}; player < 3; ++player)
+        {
+            ASSERT_EQ(t_board.score(player), t_game.score(player));
+        }
+    }
+}
+
+
+TEST(MultiPlayerBoard, Undo_MovesAndTakeBacks_SameScoresAsGame)
+{
+    cxbase::Game     t_game{players(4), std::make_shared<cxbase::GameBoard>(7, 8), 5};
+    MultiPlayerBoard t_board{t_game};
+
+    std::mt19937 t_random{5};
+
+    for(int step{0}; step < 200; ++step)
+    {
+        const bool t_isTakeBack{t_board.nbDiscs() > 0 && (t_board.isWon() || t_board.isFull() || t_random() % 3 == 0)};
+
+        if(t_isTakeBack)
+        {
+            t_board.undo();
+            t_game.undoMove();
+        }
+        else
+        {
+            int t_column{static_cast<int>(t_random() % 8)};
+
+            while(!t_board.canPlay(t_column))
+            {
+                t_column = (t_column + 1) % 8;
+            }
+
+            t_board.play(t_column);
+            t_game.makeMove(cxbase::Column{t_column});
+        }
+
+        for(int player{0}; player < 4; ++player)
+        {
+            ASSERT_EQ(t_board.score(player), t_game.score(player));
+        }
+
+        ASSERT_EQ(t_board.isWon(), t_game.isWon());
+    }
+}
+
+
+TEST(MultiPlayerBoard, Undo_SomeMoves_StateRestored)
+{
+    const cxbase::Game t_game{players(3), std::make_shared<cxbase::GameBoard>(), 4};
+
+    MultiPlayerBoard t_board{t_game};
+
+    for(const int column : {3, 3, 4, 2, 3, 5, 1})
+    {
+        t_board.play(column);
+    }
+
+    const std::uint64_t t_hash{t_board.hash()};
+    const std::int64_t  t_scores[]{t_board.score(0), t_board.score(1), t_board.score(2)};
+
+    t_board.play(4);
+    t_board.play(0, 2, 1);
+    t_board.play(6);
+    t_board.undo();
+    t_board.undo();
+    t_board.undo();
+
+    ASSERT_EQ(t_board.hash(), t_hash);
+    ASSERT_EQ(t_board.activePlayer(), 1);
+
+    for(int player{0}; player < 3; ++player)
+    {
+        ASSERT_EQ(t_board.score(player), t_scores[player]);
+    }
+
+    for(int i{0}; i < 7; ++i)
+    {
+        t_board.undo();
+    }
+
+    ASSERT_EQ(t_board.hash(), t_game.hash());
+    ASSERT_EQ(t_board.score(0), 0);
+    ASSERT_EQ(t_board.score(1), 0);
+    ASSERT_EQ(t_board.score(2), 0);
+}
+
+
+TEST(MultiPlayerBoard, IsWon_FourInAColumn_WinnerIsKnownUntilUndone)
+{
+    const cxbase::Game t_game{players(2), std::make_shared<cxbase::GameBoard>(), 4};
+
+    MultiPlayerBoard t_board{t_game};
+
+    for(const int column : {0, 1, 0, 1, 0, 1})
+    {
+        t_board.play(column);
+    }
+
+    ASSERT_FALSE(t_board.isWon());
+
+    t_board.play(0);
+
+    ASSERT_TRUE(t_board.isWon());
+    ASSERT_EQ(t_board.winner(), 0);
+
+    t_board.undo();
+
+    ASSERT_FALSE(t_board.isWon());
+}
+
+
+TEST(MultiPlayerBoard, CanPlay_FullColumn_ReturnsFalse)
+{
+    const cxbase::Game t_game{players(2), std::make_shared<cxbase::GameBoard>(), 4};
+
+    MultiPlayerBoard t_board{t_game};
+
+    for(int i{0}; i < 6; ++i)
+    {
+        ASSERT_TRUE(t_board.canPlay(2));
+        t_board.play(2);
+    }
+
+    ASSERT_FALSE(t_board.canPlay(2));
+    ASSERT_TRUE(t_board.canPlay(3));
+}
@@ -0,0 +1,158 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    test_MultiPlayerSearch.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the MultiPlayerSearch class.
+ *
+ **************************************************************************************************/
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <include/MultiPlayerSearch.h>
+
+#include "GameTestUtil.h"
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::chrono::milliseconds NO_LIMIT{60000};
+
+const MultiPlayerSearch::Mode ALL_MODES[]{MultiPlayerSearch::Mode::MaxN,
+                                          MultiPlayerSearch::Mode::Paranoid,
+                                          MultiPlayerSearch::Mode::BestReply};
+
+} // unamed namespace
+
+
+TEST(MultiPlayerSearch, Search_ImmediateWin_WinningColumnChosen)
+{
+    const cxbase::Game t_game{classicGame(2, {0, 1, 0, 1, 0, 1})};
+
+    for(const auto mode : ALL_MODES)
+    {
+        MultiPlayerSearch t_search{mode, 1};
+
+        const MultiPlayerSearch::Result t_result{t_search.search(t_game, NO_LIMIT, 4)};
+
+        ASSERT_EQ(t_result.m_column, 0);
+        ASSERT_EQ(t_result.m_value, MultiPlayerSearch::maxSum());
+    }
+}
+
+
+TEST(MultiPlayerSearch, Search_TwoPlayersOpponentThreat_ThreatBlocked)
+{
+    const cxbase::Game t_game{classicGame(2, {0, 6, 0, 6, 1, 6})};
+
+    for(const auto mode : ALL_MODES)
+    {
+        MultiPlayerSearch t_search{mode, 1};
+
+        ASSERT_EQ(t_search.search(t_game, NO_LIMIT, 4).m_column, 6);
+    }
+}
+
+
+TEST(MultiPlayerSearch, Search_ThreePlayersNextPlayerThreat_ThreatBlocked)
+{
+    const cxbase::Game t_game{classicGame(3, {0, 6, 3, 0, 6, 3, 2, 6, 1})};
+
+    for(const auto mode : ALL_MODES)
+    {
+        MultiPlayerSearch t_search{mode, 1};
+
+        ASSERT_EQ(t_search.search(t_game, NO_LIMIT, 3).m_column, 6);
+    }
+}
+
+
+TEST(MultiPlayerSearch, Search_TwoPlayers_MaxNAndParanoidAgree)
+{
+    const cxbase::Game t_game{classicGame(2, {3, 2})};
+
+    MultiPlayerSearch t_search{MultiPlayerSearch::Mode::MaxN, 1};
+
+    const MultiPlayerSearch::Result t_maxN{t_search.search(t_game, NO_LIMIT, 4)};
+
+    t_search.setMode(MultiPlayerSearch::Mode::Paranoid);
+
+    const MultiPlayerSearch::Result t_paranoid{t_search.search(t_game, NO_LIMIT, 4)};
+
+    ASSERT_EQ(t_maxN.m_depth, 4);
+    ASSERT_EQ(t_paranoid.m_depth, 4);
+    ASSERT_EQ(t_maxN.m_value, t_paranoid.m_value);
+}
+
+
+TEST(MultiPlayerSearch, Search_BoardRestored_SameHash)
+{
+    const cxbase::Game t_game{classicGame(3, {3, 3, 4})};
+
+    MultiPlayerBoard  t_board{t_game};
+    MultiPlayerSearch t_search{MultiPlayerSearch::Mode::BestReply, 1};
+
+    t_search.search(t_board, NO_LIMIT, 3);
+
+    ASSERT_EQ(t_board.hash(), t_game.hash());
+    ASSERT_EQ(t_board.activePlayer(), 0);
+}
+
+
+TEST(MultiPlayerSearch, Search_LargestBoardFourPlayers_AnswersWithinBudget)
+{
+    cxbase::Game t_game{players(4), std::make_shared<cxbase::GameBoard>(64, 64), 4};
+
+    t_game.makeMove(cxbase::Column{31});
+    t_game.makeMove(cxbase::Column{32});
+
+    const std::chrono::milliseconds t_budget{200};
+
+    for(const auto mode : ALL_MODES)
+    {
+        MultiPlayerSearch t_search{mode, 1};
+
+        const auto t_start = std::chrono::steady_clock::now();
+
+        const MultiPlayerSearch::Result t_result{t_search.search(t_game, t_budget)};
+
+        const auto t_elapsed = std::chrono::steady_clock::now() - t_start;
+
+        ASSERT_GE(t_result.m_column, 0);
+        ASSERT_LT(t_result.m_column, 64);
+        ASSERT_GE(t_result.m_depth, 1);
+        ASSERT_LT(t_elapsed, t_budget + std::chrono::milliseconds{300});
+    }
+}
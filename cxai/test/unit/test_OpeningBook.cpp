@@ -0,0 +1,368 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_OpeningBook.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the OpeningBook and OpeningBookBuilder classes. Books are built for small
+ * boards, which only take a fraction of a second to solve.
+ *
+ **************************************************************************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/OpeningBookBuilder.h>
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::size_t SMALL_TABLE{100003};
+const std::string BOOK_FILE  {"cxai_test_OpeningBook.book"};
+const std::string CLASSIC_BOOK_FILE{std::string{CXAI_TEST_BOOKS_DIR} + "/connect4_6x7.book"};
+
+/***********************************************************************************************//**
+ * Builds and opens a 4 by 5, connect three book of the positions with up to four (4) moves.
+ *
+ **************************************************************************************************/
+class OpeningBookTest : public ::testing::Test
+{
+
+protected:
+
+    void SetUp() override
+    {
+        OpeningBookBuilder builder{4, 5, 3, 4};
+
+        builder.build(2, SMALL_TABLE);
+
+        cxutil::ReturnCode written{builder.write(BOOK_FILE)};
+        ASSERT_TRUE(written.isOk());
+
+        cxutil::ReturnCode opened{m_book.open(BOOK_FILE)};
+        ASSERT_TRUE(opened.isOk());
+    }
+
+    void TearDown() override
+    {
+        m_book.close();
+        std::remove(BOOK_FILE.c_str());
+    }
+
+    OpeningBook m_book;
+
+};
+
+} // unamed namespace
+
+
+TEST(OpeningBook, Constructor_Default_NotOpen)
+{
+    const OpeningBook t_book;
+
+    Solver::Result t_result{-1, 0};
+
+    ASSERT_FALSE(t_book.isOpen());
+    ASSERT_EQ(t_book.size(), 0u);
+    ASSERT_FALSE(t_book.lookup(BitBoard{4, 5, 3}, t_result));
+}
+
+
+TEST(OpeningBook, Open_MissingFile_ErrorReturned)
+{
+    OpeningBook t_book;
+
+    cxutil::ReturnCode t_status{t_book.open("cxai_test_OpeningBook.missing")};
+
+    ASSERT_FALSE(t_status.isOk());
+    ASSERT_FALSE(t_book.isOpen());
+}
+
+
+TEST(OpeningBook, Open_NotABook_ErrorReturned)
+{
+    {
+        std::ofstream t_file{BOOK_FILE, std::ios::binary};
+        t_file << "This text file is long enough to hold a header, but it is not an opening book.";
+    }
+
+    OpeningBook t_book;
+
+    cxutil::ReturnCode t_status{t_book.open(BOOK_FILE)};
+
+    ASSERT_FALSE(t_status.isOk());
+    ASSERT_FALSE(t_book.isOpen());
+
+    std::remove(BOOK_FILE.c_str());
+}
+
+
+TEST(OpeningBookBuilder, Constructor_TooManyMoves_ExceptionThrown)
+{
+    ASSERT_THROW((OpeningBookBuilder{4, 5, 3, 20}), PreconditionException);
+}
+
+
+TEST(OpeningBookBuilder, Constructor_EmptyBoardOnly_OneEntry)
+{
+    const OpeningBookBuilder t_builder{4, 5, 3, 0};
+
+    ASSERT_EQ(t_builder.entries().size(), 1u);
+    ASSERT_FALSE(t_builder.isBuilt());
+}
+
+
+TEST(OpeningBookBuilder, Constructor_FirstMove_MirrorImagesMerged)
+{
+    // The empty board, then Columns 0 and 4, 1 and 3, and the centre Column:
+    const OpeningBookBuilder t_builder{4, 5, 3, 1};
+
+    ASSERT_EQ(t_builder.entries().size(), 4u);
+}
+
+
+TEST_F(OpeningBookTest, Open_BuiltBook_HeaderRead)
+{
+    ASSERT_TRUE(m_book.isOpen());
+    ASSERT_EQ(m_book.nbRows(), 4);
+    ASSERT_EQ(m_book.nbColumns(), 5);
+    ASSERT_EQ(m_book.inARow(), 3);
+    ASSERT_EQ(m_book.maxNbMoves(), 4);
+    ASSERT_GT(m_book.size(), 1u);
+}
+
+
+TEST_F(OpeningBookTest, Open_EntryCountOverflowingFileSize_ErrorReturned)
+{
+    m_book.close();
+
+    // An entry count whose size in bytes wraps around to the real one:
+    std::uint64_t t_nbEntries{0};
+
+    {
+        std::ifstream t_file{BOOK_FILE, std::ios::binary};
+        t_file.seekg(offsetof(OpeningBook::Header, m_nbEntries));
+        t_file.read(reinterpret_cast<char*>(&t_nbEntries), sizeof(t_nbEntries));
+    }
+
+    t_nbEntries += std::uint64_t{1} << 63;
+
+    {
+        std::fstream t_file{BOOK_FILE, std::ios::binary | std::ios::in | std::ios::out};
+        t_file.seekp(offsetof(OpeningBook::Header, m_nbEntries));
+        t_file.write(reinterpret_cast<const char*>(&t_nbEntries), sizeof(t_nbEntries));
+    }
+
+    cxutil::ReturnCode t_status{m_book.open(BOOK_FILE)};
+
+    ASSERT_FALSE(t_status.isOk());
+    ASSERT_FALSE(m_book.isOpen());
+}
+
+
+TEST_F(OpeningBookTest, Lookup_BookPositions_SolverResults)
+{
+    Solver t_solver{SMALL_TABLE};
+
+    // Every sequence of up to four (4) moves, unless a Player can win on the next move:
+    std::vector<BitBoard> t_positions{BitBoard{4, 5, 3}};
+
+    for(std::size_t index{0}; index < t_positions.size(); ++index)
+    {
+        const BitBoard t_board{t_positions[index]};
+
+        if(t_board.canWinNext())
+        {
+            continue;
+        }
+
+        Solver::Result t_result{-1, 0};
+
+        ASSERT_TRUE(m_book.lookup(t_board, t_result));
+        ASSERT_EQ(t_result.m_score, t_solver.solve(t_board));
+
+        // The Column reaches the score:
+        ASSERT_TRUE(t_board.canPlay(t_result.m_column));
+
+        BitBoard t_next{t_board};
+        t_next.play(t_result.m_column);
+
+        ASSERT_EQ(-t_solver.solve(t_next), t_result.m_score);
+
+        if(t_board.nbMoves() < m_book.maxNbMoves())
+        {
+            for(int column{0}; column < t_board.nbColumns(); ++column)
+            {
+                if(t_board.canPlay(column))
+                {
+                    BitBoard t_child{t_board};
+                    t_child.play(column);
+
+                    t_positions.push_back(t_child);
+                }
+            }
+        }
+    }
+}
+
+
+TEST_F(OpeningBookTest, Lookup_MirrorImage_MirroredColumn)
+{
+    BitBoard t_board{4, 5, 3};
+    t_board.play("12");
+
+    BitBoard t_mirror{4, 5, 3};
+    t_mirror.play("54");
+
+    Solver::Result t_result{-1, 0};
+    Solver::Result t_mirrorResult{-1, 0};
+
+    ASSERT_TRUE(m_book.lookup(t_board, t_result));
+    ASSERT_TRUE(m_book.lookup(t_mirror, t_mirrorResult));
+
+    ASSERT_EQ(t_result.m_score, t_mirrorResult.m_score);
+    ASSERT_EQ(t_result.m_column, 4 - t_mirrorResult.m_column);
+}
+
+
+TEST_F(OpeningBookTest, Lookup_TooManyMoves_NotFound)
+{
+    BitBoard t_board{4, 5, 3};
+    t_board.play("12345");
+
+    Solver::Result t_result{-1, 0};
+
+    ASSERT_FALSE(m_book.lookup(t_board, t_result));
+    ASSERT_EQ(t_result.m_column, -1);
+}
+
+
+TEST_F(OpeningBookTest, Lookup_OtherBoardShape_NotFound)
+{
+    Solver::Result t_result{-1, 0};
+
+    ASSERT_FALSE(m_book.lookup(BitBoard{5, 4, 3}, t_result));
+    ASSERT_FALSE(m_book.lookup(BitBoard{4, 5, 4}, t_result));
+}
+
+
+TEST_F(OpeningBookTest, Lookup_GameOfOtherBoardShape_NotFound)
+{
+    auto t_gameboard = std::make_shared<cxbase::GameBoard>();
+    const std::vector<std::shared_ptr<cxbase::Player>> t_players{
+        std::make_shared<cxbase::Player>(cxutil::Name{"First Player" }, cxbase::Disc::blackDisc()),
+        std::make_shared<cxbase::Player>(cxutil::Name{"Second Player"}, cxbase::Disc::redDisc())
+    };
+
+    const cxbase::Game t_game{t_players, t_gameboard, 4};
+
+    Solver::Result t_result{-1, 0};
+
+    ASSERT_FALSE(m_book.lookup(t_game, t_result));
+}
+
+
+TEST(OpeningBook, Lookup_ClassicGames_ShippedBookResults)
+{
+    OpeningBook t_book;
+
+    ASSERT_TRUE(t_book.open(CLASSIC_BOOK_FILE).isOk());
+    ASSERT_EQ(t_book.maxNbMoves(), 1);
+
+    const std::vector<std::shared_ptr<cxbase::Player>> t_players{
+        std::make_shared<cxbase::Player>(cxutil::Name{"First Player" }, cxbase::Disc::blackDisc()),
+        std::make_shared<cxbase::Player>(cxutil::Name{"Second Player"}, cxbase::Disc::redDisc())
+    };
+
+    // The first Player wins by starting in the middle Column:
+    const cxbase::Game t_empty{t_players, std::make_shared<cxbase::GameBoard>(), 4};
+
+    Solver::Result t_result{-1, 0};
+
+    ASSERT_TRUE(t_book.lookup(t_empty, t_result));
+    ASSERT_EQ(t_result.m_score, 1);
+    ASSERT_EQ(t_result.m_column, 3);
+
+    // Starting in the leftmost or the rightmost Column are mirror images:
+    cxbase::Game t_left {t_players, std::make_shared<cxbase::GameBoard>(), 4};
+    cxbase::Game t_right{t_players, std::make_shared<cxbase::GameBoard>(), 4};
+
+    t_left.makeMove(cxbase::Column{0});
+    t_right.makeMove(cxbase::Column{6});
+
+    Solver::Result t_leftResult {-1, 0};
+    Solver::Result t_rightResult{-1, 0};
+    Solver::Result t_boardResult{-1, 0};
+
+    ASSERT_TRUE(t_book.lookup(t_left, t_leftResult));
+    ASSERT_TRUE(t_book.lookup(t_right, t_rightResult));
+    ASSERT_TRUE(t_book.lookup(BitBoard::fromGame(t_left), t_boardResult));
+
+    ASSERT_EQ(t_leftResult.m_score, t_rightResult.m_score);
+    ASSERT_EQ(t_leftResult.m_column, 6 - t_rightResult.m_column);
+    ASSERT_EQ(t_leftResult.m_score, t_boardResult.m_score);
+    ASSERT_EQ(t_leftResult.m_column, t_boardResult.m_column);
+
+    // Two (2) moves are past the book:
+    t_left.makeMove(cxbase::Column{3});
+
+    ASSERT_FALSE(t_book.lookup(t_left, t_leftResult));
+}
+
+
+TEST_F(OpeningBookTest, Analyze_WithBook_SameResultsAsWithout)
+{
+    Solver t_plain{SMALL_TABLE};
+    Solver t_booked{SMALL_TABLE};
+
+    t_booked.setOpeningBook(&m_book);
+
+    for(const char* t_sequence : {"", "3", "33", "324", "3241", "32415", "324153"})
+    {
+        BitBoard t_board{4, 5, 3};
+        t_board.play(t_sequence);
+
+        if(t_board.canWinNext())
+        {
+            continue;
+        }
+
+        ASSERT_EQ(t_booked.solve(t_board), t_plain.solve(t_board));
+        ASSERT_EQ(t_booked.analyze(t_board).m_score, t_plain.analyze(t_board).m_score);
+    }
+}
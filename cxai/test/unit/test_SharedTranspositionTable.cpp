@@ -0,0 +1,307 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    test_SharedTranspositionTable.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the SharedTranspositionTable class.
+ *
+ **************************************************************************************************/
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/SharedTranspositionTable.h>
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+using Entry = SharedTranspositionTable::Entry;
+using Bound = SharedTranspositionTable::Bound;
+
+// Keys sharing the bucket of a key in a one (1) MiB table:
+std::uint64_t sameBucket(std::uint64_t p_key, std::uint64_t p_index)
+{
+    return p_key + p_index * 16384u;
+}
+
+} // unamed namespace
+
+
+TEST(SharedTranspositionTable, Constructor_OneMiB_CacheLineBuckets)
+{
+    const SharedTranspositionTable t_table{1};
+
+    ASSERT_EQ(t_table.nbBuckets(), 16384u);
+    ASSERT_EQ(t_table.nbEntries(), 16384u * SharedTranspositionTable::nbEntriesPerBucket());
+    ASSERT_EQ(t_table.sizeInBytes(), 1024u * 1024u);
+}
+
+
+TEST(SharedTranspositionTable, Constructor_NoMemory_ExceptionThrown)
+{
+    ASSERT_THROW(SharedTranspositionTable{0}, PreconditionException);
+}
+
+
+TEST(SharedTranspositionTable, Probe_EmptyTable_NotFound)
+{
+    const SharedTranspositionTable t_table{1};
+
+    Entry t_entry;
+
+    ASSERT_FALSE(t_table.probe(0, t_entry));
+    ASSERT_FALSE(t_table.probe(123456789, t_entry));
+}
+
+
+TEST(SharedTranspositionTable, Store_ThenProbe_SameEntry)
+{
+    SharedTranspositionTable t_table{1};
+
+    t_table.store(42, Entry{-1234, 17, Bound::Lower, 5});
+    t_table.store(43, Entry{65536, 0, Bound::Exact, -1});
+
+    Entry t_entry;
+
+    ASSERT_TRUE(t_table.probe(42, t_entry));
+    ASSERT_EQ(t_entry.m_value, -1234);
+    ASSERT_EQ(t_entry.m_depth, 17);
+    ASSERT_EQ(t_entry.m_bound, Bound::Lower);
+    ASSERT_EQ(t_entry.m_move, 5);
+
+    ASSERT_TRUE(t_table.probe(43, t_entry));
+    ASSERT_EQ(t_entry.m_value, 65536);
+    ASSERT_EQ(t_entry.m_move, -1);
+
+    ASSERT_FALSE(t_table.probe(sameBucket(42, 1), t_entry));
+}
+
+
+TEST(SharedTranspositionTable, Store_SameKeyShallower_DeeperResultKept)
+{
+    SharedTranspositionTable t_table{1};
+
+    t_table.store(42, Entry{10, 8, Bound::Lower, 3});
+    t_table.store(42, Entry{20, 2, Bound::Upper, -1});
+
+    Entry t_entry;
+
+    ASSERT_TRUE(t_table.probe(42, t_entry));
+    ASSERT_EQ(t_entry.m_value, 10);
+
+    // Exact values always replace:
+    t_table.store(42, Entry{30, 2, Bound::Exact, -1});
+
+    ASSERT_TRUE(t_table.probe(42, t_entry));
+    ASSERT_EQ(t_entry.m_value, 30);
+    ASSERT_EQ(t_entry.m_move, 3);
+}
+
+
+TEST(SharedTranspositionTable, Store_FullBucket_ShallowestEntryReplaced)
+{
+    SharedTranspositionTable t_table{1};
+
+    const int t_depths[]{5, 1, 7, 3};
+
+    for(std::uint64_t index{0}; index < 4; ++index)
+    {
+        t_table.store(sameBucket(42, index), Entry{0, t_depths[index], Bound::Exact, -1});
+    }
+
+    t_table.store(sameBucket(42, 4), Entry{0, 4, Bound::Exact, -1});
+
+    Entry t_entry;
+
+    ASSERT_FALSE(t_table.probe(sameBucket(42, 1), t_entry));
+    ASSERT_TRUE(t_table.probe(sameBucket(42, 0), t_entry));
+    ASSERT_TRUE(t_table.probe(sameBucket(42, 2), t_entry));
+    ASSERT_TRUE(t_table.probe(sameBucket(42, 3), t_entry));
+    ASSERT_TRUE(t_table.probe(sameBucket(42, 4), t_entry));
+    ASSERT_EQ(t_table.statistics().m_nbCollisions, 1u);
+}
+
+
+TEST(SharedTranspositionTable, NewSearch_FullBucket_OldEntriesReplacedFirst)
+{
+    SharedTranspositionTable t_table{1};
+
+    for(std::uint64_t index{0}; index < 4; ++index)
+    {
+        t_table.store(sameBucket(42, index), Entry{0, index == 2 ? 10 : 40, Bound::Exact, -1});
+    }
+
+    t_table.newSearch();
+
+    // Not a collision: the replaced entry is from a previous search.
+    t_table.store(sameBucket(42, 4), Entry{0, 1, Bound::Exact, -1});
+
+    Entry t_entry;
+
+    ASSERT_FALSE(t_table.probe(sameBucket(42, 2), t_entry));
+    ASSERT_TRUE(t_table.probe(sameBucket(42, 4), t_entry));
+    ASSERT_EQ(t_table.statistics().m_nbCollisions, 0u);
+}
+
+
+TEST(SharedTranspositionTable, Statistics_SomeProbes_RatesComputed)
+{
+    SharedTranspositionTable t_table{1};
+
+    t_table.store(1, Entry{0, 1, Bound::Exact, -1});
+
+    Entry t_entry;
+
+    t_table.probe(1, t_entry);
+    t_table.probe(2, t_entry);
+    t_table.probe(3, t_entry);
+    t_table.probe(1, t_entry);
+
+    const SharedTranspositionTable::Statistics t_statistics{t_table.statistics()};
+
+    ASSERT_EQ(t_statistics.m_nbProbes, 4u);
+    ASSERT_EQ(t_statistics.m_nbHits, 2u);
+    ASSERT_EQ(t_statistics.m_nbStores, 1u);
+    ASSERT_DOUBLE_EQ(t_statistics.hitRate(), 0.5);
+    ASSERT_DOUBLE_EQ(t_statistics.collisionRate(), 0.0);
+
+    t_table.resetStatistics();
+
+    ASSERT_EQ(t_table.statistics().m_nbProbes, 0u);
+}
+
+
+TEST(SharedTranspositionTable, Statistics_ManyThreads_CountsAddedUp)
+{
+    SharedTranspositionTable t_table{1};
+
+    // Each thread counts on its own, and every count shows in the total:
+    auto t_work = [&t_table](std::uint64_t p_seed)
+    {
+        Entry t_entry;
+
+        for(std::uint64_t i{0}; i < 1000; ++i)
+        {
+            t_table.store(p_seed * 1000 + i, Entry{0, 1, Bound::Exact, -1});
+            t_table.probe(p_seed * 1000 + i, t_entry);
+            t_table.probe(p_seed * 1000 + i + 500000, t_entry);
+        }
+    };
+
+    std::vector<std::thread> t_threads;
+
+    for(std::uint64_t seed{0}; seed < 4; ++seed)
+    {
+        t_threads.emplace_back(t_work, seed);
+    }
+
+    for(std::thread& thread : t_threads)
+    {
+        thread.join();
+    }
+
+    const SharedTranspositionTable::Statistics t_statistics{t_table.statistics()};
+
+    ASSERT_EQ(t_statistics.m_nbStores, 4000u);
+    ASSERT_EQ(t_statistics.m_nbProbes, 8000u);
+    ASSERT_EQ(t_statistics.m_nbHits, 4000u);
+}
+
+
+TEST(SharedTranspositionTable, FillRate_HalfTheSampledEntries_OneHalf)
+{
+    SharedTranspositionTable t_table{1};
+
+    ASSERT_DOUBLE_EQ(t_table.fillRate(), 0.0);
+
+    // Two entries in each of the first thousand buckets:
+    for(std::uint64_t bucket{0}; bucket < 1000; ++bucket)
+    {
+        t_table.store(sameBucket(bucket, 0), Entry{0, 1, Bound::Exact, -1});
+        t_table.store(sameBucket(bucket, 1), Entry{0, 1, Bound::Exact, -1});
+    }
+
+    ASSERT_DOUBLE_EQ(t_table.fillRate(), 0.5);
+
+    t_table.newSearch();
+
+    ASSERT_DOUBLE_EQ(t_table.fillRate(), 0.0);
+}
+
+
+TEST(SharedTranspositionTable, Probe_ManyThreadsWriting_OnlyVerifiedEntriesFound)
+{
+    SharedTranspositionTable t_table{1};
+
+    std::atomic<bool> t_isCorrupted{false};
+
+    // Every thread stores entries derived from their key, in the same few buckets:
+    auto t_work = [&t_table, &t_isCorrupted](std::uint64_t p_seed)
+    {
+        Entry t_entry;
+
+        for(std::uint64_t i{0}; i < 200000; ++i)
+        {
+            const std::uint64_t t_key{sameBucket(i % 8, (i * 7 + p_seed) % 64)};
+
+            t_table.store(t_key, Entry{static_cast<int>(t_key), static_cast<int>(t_key % 100), Bound::Exact, static_cast<int>(t_key % 64)});
+
+            if(t_table.probe(sameBucket(i % 8, (i * 13 + p_seed) % 64), t_entry))
+            {
+                const std::uint64_t t_found{sameBucket(i % 8, (i * 13 + p_seed) % 64)};
+
+                if(t_entry.m_value != static_cast<int>(t_found) || t_entry.m_move != static_cast<int>(t_found % 64))
+                {
+                    t_isCorrupted = true;
+                }
+            }
+        }
+    };
+
+    std::vector<std::thread> t_threads;
+
+    for(std::uint64_t seed{0}; seed < 4; ++seed)
+    {
+        t_threads.emplace_back(t_work, seed);
+    }
+
+    for(std::thread& thread : t_threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_FALSE(t_isCorrupted);
+}
@@ -0,0 +1,257 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_Solver.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the Solver class. Scores are checked against a plain minimax search, which is
+ * only practical on small boards or near the end of a Game.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <random>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/Solver.h>
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::size_t SMALL_TABLE{100003};
+
+int immediateWinScore(const BitBoard& p_board)
+{
+    return (p_board.nbPositions() + 1 - p_board.nbMoves()) / 2;
+}
+
+
+int minimax(const BitBoard& p_board, std::unordered_map<std::uint64_t, int>& p_cache)
+{
+    if(p_board.nbMoves() == p_board.nbPositions())
+    {
+        return 0;
+    }
+
+    const auto cached = p_cache.find(p_board.key());
+
+    if(cached != p_cache.end())
+    {
+        return cached->second;
+    }
+
+    int best{-p_board.nbPositions()};
+
+    for(int column{0}; column < p_board.nbColumns(); ++column)
+    {
+        if(p_board.canPlay(column))
+        {
+            if(p_board.isWinningMove(column))
+            {
+                best = immediateWinScore(p_board);
+                break;
+            }
+
+            BitBoard next{p_board};
+            next.play(column);
+
+            best = std::max(best, -minimax(next, p_cache));
+        }
+    }
+
+    p_cache[p_board.key()] = best;
+
+    return best;
+}
+
+
+int minimax(const BitBoard& p_board)
+{
+    std::unordered_map<std::uint64_t, int> cache;
+
+    return minimax(p_board, cache);
+}
+
+
+BitBoard randomPosition(int p_nbRows, int p_nbColumns, int p_inARow, int p_nbMoves, unsigned int p_seed)
+{
+    BitBoard     board{p_nbRows, p_nbColumns, p_inARow};
+    std::mt19937 engine{p_seed};
+
+    for(int attempt{0}; board.nbMoves() < p_nbMoves && attempt < 1000; ++attempt)
+    {
+        const int column{static_cast<int>(engine() % static_cast<unsigned int>(p_nbColumns))};
+
+        if(board.canPlay(column) && !board.isWinningMove(column))
+        {
+            board.play(column);
+        }
+    }
+
+    return board;
+}
+
+} // unamed namespace
+
+
+TEST(Solver, Constructor_NoThread_ExceptionThrown)
+{
+    ASSERT_THROW((Solver{SMALL_TABLE, 0}), PreconditionException);
+}
+
+
+TEST(Solver, Solve_SmallEmptyBoards_SameAsMinimax)
+{
+    Solver t_solver{SMALL_TABLE};
+
+    for(const auto& shape : {std::vector<int>{3, 4, 3}, std::vector<int>{4, 4, 3}, std::vector<int>{3, 5, 3}, std::vector<int>{4, 4, 2}})
+    {
+        const BitBoard t_board{shape[0], shape[1], shape[2]};
+
+        ASSERT_EQ(t_solver.solve(t_board), minimax(t_board));
+    }
+}
+
+
+TEST(Solver, Solve_SmallBoardPositions_SameAsMinimax)
+{
+    Solver t_solver{SMALL_TABLE};
+
+    for(const char* sequence : {"1", "3", "12", "2233", "4141", "2413", "332211"})
+    {
+        BitBoard t_board{4, 5, 3};
+        t_board.play(sequence);
+
+        ASSERT_EQ(t_solver.solve(t_board), minimax(t_board)) << sequence;
+    }
+}
+
+
+TEST(Solver, Solve_ClassicBoardEndgames_SameAsMinimax)
+{
+    Solver t_solver{SMALL_TABLE};
+
+    for(unsigned int seed{1}; seed <= 10; ++seed)
+    {
+        const BitBoard t_board{randomPosition(6, 7, 4, 24, seed)};
+
+        ASSERT_EQ(t_solver.solve(t_board), minimax(t_board)) << seed;
+    }
+}
+
+
+TEST(Solver, Solve_ImmediateWin_HighestScoreForMove)
+{
+    Solver t_solver{SMALL_TABLE};
+    BitBoard t_board{6, 7, 4};
+
+    t_board.play("121212");
+
+    ASSERT_EQ(t_solver.solve(t_board), 18);
+    ASSERT_EQ(t_solver.solve(t_board), Solver::maxScore(t_board));
+}
+
+
+TEST(Solver, Analyze_ImmediateWin_WinningColumn)
+{
+    Solver t_solver{SMALL_TABLE};
+    BitBoard t_board{6, 7, 4};
+
+    t_board.play("415263");
+
+    const Solver::Result t_result{t_solver.analyze(t_board)};
+
+    ASSERT_EQ(t_result.m_column, 6);
+    ASSERT_EQ(t_result.m_score, immediateWinScore(t_board));
+}
+
+
+TEST(Solver, Analyze_Endgames_ColumnReachesScore)
+{
+    Solver t_solver{SMALL_TABLE};
+
+    for(unsigned int seed{1}; seed <= 10; ++seed)
+    {
+        for(const BitBoard& t_board : {randomPosition(6, 7, 4, 24, seed), randomPosition(4, 5, 3, 4, seed)})
+        {
+            const Solver::Result t_result{t_solver.analyze(t_board)};
+
+            ASSERT_EQ(t_result.m_score, minimax(t_board)) << seed;
+            ASSERT_TRUE(t_board.canPlay(t_result.m_column));
+
+            if(!t_board.isWinningMove(t_result.m_column))
+            {
+                BitBoard t_next{t_board};
+                t_next.play(t_result.m_column);
+
+                ASSERT_EQ(-minimax(t_next), t_result.m_score) << seed;
+            }
+        }
+    }
+}
+
+
+TEST(Solver, Reset_AfterSolve_NoExploredNodes)
+{
+    Solver t_solver{SMALL_TABLE};
+    const BitBoard t_board{4, 4, 3};
+
+    t_solver.solve(t_board);
+    ASSERT_GT(t_solver.nbExploredNodes(), 0u);
+
+    t_solver.reset();
+    ASSERT_EQ(t_solver.nbExploredNodes(), 0u);
+}
+
+
+TEST(Solver, Analyze_FourThreads_SameResultsAsOneThread)
+{
+    Solver t_single{SMALL_TABLE};
+    Solver t_parallel{SMALL_TABLE, 4};
+
+    ASSERT_EQ(t_parallel.nbThreads(), 4);
+
+    for(unsigned int seed{1}; seed <= 10; ++seed)
+    {
+        const BitBoard t_board{randomPosition(6, 7, 4, 20, seed)};
+
+        const Solver::Result t_expected{t_single.analyze(t_board)};
+        const Solver::Result t_result  {t_parallel.analyze(t_board)};
+
+        ASSERT_EQ(t_result.m_score, t_expected.m_score) << seed;
+        ASSERT_EQ(t_result.m_column, t_expected.m_column) << seed;
+        ASSERT_EQ(t_parallel.solve(t_board), t_expected.m_score) << seed;
+    }
+
+    ASSERT_GT(t_parallel.nbExploredNodes(), 0u);
+}
@@ -0,0 +1,388 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_Tablebase.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the Tablebase and TablebaseGenerator classes. Outcomes are checked against
+ * the Solver on a board small enough to be checked exhaustively.
+ *
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/Solver.h>
+#include <include/TablebaseGenerator.h>
+
+
+using namespace cxai;
+
+
+namespace
+{
+
+const std::size_t SMALL_TABLE   {100003};
+const std::string TABLEBASE_FILE{"cxai_test_Tablebase.tb"};
+
+/***********************************************************************************************//**
+ * Generates and opens the 4 by 4, connect three tablebase.
+ *
+ **************************************************************************************************/
+class TablebaseTest : public ::testing::Test
+{
+
+protected:
+
+    void SetUp() override
+    {
+        TablebaseGenerator generator{4, 4, 3};
+
+        cxutil::ReturnCode generated{generator.generate()};
+        ASSERT_TRUE(generated.isOk());
+
+        cxutil::ReturnCode written{generator.write(TABLEBASE_FILE)};
+        ASSERT_TRUE(written.isOk());
+
+        cxutil::ReturnCode opened{m_tablebase.open(TABLEBASE_FILE)};
+        ASSERT_TRUE(opened.isOk());
+    }
+
+    void TearDown() override
+    {
+        m_tablebase.close();
+        std::remove(TABLEBASE_FILE.c_str());
+    }
+
+    Tablebase m_tablebase;
+
+};
+
+} // unamed namespace
+
+
+TEST(Tablebase, EncodeDecode_AnyResult_SameResult)
+{
+    for(const Tablebase::Outcome t_outcome : {Tablebase::Outcome::Loss, Tablebase::Outcome::Draw, Tablebase::Outcome::Win})
+    {
+        for(int t_distance{0}; t_distance <= 56; ++t_distance)
+        {
+            const Tablebase::Result t_result{Tablebase::decode(Tablebase::encode(Tablebase::Result{t_outcome, t_distance}))};
+
+            ASSERT_TRUE(t_result.m_outcome == t_outcome);
+            ASSERT_EQ(t_result.m_distance, t_distance);
+        }
+    }
+}
+
+
+TEST(Tablebase, ThroughMove_OpponentLoses_Win)
+{
+    const Tablebase::Result t_result{Tablebase::throughMove(Tablebase::Result{Tablebase::Outcome::Loss, 4})};
+
+    ASSERT_TRUE(t_result.m_outcome == Tablebase::Outcome::Win);
+    ASSERT_EQ(t_result.m_distance, 5);
+}
+
+
+TEST(Tablebase, Rank_Results_FastWinsFirstSlowLossesLast)
+{
+    const int t_fastWin {Tablebase::rank(Tablebase::Result{Tablebase::Outcome::Win,  1})};
+    const int t_slowWin {Tablebase::rank(Tablebase::Result{Tablebase::Outcome::Win,  9})};
+    const int t_draw    {Tablebase::rank(Tablebase::Result{Tablebase::Outcome::Draw, 9})};
+    const int t_slowLoss{Tablebase::rank(Tablebase::Result{Tablebase::Outcome::Loss, 8})};
+    const int t_fastLoss{Tablebase::rank(Tablebase::Result{Tablebase::Outcome::Loss, 2})};
+
+    ASSERT_GT(t_fastWin, t_slowWin);
+    ASSERT_GT(t_slowWin, t_draw);
+    ASSERT_GT(t_draw, t_slowLoss);
+    ASSERT_GT(t_slowLoss, t_fastLoss);
+}
+
+
+TEST(Tablebase, Open_MissingFile_ErrorReturned)
+{
+    Tablebase t_tablebase;
+
+    cxutil::ReturnCode t_status{t_tablebase.open("cxai_test_Tablebase.missing")};
+
+    ASSERT_FALSE(t_status.isOk());
+    ASSERT_FALSE(t_tablebase.isOpen());
+    ASSERT_EQ(t_tablebase.size(), 0u);
+}
+
+
+TEST(TablebaseGenerator, Generate_TooManyPositions_ErrorReturned)
+{
+    TablebaseGenerator t_generator{4, 4, 3};
+
+    cxutil::ReturnCode t_status{t_generator.generate(1000)};
+
+    ASSERT_FALSE(t_status.isOk());
+    ASSERT_FALSE(t_generator.isGenerated());
+    ASSERT_EQ(t_generator.size(), 0u);
+}
+
+
+TEST(TablebaseGenerator, Generate_TinyBoard_EveryPositionCounted)
+{
+    // A single Row of three (3) Columns, connect two: the empty board, three (3) positions
+    // with one Disc, six (6) with two and the full board in which the first Player's Discs are
+    // not adjacent. The first Player wins by starting in the middle.
+    TablebaseGenerator t_generator{1, 3, 2};
+
+    cxutil::ReturnCode t_status{t_generator.generate()};
+
+    ASSERT_TRUE(t_status.isOk());
+    ASSERT_EQ(t_generator.size(), 11u);
+    ASSERT_EQ(t_generator.nbPositions(Tablebase::Outcome::Win),  5u);
+    ASSERT_EQ(t_generator.nbPositions(Tablebase::Outcome::Draw), 5u);
+    ASSERT_EQ(t_generator.nbPositions(Tablebase::Outcome::Loss), 1u);
+}
+
+
+TEST(TablebaseGenerator, Write_GeneratedTablebase_KeysStoredWithoutDirectoryBits)
+{
+    TablebaseGenerator t_generator{4, 4, 3};
+
+    ASSERT_TRUE(t_generator.generate().isOk());
+    ASSERT_TRUE(t_generator.write(TABLEBASE_FILE).isOk());
+
+    std::ifstream t_file{TABLEBASE_FILE, std::ios::binary | std::ios::ate};
+
+    Tablebase::Header t_header;
+
+    const std::size_t t_fileSize{static_cast<std::size_t>(t_file.tellg())};
+
+    t_file.seekg(0);
+    t_file.read(reinterpret_cast<char*>(&t_header), sizeof(t_header));
+    t_file.close();
+
+    std::remove(TABLEBASE_FILE.c_str());
+
+    // The 20 key bits, less the directory bits, fit in two (2) bytes:
+    ASSERT_EQ(t_header.m_keyBytes, (20 - t_header.m_directoryBits + 7) / 8);
+    ASSERT_LE(t_header.m_keyBytes, 2);
+
+    const std::size_t t_directorySize{((std::size_t{1} << t_header.m_directoryBits) + 1) * sizeof(std::uint64_t)};
+
+    ASSERT_EQ(t_fileSize, sizeof(t_header) + t_directorySize + t_generator.size() * (t_header.m_keyBytes + 1u));
+}
+
+
+TEST(Tablebase, Probe_ClassicGame_SameAsBitBoard)
+{
+    // On the classic board, connect two is the only rule small enough to generate quickly: the
+    // first Player wins with its second Disc, whatever the second Player does.
+    TablebaseGenerator t_generator{6, 7, 2};
+
+    ASSERT_TRUE(t_generator.generate().isOk());
+    ASSERT_TRUE(t_generator.write(TABLEBASE_FILE).isOk());
+
+    Tablebase t_tablebase;
+    ASSERT_TRUE(t_tablebase.open(TABLEBASE_FILE).isOk());
+
+    const std::vector<std::shared_ptr<cxbase::Player>> t_players{
+        std::make_shared<cxbase::Player>(cxutil::Name{"First Player" }, cxbase::Disc::blackDisc()),
+        std::make_shared<cxbase::Player>(cxutil::Name{"Second Player"}, cxbase::Disc::redDisc())
+    };
+
+    cxbase::Game t_game{t_players, std::make_shared<cxbase::GameBoard>(), 2};
+
+    const Tablebase::Result t_expected[]{{Tablebase::Outcome::Win,  3},
+                                         {Tablebase::Outcome::Loss, 2},
+                                         {Tablebase::Outcome::Win,  1}};
+
+    for(const Tablebase::Result& t_result : t_expected)
+    {
+        Tablebase::Result t_gameResult {Tablebase::Outcome::Draw, -1};
+        Tablebase::Result t_boardResult{Tablebase::Outcome::Draw, -1};
+
+        ASSERT_TRUE(t_tablebase.probe(t_game, t_gameResult));
+        ASSERT_TRUE(t_tablebase.probe(BitBoard::fromGame(t_game), t_boardResult));
+
+        ASSERT_TRUE(t_gameResult.m_outcome == t_result.m_outcome);
+        ASSERT_EQ(t_gameResult.m_distance, t_result.m_distance);
+        ASSERT_TRUE(t_boardResult.m_outcome == t_result.m_outcome);
+        ASSERT_EQ(t_boardResult.m_distance, t_result.m_distance);
+
+        // The second Disc goes on top of the first one:
+        t_game.makeMove(cxbase::Column{3});
+    }
+
+    t_tablebase.close();
+    std::remove(TABLEBASE_FILE.c_str());
+}
+
+
+TEST(TablebaseGenerator, Write_NotGenerated_ExceptionThrown)
+{
+    const TablebaseGenerator t_generator{4, 4, 3};
+
+    ASSERT_THROW(t_generator.write(TABLEBASE_FILE), PreconditionException);
+}
+
+
+TEST_F(TablebaseTest, Open_GeneratedTablebase_HeaderRead)
+{
+    ASSERT_TRUE(m_tablebase.isOpen());
+    ASSERT_EQ(m_tablebase.nbRows(), 4);
+    ASSERT_EQ(m_tablebase.nbColumns(), 4);
+    ASSERT_EQ(m_tablebase.inARow(), 3);
+    ASSERT_GT(m_tablebase.size(), 1000u);
+}
+
+
+TEST_F(TablebaseTest, Probe_EveryPosition_SolverScores)
+{
+    Solver t_solver{SMALL_TABLE};
+
+    std::vector<BitBoard>             t_positions{BitBoard{4, 4, 3}};
+    std::unordered_set<std::uint64_t> t_visited  {t_positions.front().key()};
+
+    for(std::size_t index{0}; index < t_positions.size(); ++index)
+    {
+        const BitBoard t_board{t_positions[index]};
+
+        Tablebase::Result t_result{Tablebase::Outcome::Draw, -1};
+
+        ASSERT_TRUE(m_tablebase.probe(t_board, t_result));
+
+        // The Solver score, from the number of Discs played before the winning move:
+        const int t_score{(t_board.nbPositions() + 2 - t_board.nbMoves() - t_result.m_distance) / 2};
+
+        switch(t_result.m_outcome)
+        {
+            case Tablebase::Outcome::Win:  ASSERT_EQ(t_solver.solve(t_board),  t_score); break;
+            case Tablebase::Outcome::Loss: ASSERT_EQ(t_solver.solve(t_board), -t_score); break;
+            case Tablebase::Outcome::Draw: ASSERT_EQ(t_solver.solve(t_board),  0);       break;
+        }
+
+        if(t_board.canWinNext())
+        {
+            continue;
+        }
+
+        for(int column{0}; column < t_board.nbColumns(); ++column)
+        {
+            if(t_board.canPlay(column))
+            {
+                BitBoard t_child{t_board};
+                t_child.play(column);
+
+                if(t_visited.insert(t_child.key()).second)
+                {
+                    t_positions.push_back(t_child);
+                }
+            }
+        }
+    }
+
+    ASSERT_EQ(t_positions.size(), m_tablebase.size());
+}
+
+
+TEST_F(TablebaseTest, BestColumn_BothPlayers_GameEndsAsProbed)
+{
+    BitBoard t_board{4, 4, 3};
+
+    Tablebase::Result t_expected{Tablebase::Outcome::Draw, -1};
+    ASSERT_TRUE(m_tablebase.probe(t_board, t_expected));
+
+    int t_nbPlies{0};
+
+    while(t_board.nbMoves() < t_board.nbPositions())
+    {
+        const int t_column{m_tablebase.bestColumn(t_board)};
+
+        ++t_nbPlies;
+
+        if(t_board.isWinningMove(t_column))
+        {
+            break;
+        }
+
+        t_board.play(t_column);
+    }
+
+    ASSERT_EQ(t_nbPlies, t_expected.m_distance);
+
+    // The first Player wins on odd plies:
+    ASSERT_TRUE(t_expected.m_outcome == Tablebase::Outcome::Win);
+    ASSERT_EQ(t_nbPlies % 2, 1);
+}
+
+
+TEST_F(TablebaseTest, Probe_WonPosition_NotFound)
+{
+    BitBoard t_board{4, 4, 3};
+    t_board.play("1122");
+
+    ASSERT_TRUE(t_board.isWinningMove(2));
+    t_board.play(2);
+
+    Tablebase::Result t_result{Tablebase::Outcome::Draw, -1};
+
+    ASSERT_FALSE(m_tablebase.probe(t_board, t_result));
+    ASSERT_EQ(t_result.m_distance, -1);
+}
+
+
+TEST_F(TablebaseTest, BestColumn_PositionNotStored_MinusOne)
+{
+    BitBoard t_won{4, 4, 3};
+    ASSERT_EQ(t_won.play("1122"), 4);
+    ASSERT_TRUE(t_won.isWinningMove(2));
+    t_won.play(2);
+
+    ASSERT_EQ(m_tablebase.bestColumn(t_won), -1);
+    ASSERT_EQ(m_tablebase.bestColumn(BitBoard{4, 5, 3}), -1);
+}
+
+
+TEST_F(TablebaseTest, Probe_OtherBoardShape_NotFound)
+{
+    Tablebase::Result t_result{Tablebase::Outcome::Draw, -1};
+
+    ASSERT_FALSE(m_tablebase.probe(BitBoard{4, 5, 3}, t_result));
+    ASSERT_FALSE(m_tablebase.probe(BitBoard{4, 4, 4}, t_result));
+
+    auto t_gameboard = std::make_shared<cxbase::GameBoard>();
+    const std::vector<std::shared_ptr<cxbase::Player>> t_players{
+        std::make_shared<cxbase::Player>(cxutil::Name{"First Player" }, cxbase::Disc::blackDisc()),
+        std::make_shared<cxbase::Player>(cxutil::Name{"Second Player"}, cxbase::Disc::redDisc())
+    };
+
+    const cxbase::Game t_game{t_players, t_gameboard, 3};
+
+    ASSERT_FALSE(m_tablebase.probe(t_game, t_result));
+}
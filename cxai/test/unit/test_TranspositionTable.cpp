@@ -0,0 +1,93 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_TranspositionTable.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the TranspositionTable class.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/TranspositionTable.h>
+
+
+using namespace cxai;
+
+
+TEST(TranspositionTable, Constructor_ValidSize_EmptyTable)
+{
+    const TranspositionTable t_table{65537};
+
+    ASSERT_EQ(t_table.size(), 65537u);
+    ASSERT_EQ(t_table.get(0), 0);
+    ASSERT_EQ(t_table.get(12345), 0);
+}
+
+
+TEST(TranspositionTable, Constructor_TooSmall_ExceptionThrown)
+{
+    ASSERT_THROW(TranspositionTable{100}, PreconditionException);
+}
+
+
+TEST(TranspositionTable, Put_ThenGet_ValueReturned)
+{
+    TranspositionTable t_table{65537};
+
+    t_table.put(42, 0x1234);
+
+    ASSERT_EQ(t_table.get(42), 0x1234);
+    ASSERT_EQ(t_table.get(43), 0);
+}
+
+
+TEST(TranspositionTable, Put_SameEntry_PreviousKeyReplaced)
+{
+    TranspositionTable t_table{65537};
+
+    const std::uint64_t t_key  {7};
+    const std::uint64_t t_other{7 + 3 * 65537};
+
+    t_table.put(t_key, 1);
+    t_table.put(t_other, 2);
+
+    ASSERT_EQ(t_table.get(t_key), 0);
+    ASSERT_EQ(t_table.get(t_other), 2);
+}
+
+
+TEST(TranspositionTable, Reset_FilledTable_EmptyTable)
+{
+    TranspositionTable t_table{65537};
+
+    t_table.put(42, 1);
+    t_table.reset();
+
+    ASSERT_EQ(t_table.get(42), 0);
+}
@@ -0,0 +1,152 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    benchShapes.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Game shapes and positions shared by the cxbase micro-benchmarks.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <include/DefaultPlayers.h>
+
+#include "benchShapes.h"
+
+
+namespace
+{
+
+typedef std::tuple<int, int, int, int> Shape; // Rows, Columns, inARow value and Players.
+
+const int BOARD_SIZES[][2]{{6, 7}, {8, 9}, {16, 16}, {32, 32}, {64, 64}};
+
+const std::uint32_t SEED{20261017};
+
+
+std::vector<Shape> shapes()
+{
+    std::set<Shape> shapes;
+
+    for(const auto& size : BOARD_SIZES)
+    {
+        shapes.insert(Shape{size[0], size[1], 4, 2});
+    }
+
+    for(int inARow{3}; inARow <= 9; ++inARow)
+    {
+        shapes.insert(Shape{16, 16, inARow, 2});
+    }
+
+    for(int nbPlayers{2}; nbPlayers <= 10; ++nbPlayers)
+    {
+        shapes.insert(Shape{42, 60, 4, nbPlayers});
+    }
+
+    return std::vector<Shape>(shapes.begin(), shapes.end());
+}
+
+} // unamed namespace
+
+
+void bench::boardSizes(benchmark::internal::Benchmark* p_benchmark)
+{
+    p_benchmark->ArgNames({"rows", "columns"});
+
+    for(const auto& size : BOARD_SIZES)
+    {
+        p_benchmark->Args({size[0], size[1]});
+    }
+}
+
+
+void bench::gameShapes(benchmark::internal::Benchmark* p_benchmark)
+{
+    p_benchmark->ArgNames({"rows", "columns", "inARow", "players"});
+
+    for(const Shape& shape : shapes())
+    {
+        p_benchmark->Args({std::get<0>(shape), std::get<1>(shape), std::get<2>(shape), std::get<3>(shape)});
+    }
+}
+
+
+std::shared_ptr<cxbase::GameBoard> bench::emptyGameBoard(const benchmark::State& p_state)
+{
+    return std::make_shared<cxbase::GameBoard>(static_cast<int>(p_state.range(0)), static_cast<int>(p_state.range(1)));
+}
+
+
+std::unique_ptr<cxbase::Game> bench::halfFilledGame(const benchmark::State& p_state)
+{
+    std::unique_ptr<cxbase::Game> game{new cxbase::Game{cxbase::defaultPlayers(static_cast<int>(p_state.range(3))),
+                                                        emptyGameBoard(p_state),
+                                                        static_cast<int>(p_state.range(2))}};
+
+    const int nbColumns{game->gameboard().nbColumns()};
+
+    std::mt19937                       generator{SEED};
+    std::uniform_int_distribution<int> columns{0, nbColumns - 1};
+
+    // A move which wins is taken back. After too many of them, the Game is left as is:
+    int nbAttempts{0};
+
+    while(game->nbOfCompletedMoves() < game->gameboard().nbPositions() / 2 && nbAttempts < 64 * nbColumns)
+    {
+        if(game->makeMove(cxbase::Column{columns(generator)}) && game->isWon())
+        {
+            game->undoMove();
+            ++nbAttempts;
+        }
+    }
+
+    return game;
+}
+
+
+void bench::halfFill(cxbase::GameBoard& p_gameboard)
+{
+    const cxbase::Disc discs[]{cxbase::Disc::blackDisc(), cxbase::Disc::redDisc()};
+
+    std::mt19937                       generator{SEED};
+    std::uniform_int_distribution<int> columns{0, p_gameboard.nbColumns() - 1};
+
+    for(int disc{0}; disc < p_gameboard.nbPositions() / 2;)
+    {
+        const cxbase::Column column{columns(generator)};
+
+        if(!p_gameboard.isColumnFull(column))
+        {
+            p_gameboard.placeDisc(column, discs[disc % 2]);
+            ++disc;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    benchShapes.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Game shapes and positions shared by the cxbase micro-benchmarks.
+ *
+ * Benchmarks are run on a reference shape (the classic 6 by 7, connect four Game for two (2)
+ * players) and on three sweeps around it, one parameter at a time:
+ *
+ *  @li Board sizes from 6 by 7 to 64 by 64, connect four, two (2) players.
+ *  @li @a inARow values from three (3) to nine (9), on a 16 by 16 board, two (2) players.
+ *  @li Two (2) to ten (10) players, connect four, on a 42 by 60 board: its 2520 Positions are
+ *      the smallest number that every number of players divides, as cxbase::Game requires.
+ *
+ * Benchmarks are named after their arguments, for example
+ * <tt>Game_makeMove/rows:6/columns:7/inARow:4/players:2</tt>, so that results can be compared
+ * from one run to the next (see cxscripts/python/CompareBenchmarks.py).
+ *
+ **************************************************************************************************/
+
+#ifndef BENCHSHAPES_H_0D6E3B95_4A27_4C81_9F12_B83E5C7A1D40
+#define BENCHSHAPES_H_0D6E3B95_4A27_4C81_9F12_B83E5C7A1D40
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <include/Game.h>
+
+
+namespace bench
+{
+
+/***********************************************************************************************//**
+ * Registers the board sizes sweep, as @a rows and @a columns arguments.
+ *
+ * @param[in,out] p_benchmark The benchmark.
+ *
+ **************************************************************************************************/
+void boardSizes(benchmark::internal::Benchmark* p_benchmark);
+
+
+/***********************************************************************************************//**
+ * Registers every shape, as @a rows, @a columns, @a inARow and @a players arguments.
+ *
+ * @param[in,out] p_benchmark The benchmark.
+ *
+ **************************************************************************************************/
+void gameShapes(benchmark::internal::Benchmark* p_benchmark);
+
+
+/***********************************************************************************************//**
+ * Creates an empty GameBoard of the size given by the benchmark arguments.
+ *
+ * @param[in] p_state The benchmark state, with arguments registered by @c boardSizes().
+ *
+ * @return The GameBoard.
+ *
+ **************************************************************************************************/
+std::shared_ptr<cxbase::GameBoard> emptyGameBoard(const benchmark::State& p_state);
+
+
+/***********************************************************************************************//**
+ * Creates a Game of the shape given by the benchmark arguments, and fills about half of its
+ * GameBoard with pseudo-random moves, none of them winning. The moves only depend on the
+ * shape, so every run benchmarks the same position.
+ *
+ * @param[in] p_state The benchmark state, with arguments registered by @c gameShapes().
+ *
+ * @return The Game.
+ *
+ **************************************************************************************************/
+std::unique_ptr<cxbase::Game> halfFilledGame(const benchmark::State& p_state);
+
+
+/***********************************************************************************************//**
+ * Fills about half of a GameBoard with pseudo-random Discs, alternating between two (2)
+ * Discs. The Discs only depend on the GameBoard size.
+ *
+ * @param[in,out] p_gameboard The GameBoard, initially empty.
+ *
+ **************************************************************************************************/
+void halfFill(cxbase::GameBoard& p_gameboard);
+
+} // namespace bench
+
+#endif /* BENCHSHAPES_H_0D6E3B95_4A27_4C81_9F12_B83E5C7A1D40 */
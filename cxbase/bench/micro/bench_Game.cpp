@@ -0,0 +1,135 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    bench_Game.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Micro-benchmarks for the Game class. Every benchmark runs on a half filled GameBoard (see
+ * benchShapes.h).
+ *
+ **************************************************************************************************/
+
+#include "benchShapes.h"
+
+
+namespace
+{
+
+/***********************************************************************************************//**
+ * A move and its take back, in every Column in turn. The Game is left as it was, so that each
+ * iteration benchmarks the same position. Full Columns are tried as well: an unsuccessful move
+ * is part of the cost of the rules.
+ *
+ **************************************************************************************************/
+void Game_makeMove(benchmark::State& p_state)
+{
+    const std::unique_ptr<cxbase::Game> game{bench::halfFilledGame(p_state)};
+
+    const int nbColumns{game->gameboard().nbColumns()};
+
+    int column{0};
+
+    for(auto _ : p_state)
+    {
+        if(game->makeMove(cxbase::Column{column}))
+        {
+            game->undoMove();
+        }
+
+        column = column + 1 < nbColumns ? column + 1 : 0;
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(Game_makeMove)->Apply(bench::gameShapes);
+
+
+void Game_isWon(benchmark::State& p_state)
+{
+    const std::unique_ptr<cxbase::Game> game{bench::halfFilledGame(p_state)};
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(game->isWon());
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(Game_isWon)->Apply(bench::gameShapes);
+
+
+void Game_isEarlyDraw(benchmark::State& p_state)
+{
+    const std::unique_ptr<cxbase::Game> game{bench::halfFilledGame(p_state)};
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(game->isEarlyDraw());
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(Game_isEarlyDraw)->Apply(bench::gameShapes);
+
+
+void Game_isDraw(benchmark::State& p_state)
+{
+    const std::unique_ptr<cxbase::Game> game{bench::halfFilledGame(p_state)};
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(game->isDraw());
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(Game_isDraw)->Apply(bench::gameShapes);
+
+void Game_winningColumns(benchmark::State& p_state)
+{
+    const std::unique_ptr<cxbase::Game> game{bench::halfFilledGame(p_state)};
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(game->winningColumns(game->activePlayerIndex()));
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(Game_winningColumns)->Apply(bench::gameShapes);
+
+void Game_evaluation(benchmark::State& p_state)
+{
+    const std::unique_ptr<cxbase::Game> game{bench::halfFilledGame(p_state)};
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(game->evaluation());
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(Game_evaluation)->Apply(bench::gameShapes);
+
+} // unamed namespace
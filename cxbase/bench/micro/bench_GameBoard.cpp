@@ -0,0 +1,112 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    bench_GameBoard.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Micro-benchmarks for the GameBoard class. Every benchmark runs on a half filled GameBoard
+ * (see benchShapes.h).
+ *
+ **************************************************************************************************/
+
+#include "benchShapes.h"
+
+
+namespace
+{
+
+/***********************************************************************************************//**
+ * A Disc placed and removed, in every Column in turn, full Columns excepted. The GameBoard is
+ * left as it was, so that each iteration benchmarks the same position.
+ *
+ **************************************************************************************************/
+void GameBoard_placeDisc(benchmark::State& p_state)
+{
+    const std::shared_ptr<cxbase::GameBoard> gameboard{bench::emptyGameBoard(p_state)};
+    bench::halfFill(*gameboard);
+
+    const cxbase::DiscId disc{gameboard->registerDisc(cxbase::Disc::blackDisc())};
+    const int            nbColumns{gameboard->nbColumns()};
+
+    int column{0};
+
+    for(auto _ : p_state)
+    {
+        if(!gameboard->isColumnFull(cxbase::Column{column}))
+        {
+            gameboard->placeDisc(cxbase::Column{column}, disc);
+            gameboard->removeDisc(cxbase::Column{column});
+        }
+
+        column = column + 1 < nbColumns ? column + 1 : 0;
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(GameBoard_placeDisc)->Apply(bench::boardSizes);
+
+
+void GameBoard_isColumnFull(benchmark::State& p_state)
+{
+    const std::shared_ptr<cxbase::GameBoard> gameboard{bench::emptyGameBoard(p_state)};
+    bench::halfFill(*gameboard);
+
+    const int nbColumns{gameboard->nbColumns()};
+
+    int column{0};
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(gameboard->isColumnFull(cxbase::Column{column}));
+
+        column = column + 1 < nbColumns ? column + 1 : 0;
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(GameBoard_isColumnFull)->Apply(bench::boardSizes);
+
+
+/***********************************************************************************************//**
+ * Two equal GameBoards: every Position has to be compared.
+ *
+ **************************************************************************************************/
+void GameBoard_operatorEqual(benchmark::State& p_state)
+{
+    const std::shared_ptr<cxbase::GameBoard> lhs{bench::emptyGameBoard(p_state)};
+    const std::shared_ptr<cxbase::GameBoard> rhs{bench::emptyGameBoard(p_state)};
+
+    bench::halfFill(*lhs);
+    bench::halfFill(*rhs);
+
+    for(auto _ : p_state)
+    {
+        benchmark::DoNotOptimize(*lhs == *rhs);
+    }
+
+    p_state.SetItemsProcessed(p_state.iterations());
+}
+BENCHMARK(GameBoard_operatorEqual)->Apply(bench::boardSizes);
+
+} // unamed namespace
@@ -0,0 +1,78 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    DefaultPlayers.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a default Players factory and a Game shape check.
+ *
+ **************************************************************************************************/
+
+#ifndef DEFAULTPLAYERS_H_4E56EF62_205D_406C_BDFB_130E4B62F2F2
+#define DEFAULTPLAYERS_H_4E56EF62_205D_406C_BDFB_130E4B62F2F2
+
+#include <memory>
+#include <vector>
+
+#include "Player.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * Creates Players for games set up without user input (tools, benchmarks, etc).
+ *
+ * The Players are named "Player 1", "Player 2", etc. The first six get the black, red, yellow,
+ * blue, green and white Discs, in that order. The next ones get shades of grey.
+ *
+ * @param[in] p_nbPlayers The number of Players.
+ *
+ * @pre The number of Players is not negative.
+ *
+ * @return The Players, in playing order.
+ *
+ **************************************************************************************************/
+std::vector<std::shared_ptr<Player>> defaultPlayers(int p_nbPlayers);
+
+
+/***********************************************************************************************//**
+ * Checks if a Game can be created with some shape, for tools which read it from their user or
+ * from a file.
+ *
+ * @param[in] p_nbRows     The number of Rows of the GameBoard.
+ * @param[in] p_nbColumns  The number of Columns of the GameBoard.
+ * @param[in] p_inARow     The @a inARow value.
+ * @param[in] p_nbPlayers  The number of Players.
+ *
+ * @return @c true if the GameBoard and Game preconditions hold for this shape, @c false
+ *         otherwise.
+ *
+ **************************************************************************************************/
+bool isValidGameShape(int p_nbRows, int p_nbColumns, int p_inARow, int p_nbPlayers);
+
+} // namespace cxbase
+
+#endif /* DEFAULTPLAYERS_H_4E56EF62_205D_406C_BDFB_130E4B62F2F2 */
@@ -0,0 +1,180 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    DiscPalette.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a Disc interning utility.
+ *
+ **************************************************************************************************/
+
+#ifndef DISCPALETTE_H_3F0B6C2E_8D4A_4B57_9E21_6A1C5D7B0E94
+#define DISCPALETTE_H_3F0B6C2E_8D4A_4B57_9E21_6A1C5D7B0E94
+
+#include <cstdint>
+#include <vector>
+
+#include <cxutil/include/ContractException.h>
+
+#include "Disc.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * Compact identifier for a Disc registered in a DiscPalette.
+ *
+ **************************************************************************************************/
+using DiscId = std::uint8_t;
+
+
+/***********************************************************************************************//**
+ * @class DiscPalette
+ *
+ * @brief Interns Discs as small integer identifiers.
+ *
+ * Each distinct Disc registered in a DiscPalette is stored once and given a DiscId. Comparing two
+ * DiscIds is then equivalent to comparing the Discs themselves, without going through their
+ * Colors. The identifier @c noDiscId() is always reserved for @c Disc::noDisc().
+ *
+ * @invariant The palette always contains @c Disc::noDisc() at identifier @c noDiscId().
+ * @invariant The palette never holds more Discs than a DiscId can identify.
+ *
+ **************************************************************************************************/
+class DiscPalette
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default destructor.
+     *
+     **********************************************************************************************/
+    virtual ~DiscPalette();
+
+
+    /*******************************************************************************************//**
+     * Default constructor.
+     *
+     * Constructs a palette containing only @c Disc::noDisc().
+     *
+     **********************************************************************************************/
+    DiscPalette();
+
+///@}
+
+
+///@{ @name Data access
+
+    /*******************************************************************************************//**
+     * Number of registered Discs accessor.
+     *
+     * @return The number of Discs in the palette, @c Disc::noDisc() included.
+     *
+     **********************************************************************************************/
+    std::size_t size() const {return m_discs.size();}
+
+
+    /*******************************************************************************************//**
+     * Checks if a Disc is registered.
+     *
+     * @param[in] p_disc The Disc to look for.
+     *
+     * @return @c true if the Disc is part of the palette, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool contains(const Disc& p_disc) const;
+
+
+    /*******************************************************************************************//**
+     * Identifier accessor.
+     *
+     * @param[in] p_disc The Disc for which the identifier is needed.
+     *
+     * @pre The Disc is part of the palette.
+     *
+     * @return The Disc identifier.
+     *
+     **********************************************************************************************/
+    DiscId id(const Disc& p_disc) const;
+
+
+    /*******************************************************************************************//**
+     * Disc accessor.
+     *
+     * @param[in] p_id A Disc identifier.
+     *
+     * @pre The identifier has been given by the palette.
+     *
+     * @return The Disc associated to the identifier.
+     *
+     **********************************************************************************************/
+    const Disc& disc(DiscId p_id) const;
+
+///@}
+
+
+///@{ @name Palette actions
+
+    /*******************************************************************************************//**
+     * Registers a Disc.
+     *
+     * If the Disc is already part of the palette, its existing identifier is returned. Otherwise,
+     * the Disc is added and given the next available identifier.
+     *
+     * @param[in] p_disc The Disc to register.
+     *
+     * @pre If the Disc is not already registered, the palette is not full.
+     *
+     * @return The Disc identifier.
+     *
+     **********************************************************************************************/
+    DiscId intern(const Disc& p_disc);
+
+///@}
+
+
+///@{ @name Predefined identifiers
+
+    static DiscId noDiscId() {return 0;}
+
+///@}
+
+protected:
+
+    void checkInvariant() const;
+
+private:
+
+    std::vector<Disc> m_discs;  ///< The registered Discs, indexed by identifier.
+
+};
+
+} // namespace cxbase
+
+#endif /* DISCPALETTE_H_3F0B6C2E_8D4A_4B57_9E21_6A1C5D7B0E94 */
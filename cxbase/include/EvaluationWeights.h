@@ -0,0 +1,178 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    EvaluationWeights.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a static evaluation weight table.
+ *
+ **************************************************************************************************/
+
+#ifndef EVALUATIONWEIGHTS_H_D1F044F4_6F4D_423E_8C17_EE65E3645D80
+#define EVALUATIONWEIGHTS_H_D1F044F4_6F4D_423E_8C17_EE65E3645D80
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <cxutil/include/ContractException.h>
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class EvaluationWeights
+ *
+ * @brief The weight of an open window, by number of Discs, for static evaluation.
+ *
+ * An open window is a window of @a inARow Positions (see WinningLines) holding the Discs of a
+ * single Player. The more Discs it holds, the closer this Player is to winning with it. A Game
+ * scores each Player by adding up the weights of its open windows (see Game::score()), which
+ * gives engines and hints a heuristic value for positions that are not over yet.
+ *
+ * EvaluationWeights objects are immutable. Use @c forShape() to get the table for a specific
+ * shape. Unless another table was registered for this shape with @c registerShape(), every
+ * additional Disc in a window weighs four (4) times more than the previous one.
+ *
+ * @invariant There is a weight for every number of Discs from one (1) to @a inARow.
+ *
+ **************************************************************************************************/
+class EvaluationWeights
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default destructor.
+     *
+     **********************************************************************************************/
+    virtual ~EvaluationWeights();
+
+
+    /*******************************************************************************************//**
+     * Constructor with parameters.
+     *
+     * @param[in] p_inARow  The @a inARow value.
+     * @param[in] p_weights The weight of an open window holding one (1) Disc, then two (2)
+     *                      Discs, and so on up to @a inARow Discs.
+     *
+     * @pre @c p_inARow is at least two (2).
+     * @pre There are exactly @a inARow weights.
+     * @pre No weight is negative, so that scores never are.
+     *
+     **********************************************************************************************/
+    EvaluationWeights(int p_inARow, const std::vector<std::int64_t>& p_weights);
+
+
+    /*******************************************************************************************//**
+     * Shared table accessor.
+     *
+     * Gives the table registered for a specific shape or, if there is none, the default table
+     * for its @a inARow value. This method can safely be called from several threads.
+     *
+     * @param[in] p_nbRows      The number of rows in the grid.
+     * @param[in] p_nbColumns   The number of columns in the grid.
+     * @param[in] p_inARow      The @a inARow value.
+     *
+     * @pre @c p_inARow is at least two (2).
+     *
+     * @return The shared table for the shape.
+     *
+     **********************************************************************************************/
+    static std::shared_ptr<const EvaluationWeights> forShape(int p_nbRows, int p_nbColumns, int p_inARow);
+
+
+    /*******************************************************************************************//**
+     * Registers the table to use for a specific shape.
+     *
+     * Games created afterwards for this shape use this table. Existing Games are not affected
+     * (see Game::setEvaluationWeights()). This method can safely be called from several threads.
+     *
+     * @param[in] p_nbRows      The number of rows in the grid.
+     * @param[in] p_nbColumns   The number of columns in the grid.
+     * @param[in] p_weights     The table.
+     *
+     * @pre The table is not @c nullptr.
+     *
+     **********************************************************************************************/
+    static void registerShape(int p_nbRows, int p_nbColumns, const std::shared_ptr<const EvaluationWeights>& p_weights);
+
+///@}
+
+
+///@{ @name Data access
+
+    int inARow() const {return m_inARow;}
+
+
+    /*******************************************************************************************//**
+     * Weight accessor.
+     *
+     * @param[in] p_nbDiscs The number of Discs in an open window.
+     *
+     * @pre The number of Discs is between one (1) and @a inARow.
+     *
+     * @return The weight of the window.
+     *
+     **********************************************************************************************/
+    std::int64_t weight(int p_nbDiscs) const;
+
+
+    /*******************************************************************************************//**
+     * Cumulated weight accessor.
+     *
+     * @param[in] p_nbDiscs A number of Discs.
+     *
+     * @pre The number of Discs is between zero (0) and @a inARow.
+     *
+     * @return The sum of the weights of open windows holding from one (1) to @c p_nbDiscs Discs.
+     *
+     **********************************************************************************************/
+    std::int64_t cumulatedWeight(int p_nbDiscs) const;
+
+///@}
+
+
+protected:
+
+    void checkInvariant() const;
+
+
+private:
+
+    int                       m_inARow;             ///< The @a inARow value.
+    std::vector<std::int64_t> m_cumulatedWeights;   ///< The sum of the weights up to each number
+                                                    ///< of Discs, starting at zero (0).
+
+};
+
+} // namespace cxbase
+
+#endif /* EVALUATIONWEIGHTS_H_D1F044F4_6F4D_423E_8C17_EE65E3645D80 */
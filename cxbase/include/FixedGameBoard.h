@@ -0,0 +1,524 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    FixedGameBoard.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a GameBoard template utility with compile-time dimensions.
+ *
+ **************************************************************************************************/
+
+#ifndef FIXEDGAMEBOARD_H_C81A0F3D_2B6E_4E0C_A7D5_94F2E6B1C378
+#define FIXEDGAMEBOARD_H_C81A0F3D_2B6E_4E0C_A7D5_94F2E6B1C378
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+
+#include <cxutil/include/ContractException.h>
+
+#include "Disc.h"
+#include "DiscPalette.h"
+#include "Position.h"
+#include "WinningLines.h"
+#include "Zobrist.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class FixedGameBoard
+ *
+ * @brief Connect X GameBoard with compile-time dimensions.
+ *
+ * Offers the same public interface as GameBoard, but the number of rows, the number of columns
+ * and the @a inARow value are template parameters. The storage size, the validation limits used
+ * to look for a winning line and the winning-line masks (see @c windowStartRows()) are therefore
+ * all known at compile time, which lets the compiler unroll the hot checks for the common board
+ * shapes. For example, the classic Connect 4 board is:
+ *
+ * @code
+ *     cxbase::FixedGameBoard<6, 7, 4> classicBoard;
+ * @endcode
+ *
+ * Like the runtime GameBoard, each Column of each Disc bitplane is stored in a 64 bits word,
+ * every Position holds the DiscId of the Disc it contains and the Zobrist hashes are maintained
+ * incrementally. Equal FixedGameBoards and GameBoards have the same hashes.
+ *
+ * @tparam NbRows    The number of rows (from 6 to 64).
+ * @tparam NbColumns The number of columns (from 7 to 64).
+ * @tparam InARow    The number of adjacent equal Discs needed for a winning line (at least two
+ *                   (2) and smaller than both dimensions).
+ *
+ * @invariant At most @c NB_DISCS_MAX Discs, @c Disc::noDisc() included, are registered. This
+ *            covers ten (10) Players.
+ * @invariant No Column holds more than @c nbRows() Discs.
+ *
+ * @see GameBoard
+ *
+ **************************************************************************************************/
+template<int NbRows, int NbColumns, int InARow>
+class FixedGameBoard final
+{
+
+    static_assert(NbRows >= 6 && NbRows <= 64, "The number of rows must be between 6 and 64.");
+    static_assert(NbColumns >= 7 && NbColumns <= 64, "The number of columns must be between 7 and 64.");
+    static_assert(InARow >= 2 && InARow < NbRows && InARow < NbColumns, "Invalid in a row value.");
+
+public:
+
+    static const std::size_t NB_DISCS_MAX{11};  ///< Maximum number of Discs, @c Disc::noDisc() included.
+
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default destructor.
+     *
+     **********************************************************************************************/
+    ~FixedGameBoard() = default;
+
+
+    /*******************************************************************************************//**
+     * Default constructor.
+     *
+     * Constructs an empty GameBoard.
+     *
+     **********************************************************************************************/
+    FixedGameBoard();
+
+///@}
+
+
+///@{ @name Data access
+
+    /*******************************************************************************************//**
+     * Accessor for the number of rows in the Gameboard.
+     *
+     * @return The number of rows in the GameBoard.
+     *
+     **********************************************************************************************/
+    static constexpr int nbRows() {return NbRows;}
+
+
+    /*******************************************************************************************//**
+     * Accessor for the number of columns in the GameBoard.
+     *
+     * @return The number of columns in the GameBoard.
+     *
+     **********************************************************************************************/
+    static constexpr int nbColumns() {return NbColumns;}
+
+
+    /*******************************************************************************************//**
+     * Accessor for the number of positions total in the GameBoard.
+     *
+     * @return The number of positions (total) in the GameBoard.
+     *
+     **********************************************************************************************/
+    static constexpr int nbPositions() {return NbRows * NbColumns;}
+
+
+    /*******************************************************************************************//**
+     * Accessor for the @a inARow value the GameBoard is specialized for.
+     *
+     * @return The @a inARow value.
+     *
+     **********************************************************************************************/
+    static constexpr int inARowValue() {return InARow;}
+
+
+    /*******************************************************************************************//**
+     * Accessor for the Discs known to the GameBoard.
+     *
+     * @return The palette in which every Disc used on the GameBoard is registered.
+     *
+     **********************************************************************************************/
+    const DiscPalette& palette() const {return m_palette;}
+
+
+    /*******************************************************************************************//**
+     * Accessor for the identifier of the Disc located at a specific Position.
+     *
+     * @param[in] p_position The Position at which the needed Disc is located on the grid.
+     *
+     * @pre The Position is inside the grid.
+     *
+     * @return The identifier of the Disc located at the Position, @c DiscPalette::noDiscId()
+     *         if the Position is empty.
+     *
+     **********************************************************************************************/
+    DiscId discId(const Position& p_position) const;
+
+
+    /*******************************************************************************************//**
+     * Accessor for the Positions occupied by a Disc in a specific Column.
+     *
+     * @see GameBoard::columnBits()
+     *
+     **********************************************************************************************/
+    std::uint64_t columnBits(DiscId p_discId, const Column& p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Hash accessor.
+     *
+     * @see GameBoard::hash()
+     *
+     **********************************************************************************************/
+    std::uint64_t hash() const {return m_hash;}
+
+
+    /*******************************************************************************************//**
+     * Mirrored hash accessor.
+     *
+     * @see GameBoard::mirroredHash()
+     *
+     **********************************************************************************************/
+    std::uint64_t mirroredHash() const {return m_mirroredHash;}
+
+
+    /*******************************************************************************************//**
+     * Canonical hash accessor.
+     *
+     * @see GameBoard::canonicalHash()
+     *
+     **********************************************************************************************/
+    std::uint64_t canonicalHash() const {return m_mirroredHash < m_hash ? m_mirroredHash : m_hash;}
+
+
+    /*******************************************************************************************//**
+     * Maps a Column between the Grid and its canonical form.
+     *
+     * @see GameBoard::canonicalColumn()
+     *
+     **********************************************************************************************/
+    Column canonicalColumn(const Column& p_column) const;
+
+///@}
+
+
+///@{ @name Gameboard checks and actions
+
+    /*******************************************************************************************//**
+     * Places a Disc in a specific Column.
+     *
+     * @param[in] p_column  The Column where to insert the Disc.
+     * @param[in] p_disc    The Disc to insert.
+     *
+     * @return The Position where the Disc has been placed, if the Column specified as an argument
+     *         is not full, or the Column's top most Position otherwise.
+     *
+     * @pre The Column number is between 0 and the maximum Column number for the GameBoard.
+     * @pre The Disc that is placed is not @c Disc::noDisc().
+     *
+     * @see GameBoard::placeDisc()
+     *
+     **********************************************************************************************/
+    Position placeDisc(const Column& p_column, const Disc& p_disc);
+
+
+    /*******************************************************************************************//**
+     * Places a Disc, by identifier, in a specific Column.
+     *
+     * @param[in] p_column  The Column where to insert the Disc.
+     * @param[in] p_discId  The identifier of the Disc to insert.
+     *
+     * @return The Position where the Disc has been placed, if the Column specified as an argument
+     *         is not full, or the Column's top most Position otherwise.
+     *
+     * @pre The Column number is between 0 and the maximum Column number for the GameBoard.
+     * @pre The identifier has been given by @c registerDisc() and is not
+     *      @c DiscPalette::noDiscId().
+     *
+     **********************************************************************************************/
+    Position placeDisc(const Column& p_column, DiscId p_discId);
+
+
+    /*******************************************************************************************//**
+     * Removes the top most Disc from a specific Column.
+     *
+     * @see GameBoard::removeDisc()
+     *
+     **********************************************************************************************/
+    Position removeDisc(const Column& p_column);
+
+
+    /*******************************************************************************************//**
+     * Registers a Disc in the GameBoard's palette.
+     *
+     * @param[in] p_disc The Disc to register.
+     *
+     * @pre The Disc is not @c Disc::noDisc().
+     * @pre If the Disc is not already registered, less than @c NB_DISCS_MAX Discs are.
+     *
+     * @return The Disc identifier.
+     *
+     **********************************************************************************************/
+    DiscId registerDisc(const Disc& p_disc);
+
+
+    /*******************************************************************************************//**
+     * Checks if a specific Column is full.
+     *
+     * @param[in] p_column  The Column to check.
+     * @pre The Column number is between 0 and the maximum Column number for the GameBoard.
+     *
+     * @return @c true if the Column passed as an argument is full, @c false otherwise.
+     *
+     **********************************************************************************************/
+    bool isColumnFull(const Column& p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Checks if the Disc at a specific Position is part of a winning line.
+     *
+     * A winning line is made of @a inARow adjacent equal Discs, either horizontally, vertically
+     * or diagonally. Only the lines going through the Position are looked at, one 64 bits word
+     * operation per Column.
+     *
+     * @param[in] p_position The Position to check (typically, that of the last placed Disc).
+     *
+     * @pre The Position is inside the grid.
+     *
+     * @return @c true if the Position holds a Disc and is part of a winning line, @c false
+     *         otherwise.
+     *
+     **********************************************************************************************/
+    bool isWinningPosition(const Position& p_position) const;
+
+///@}
+
+
+///@{ @name Operators
+
+    /*******************************************************************************************//**
+     * Equal-to operator.
+     *
+     * Two GameBoards are considered equal <em> if and only if </em> both their Grids are the same.
+     *
+     * @param[in] p_gameBoard The GameBoard with which to compare.
+     *
+     **********************************************************************************************/
+    bool operator==(const FixedGameBoard& p_gameBoard) const;
+
+
+    /*******************************************************************************************//**
+     * Not-equal-to operator.
+     *
+     * @param[in] p_gameBoard The GameBoard with which to compare.
+     *
+     **********************************************************************************************/
+    bool operator!=(const FixedGameBoard& p_gameBoard) const;
+
+
+    /*******************************************************************************************//**
+     * Function operator.
+     *
+     * Gives access to the Disc located at the needed Position on the GameBoard's grid.
+     *
+     * @param[in] p_position The Position at which the needed Disc is located on the grid.
+     *
+     * @see GameBoard::operator()()
+     *
+     **********************************************************************************************/
+    Disc operator()(const Position& p_position) const;
+
+///@}
+
+
+///@{ @name Compile-time geometry
+
+    /*******************************************************************************************//**
+     * Word of a full Column.
+     *
+     * @return A word in which the @c nbRows() least significant bits are set.
+     *
+     **********************************************************************************************/
+    static constexpr std::uint64_t columnMask()
+    {
+        return lowBits(NbRows);
+    }
+
+
+    /*******************************************************************************************//**
+     * Word of a vertical winning line.
+     *
+     * @param[in] p_startRow The lowest Row of the line.
+     *
+     * @return A word in which the @a inARow bits from @c p_startRow up are set.
+     *
+     **********************************************************************************************/
+    static constexpr std::uint64_t verticalLineMask(int p_startRow)
+    {
+        return ((std::uint64_t{1} << InARow) - 1) << p_startRow;
+    }
+
+
+    /*******************************************************************************************//**
+     * Rows a winning line can start at, in its left-most Column (or its lowest Position, for
+     * vertical lines).
+     *
+     * @param[in] p_direction The direction of the line.
+     *
+     * @return A Column word in which the bit of every such Row is set.
+     *
+     **********************************************************************************************/
+    static constexpr std::uint64_t windowStartRows(WinningLines::Direction p_direction)
+    {
+        return p_direction == WinningLines::Direction::Horizontal       ? columnMask() :
+               p_direction == WinningLines::Direction::DiagonalDownward ? lowBits(NbRows - InARow + 1) << (InARow - 1) :
+                                                                          lowBits(NbRows - InARow + 1);
+    }
+
+
+    /*******************************************************************************************//**
+     * Number of Columns a winning line can start at.
+     *
+     * @param[in] p_direction The direction of the line.
+     *
+     **********************************************************************************************/
+    static constexpr int nbWindowStartColumns(WinningLines::Direction p_direction)
+    {
+        return p_direction == WinningLines::Direction::Vertical ? NbColumns : NbColumns - InARow + 1;
+    }
+
+
+    /*******************************************************************************************//**
+     * Number of distinct winning lines (horizontal, vertical and diagonal) on the GameBoard,
+     * the same as WinningLines::nbWindows() for the shape.
+     *
+     **********************************************************************************************/
+    static constexpr int nbWinningLines()
+    {
+        return nbBits(windowStartRows(WinningLines::Direction::Horizontal))       * nbWindowStartColumns(WinningLines::Direction::Horizontal) +
+               nbBits(windowStartRows(WinningLines::Direction::Vertical))         * nbWindowStartColumns(WinningLines::Direction::Vertical)   +
+               nbBits(windowStartRows(WinningLines::Direction::DiagonalUpward))   * nbWindowStartColumns(WinningLines::Direction::DiagonalUpward) +
+               nbBits(windowStartRows(WinningLines::Direction::DiagonalDownward)) * nbWindowStartColumns(WinningLines::Direction::DiagonalDownward);
+    }
+
+
+    /*******************************************************************************************//**
+     * Left-most Column a winning line going through a Column can start at.
+     *
+     **********************************************************************************************/
+    static constexpr int leftValidationLimit(int p_column)
+    {
+        return p_column - (InARow - 1) > 0 ? p_column - (InARow - 1) : 0;
+    }
+
+
+    /*******************************************************************************************//**
+     * Right-most Column a winning line going through a Column can end at.
+     *
+     **********************************************************************************************/
+    static constexpr int rightValidationLimit(int p_column)
+    {
+        return p_column + (InARow - 1) < NbColumns - 1 ? p_column + (InARow - 1) : NbColumns - 1;
+    }
+
+
+    /*******************************************************************************************//**
+     * Lower-most Row a winning line going through a Row can start at.
+     *
+     **********************************************************************************************/
+    static constexpr int lowerValidationLimit(int p_row)
+    {
+        return p_row - (InARow - 1) > 0 ? p_row - (InARow - 1) : 0;
+    }
+
+
+    /*******************************************************************************************//**
+     * Upper-most Row a winning line going through a Row can end at.
+     *
+     **********************************************************************************************/
+    static constexpr int upperValidationLimit(int p_row)
+    {
+        return p_row + (InARow - 1) < NbRows - 1 ? p_row + (InARow - 1) : NbRows - 1;
+    }
+
+///@}
+
+private:
+
+    using Bitplane = std::array<std::uint64_t, NbColumns>;
+
+    static constexpr std::uint64_t lowBits(int p_nbBits)
+    {
+        return p_nbBits == 64 ? ~std::uint64_t{0} : (std::uint64_t{1} << (p_nbBits % 64)) - 1;
+    }
+
+    static constexpr int nbBits(std::uint64_t p_word)
+    {
+        return p_word == 0 ? 0 : 1 + nbBits(p_word & (p_word - 1));
+    }
+
+    static constexpr std::size_t cellIndex(int p_row, int p_column)
+    {
+        return static_cast<std::size_t>(p_column * NbRows + p_row);
+    }
+
+    bool hasLine(const Bitplane& p_bitplane, const Position& p_position, int p_rowStep, WinningLines::Direction p_direction) const;
+
+    void checkInvariant() const;
+
+    DiscPalette                                  m_palette;          ///< The distinct Discs used so far.
+    std::array<std::uint64_t, NB_DISCS_MAX>      m_discKeys;         ///< The Zobrist key for each Disc, by DiscId.
+    std::array<DiscId, NbRows * NbColumns>       m_cells;            ///< The Grid, one DiscId per Position (Column major).
+    std::array<Bitplane, NB_DISCS_MAX>           m_bitplanes;        ///< The bitplanes, one word per Column, for each Disc.
+    std::array<int, NbColumns>                   m_nextFreeRows;     ///< The next available Row, for each Column.
+    std::uint64_t                                m_hash{0};          ///< The Zobrist hash of the Grid.
+    std::uint64_t                                m_mirroredHash{0};  ///< The Zobrist hash of the mirrored Grid.
+
+};
+
+} // namespace cxbase
+
+
+namespace std
+{
+
+/***********************************************************************************************//**
+ * @brief Hash specialization for FixedGameBoards.
+ *
+ * Allows FixedGameBoards to be used directly as keys in unordered containers.
+ *
+ **************************************************************************************************/
+template<int NbRows, int NbColumns, int InARow>
+struct hash<cxbase::FixedGameBoard<NbRows, NbColumns, InARow>>
+{
+    std::size_t operator()(const cxbase::FixedGameBoard<NbRows, NbColumns, InARow>& p_gameBoard) const
+    {
+        return static_cast<std::size_t>(p_gameBoard.hash());
+    }
+};
+
+} // namespace std
+
+
+#include "../src/FixedGameBoard.ipp"
+
+#endif /* FIXEDGAMEBOARD_H_C81A0F3D_2B6E_4E0C_A7D5_94F2E6B1C378 */
@@ -32,10 +32,15 @@
 #ifndef GAME_H_2D56E7FC_5FA9_4841_B204_05ADCF2DCE07
 #define GAME_H_2D56E7FC_5FA9_4841_B204_05ADCF2DCE07
 
+#include <functional>
+
 #include <cxutil/include/ContractException.h>
 
+#include "EvaluationWeights.h"
 #include "GameBoard.h"
+#include "LiveWindows.h"
 #include "Player.h"
+#include "WinningLines.h"
 
 
 namespace cxbase
@@ -113,8 +118,45 @@ public:
      *
      * @return The active player.
      *
+     * @see activePlayerIndex()
+     *
      **********************************************************************************************/
-    Player activePlayer() const;
+    const Player& activePlayer() const;
+
+
+    /*******************************************************************************************//**
+     * Active Player index accessor.
+     *
+     * Players are identified by their index in the Player list given at construction. Indexes
+     * are small and stable for the whole Game, which makes them cheaper to use than Player
+     * objects where performance matters.
+     *
+     * @return The index of the active player.
+     *
+     **********************************************************************************************/
+    int activePlayerIndex() const {return m_turn;}
+
+
+    /*******************************************************************************************//**
+     * Number of Players accessor.
+     *
+     * @return The number of Players in the Game. Player indexes go from 0 to this value minus one.
+     *
+     **********************************************************************************************/
+    int nbPlayers() const {return static_cast<int>(m_players.size());}
+
+
+    /*******************************************************************************************//**
+     * Player Disc identifier accessor.
+     *
+     * @param[in] p_playerIndex The index of a Player.
+     *
+     * @pre The index is between 0 and @c nbPlayers() - 1.
+     *
+     * @return The identifier of the Player's Disc on the GameBoard.
+     *
+     **********************************************************************************************/
+    DiscId discIdOf(int p_playerIndex) const;
 
 
     /*******************************************************************************************//**
@@ -126,6 +168,15 @@ public:
     int inARowValue() const {return m_inARow;}
 
 
+    /*******************************************************************************************//**
+     * GameBoard accessor.
+     *
+     * @return The GameBoard the Game is played on.
+     *
+     **********************************************************************************************/
+    const GameBoard& gameboard() const {return *m_gameboard;}
+
+
     /*******************************************************************************************//**
      * Current turn accessor.
      *
@@ -143,6 +194,56 @@ public:
      **********************************************************************************************/
     int nbOfCompletedMoves() const {return m_nbOfCompletedMoves;}
 
+
+    /*******************************************************************************************//**
+     * Hash accessor.
+     *
+     * The Game hash combines the GameBoard's incremental Zobrist hash with a key for the current
+     * turn, so that the same Grid with a different Player to move hashes differently.
+     *
+     * @return The 64 bits Zobrist hash of the Game.
+     *
+     * @see GameBoard::hash()
+     *
+     **********************************************************************************************/
+    std::uint64_t hash() const;
+
+
+    /*******************************************************************************************//**
+     * Canonical hash accessor.
+     *
+     * A Game and its mirror image (see GameBoard::mirroredHash()) are equivalent. The canonical
+     * hash is the smallest of their Game hashes, so that both share it. Like @c hash(), it costs
+     * nothing to compute.
+     *
+     * @return The 64 bits Zobrist hash of the canonical Game.
+     *
+     * @see canonicalColumn()
+     *
+     **********************************************************************************************/
+    std::uint64_t canonicalHash() const;
+
+
+    /*******************************************************************************************//**
+     * Maps a Column between the Game and its canonical form.
+     *
+     * If the canonical Game is the mirror image, the Column is mirrored, otherwise it is left as
+     * is. The mapping works both ways: from a move in the Game to the move in the canonical Game
+     * and, for example, from a best move stored under the canonical hash back to the move to
+     * play. Because of the turn key, the canonical form of a Game is not always the one of its
+     * GameBoard.
+     *
+     * @param[in] p_column A Column.
+     *
+     * @pre The Column is inside the GameBoard.
+     *
+     * @return The matching Column.
+     *
+     * @see canonicalHash()
+     *
+     **********************************************************************************************/
+    Column canonicalColumn(const Column& p_column) const;
+
 ///@}
 
 ///@{ @name Game utilities
@@ -157,13 +258,18 @@ public:
      * check is run as to wether the GameBoard is exempt of a winning combination. It is the user's
      * responsability to call the @c isWon() method to make sure of it.
      *
+     * Which Players can still complete each possible winning window is maintained by
+     * @c makeMove() and @c undoMove(), for the windows containing the played Position only, so
+     * this method is only a field read. For this to hold, the GameBoard must only be modified
+     * through the Game once the Game is constructed.
+     *
      * @return A boolean indicating if the Game will eventually be a draw.
      *
      * @see isWon()
      * @see isDraw()
      *
      **********************************************************************************************/
-     bool isEarlyDraw() const;
+     bool isEarlyDraw() const {return m_isEarlyDraw;}
 
 
     /*******************************************************************************************//**
@@ -212,14 +318,162 @@ public:
      * Note that this method does not check for [early] draws. It is the user's responsability to
      * check for those using the @c isEarlyDraw() and @c isDraw() methods.
      *
+     * The check itself is done by @c makeMove() (and @c undoMove()), walking outward from the
+     * current Position along each of the four lines. Its result is cached, so calling this method
+     * is only a field read.
+     *
      * @return A boolean indicating if a winning string of Discs has been found from the
      *         current Position.
      *
      * @see isEarlyDraw()
      * @see isDraw()
+     * @see winningPositions()
+     *
+     **********************************************************************************************/
+    bool isWon() const {return !m_winningPositions.empty();}
+
+
+    /*******************************************************************************************//**
+     * Winning Positions accessor.
+     *
+     * Gives the Positions of the winning string(s) of Discs found by @c isWon(). The current
+     * Position always comes first. If the last move completed more than one winning string, the
+     * Positions of all of them are given, the current Position appearing only once.
+     *
+     * @return The Positions of the winning Discs, or an empty list if the Game is not won.
+     *
+     * @see isWon()
+     *
+     **********************************************************************************************/
+    const std::vector<Position>& winningPositions() const {return m_winningPositions;}
+
+
+    /*******************************************************************************************//**
+     * Threats accessor.
+     *
+     * A threat is an empty Position that would complete a winning string of Discs for a Player,
+     * the Player already owning the @a inARow - 1 other Positions of the string. For example,
+     * with an @a inARow value of four (4), Player A has a threat at Row 0 of Column 0 and
+     * another one at Row 3 of Column 3 (shown with the ASCII code @c x):
+     *
+     *   @verbatim
+     *      3 |   |   |   | x |   |   |   |
+     *      2 |   |   |   | A |   |   |   |
+     *      1 |   |   |   | A | B |   |   |
+     *      0 | x | A | A | A | B | B | B |
+     *          0   1   2   3   4   5   6
+     *   @endverbatim
+     *
+     * Threats are kept current by @c makeMove() and @c undoMove(), only for the Player making the
+     * move and the Columns it could affect, so this method is only a few field reads. For this to
+     * hold, the GameBoard must only be modified through the Game once the Game is constructed.
+     *
+     * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+     * @param[in] p_column      The Column.
+     *
+     * @pre The index is valid.
+     * @pre The Column is inside the GameBoard.
+     *
+     * @return The threat Rows of the Player in the Column, as a bit mask (bit @c n for Row @c n).
+     *
+     * @see winningColumns()
      *
      **********************************************************************************************/
-    bool isWon() const;
+    std::uint64_t threats(int p_playerIndex, const Column& p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Winning Columns accessor.
+     *
+     * Gives the Columns in which a Player would win by dropping a Disc right now, i.e. the
+     * Columns whose next available Position is one of the Player's threats. For the active
+     * Player, these are immediate wins. For the next Player, these are the Columns the active
+     * Player must block. This is maintained along with the threats, so it costs nothing.
+     *
+     * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+     *
+     * @pre The index is valid.
+     *
+     * @return The winning Columns of the Player, as a bit mask (bit @c n for Column @c n).
+     *
+     * @see threats()
+     *
+     **********************************************************************************************/
+    std::uint64_t winningColumns(int p_playerIndex) const;
+
+
+    /*******************************************************************************************//**
+     * Score accessor.
+     *
+     * A Player's score is the sum of the weights (see EvaluationWeights) of its open windows,
+     * i.e. the windows holding its Discs and no other Player's. Vertical windows only count if
+     * they fit under the top of the GameBoard. The windows affected by a move are counted again
+     * by @c makeMove() and @c undoMove(), so this method is only a field read. For this to hold,
+     * the GameBoard must only be modified through the Game once the Game is constructed.
+     *
+     * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+     *
+     * @pre The index is valid.
+     *
+     * @return The score of the Player.
+     *
+     * @see evaluation()
+     *
+     **********************************************************************************************/
+    std::int64_t score(int p_playerIndex) const;
+
+
+    /*******************************************************************************************//**
+     * Static evaluation.
+     *
+     * Gives a heuristic value of the Game for the active Player: its score minus the best score
+     * among the other Players. The higher, the better for the active Player. This is only
+     * meaningful for Games that are not over: a won Game or a draw should be valued by the
+     * caller.
+     *
+     * @return The evaluation of the Game, for the active Player.
+     *
+     * @see score()
+     *
+     **********************************************************************************************/
+    std::int64_t evaluation() const;
+
+
+    /*******************************************************************************************//**
+     * Evaluation weights accessor.
+     *
+     * @return The weights used by @c score(). Unless changed, these are the weights for the
+     *         Game's shape (see EvaluationWeights::forShape()).
+     *
+     **********************************************************************************************/
+    const EvaluationWeights& evaluationWeights() const {return *m_weights;}
+
+
+    /*******************************************************************************************//**
+     * Changes the evaluation weights.
+     *
+     * All scores are computed again with the new weights, which takes time proportional to the
+     * size of the GameBoard.
+     *
+     * @param[in] p_weights The new weights.
+     *
+     * @pre The weights are not @c nullptr.
+     * @pre The weights are for the Game's @a inARow value.
+     *
+     **********************************************************************************************/
+    void setEvaluationWeights(const std::shared_ptr<const EvaluationWeights>& p_weights);
+
+
+    /*******************************************************************************************//**
+     * Completed moves accessor.
+     *
+     * Gives the Positions of all completed moves, in the order they were made. Together with
+     * the Game shape, this is enough to record the Game (see GameArchiveWriter).
+     *
+     * @return The Positions of the completed moves, or an empty list if no move was made.
+     *
+     **********************************************************************************************/
+    const std::vector<Position>& completedMovePositions() const {return m_completedMovePositions;}
 
 
     /*******************************************************************************************//**
@@ -239,6 +493,20 @@ public:
     bool makeMove(const Column& p_column);
 
 
+    /*******************************************************************************************//**
+     * Undo the last move.
+     *
+     * Takes back the last successfull move: its Disc is removed from the GameBoard and the turn
+     * goes back to the Player who made it. Everything derived from the move, including the
+     * number of completed moves and the hash, is restored in constant time. Combined with
+     * @c makeMove(), this allows exploring a Game in place, without copying it.
+     *
+     * @pre At least one move has been completed.
+     *
+     **********************************************************************************************/
+    void undoMove();
+
+
 ///@}
 
 ///@{ @name Predefined values
@@ -268,61 +536,82 @@ private:
 
     bool     isPlayerInGame(const Player& p_player) const;
 
-    Player   previousPlayer() const;
+    int      previousPlayerIndex() const;
     Position positionOfLastSuccessFullMove() const;
 
 ///@{ @name isEarlyDraw implementation
 
-    bool canPlayerWinHorizontal              (const Player& p_player                             ) const;
-    bool canPlayerWinVertical                (const Player& p_player                             ) const;
-    bool canPlayerWinDiagonalUpward          (const Player& p_player                             ) const;
-    bool canPlayerWinDiagonalDownward        (const Player& p_player                             ) const;
+    static const int NOT_WINNABLE{-2};  ///< Owner of a Disc which belongs to no Player.
+    static const int NOBODY      {-1};  ///< Owner of an empty Column.
+
+    /*******************************************************************************************//**
+     * @brief The top of a Column, where a vertical string can still be completed.
+     *
+     **********************************************************************************************/
+    struct LiveColumn
+    {
+        int m_nbEmpty {0};       ///< The number of empty Positions in the Column.
+        int m_topOwner{NOBODY};  ///< The Player owning the top most Disc, if any.
+        int m_topRun  {0};       ///< The number of adjacent Discs of this Player on top.
+    };
+
+    int  nbRemainingMoves     (int p_playerIndex) const;
+    int  playerIndex          (DiscId p_discId  ) const;
+    bool canPlayerWin         (int p_playerIndex) const;
 
-    int  nbRemainingMoves                    (const Player& p_player, const int p_nbOfTurnsPlayed) const;
-    int  nbRemainingMoves                    (const Player& p_player                             ) const;
-    int  maxVerticalPositionForPlayerInColumn(const Player& p_player, const Column& p_column     ) const;
-    int  nbOfMovesSinceLastPlay              (const Player& p_player                             ) const;
-    bool isPlayerPresentInColumn             (const Player& p_player, const Column& p_column     ) const;
-    int  playerTurn                          (const Player& p_player                             ) const;
+    void countLiveColumn      (const LiveColumn& p_column, int p_count);
+    void updateLiveColumn     (int p_column, int p_nextFreeRow);
+    void initializeLiveWindows();
+    void updateEarlyDraw      ();
 
 ///@}
 
-///{ @name isWon implementation
-
-    enum class GridValidationType: int
-    {
-        Straight,
-        Horizontal,
-        Vertical,
-        Oblique,
-        DiagonalUpward,
-        DiagonalDownward
-    };
+///{ @name threats implementation
 
-    int leftValidationLimit (GridValidationType validationType = GridValidationType::Straight) const;
-    int rightValidationLimit(GridValidationType validationType = GridValidationType::Straight) const;
-    int upperValidationLimit(GridValidationType validationType = GridValidationType::Straight) const;
-    int lowerValidationLimit(GridValidationType validationType = GridValidationType::Straight) const;
+    std::size_t   discWordIndex        (int p_playerIndex, int p_column) const;
+    std::size_t   threatIndex          (int p_playerIndex, int p_column) const;
+    std::uint64_t columnThreats        (int p_playerIndex, int p_column) const;
+    void          updateWinningColumn  (int p_playerIndex, int p_column);
+    void          updateThreats        (int p_playerIndex, const Position& p_position);
+    void          initializeThreats    ();
 
-    int nbOfValidations(int p_minValidationLimit, int p_maxValidationLimit) const;
+///}
 
-    int horizontalNbOfAdjacentDiscs() const;
-    int verticalNbOfAdjacentDiscs  () const;
-    int upwardNbOfAdjacentDiscs    () const;
-    int downwardNbOfAdjacentDiscs  () const;
+///{ @name isWon implementation
 
-    bool checkHorizontalWinner() const;
-    bool checkVerticalWinner  () const;
-    bool checkUpwardWinner    () const;
-    bool checkDownwardWinner  () const;
+    int  nbOfAdjacentDiscs     (const Position& p_from, int p_rowStep, int p_columnStep) const;
+    void updateWinningPositions();
 
 ///{ @name private data
 
-    int                   m_inARow;                       ///< The @a inARow for the Game.
-    int                   m_turn                    {0};  ///< The current turn (first turn is 0).
-    int                   m_nbOfCompletedMoves      {0};  ///< The total number of completed moves.
-    std::vector<Position> m_completedMovePositions;       ///< A list of all Positions successfully used.
-                                                          ///< by the Players to complete a move.
+    int                                 m_inARow;                   ///< The @a inARow for the Game.
+    int                                 m_turn              {0};    ///< The current turn (first turn is 0).
+    int                                 m_nbOfCompletedMoves{0};    ///< The total number of completed moves.
+    std::vector<Position>               m_completedMovePositions;   ///< A list of all Positions successfully used.
+                                                                    ///< by the Players to complete a move.
+    std::vector<Position>               m_winningPositions;         ///< The Positions making the last move a win,
+                                                                    ///< if any.
+
+    std::shared_ptr<const WinningLines> m_lines;                    ///< The windows for the Game's shape.
+    std::vector<DiscId>                 m_playerDiscIds;            ///< The Disc of each Player, by index.
+    std::vector<int>                    m_playerIndexes;            ///< The Player owning each Disc, by DiscId.
+    LiveWindows                         m_liveWindows;              ///< The windows, except vertical ones.
+    std::vector<LiveColumn>             m_liveColumns;              ///< The top of every Column.
+    std::vector<int>                    m_verticalRuns;             ///< For each Position holding a Disc, the
+                                                                    ///< number of adjacent identical Discs down
+                                                                    ///< to it, at most @a inARow (Column major).
+    bool                                m_isEarlyDraw   {false};    ///< Cached result for isEarlyDraw().
+    std::vector<std::uint64_t>          m_discWords;                ///< For each Player, its Discs by Column, as in
+                                                                    ///< GameBoard::columnBits(), with @a inARow - 1
+                                                                    ///< empty Columns on each side.
+    std::vector<std::uint64_t>          m_threats;                  ///< For each Player and Column, the Rows
+                                                                    ///< completing one of its horizontal, diagonal
+                                                                    ///< upward and diagonal downward strings
+                                                                    ///< (filled or not).
+    std::vector<std::uint64_t>          m_winningColumns;           ///< For each Player, its winning Columns.
+    std::shared_ptr<const EvaluationWeights> m_weights;             ///< The weights of the open windows.
+    std::vector<std::int64_t>           m_columnScores;             ///< The score of each Player, for its
+                                                                    ///< vertical windows only.
 
 ///}
 
@@ -330,4 +619,25 @@ private:
 
 } // namespace cxbase
 
+
+namespace std
+{
+
+/***********************************************************************************************//**
+ * @brief Hash specialization for Games.
+ *
+ * Allows Games to be used directly as keys in unordered containers.
+ *
+ **************************************************************************************************/
+template<>
+struct hash<cxbase::Game>
+{
+    std::size_t operator()(const cxbase::Game& p_game) const
+    {
+        return static_cast<std::size_t>(p_game.hash());
+    }
+};
+
+} // namespace std
+
 #endif /* GAME_H_2D56E7FC_5FA9_4841_B204_05ADCF2DCE07_ */
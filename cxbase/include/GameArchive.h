@@ -0,0 +1,239 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    GameArchive.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a memory-mapped game archive.
+ *
+ **************************************************************************************************/
+
+#ifndef GAMEARCHIVE_H_7B1E4F92_C06A_4D35_A8E7_25F9D03B6C14
+#define GAMEARCHIVE_H_7B1E4F92_C06A_4D35_A8E7_25F9D03B6C14
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cxutil/include/MappedFile.h>
+#include <cxutil/include/ReturnCode.h>
+
+#include "Game.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class GameArchive
+ *
+ * @brief Games recorded in a compact binary file.
+ *
+ * A game archive is a binary file made by a GameArchiveWriter. It holds a @c Header, giving the
+ * shape shared by all its Games, followed by one record per Game. A record is the Column of
+ * each move, one byte per move, followed by an @c endOfGame() byte. Games are recorded as
+ * played: a record holds no result, which is found again by replaying it. Numbers in the header
+ * are stored in the byte order of the machine which wrote the archive.
+ *
+ * The file is mapped in memory, not read: opening an archive is immediate whatever its size
+ * and records are accessed in place, without any copy. Records can be walked through from any
+ * position with @c next(), which allows splitting an archive in chunks (see @c align()).
+ *
+ **************************************************************************************************/
+class GameArchive
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The file header.
+     *
+     **********************************************************************************************/
+    struct Header
+    {
+        char          m_magic[8];       ///< "CXGAMES" followed by a zero (0).
+        std::uint32_t m_version;        ///< The file format version.
+        std::uint8_t  m_nbRows;         ///< The number of Rows of the GameBoard.
+        std::uint8_t  m_nbColumns;      ///< The number of Columns of the GameBoard.
+        std::uint8_t  m_inARow;         ///< The @a inARow value.
+        std::uint8_t  m_nbPlayers;      ///< The number of Players.
+        std::uint64_t m_nbGames;        ///< The number of records following the header.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief The moves of a recorded Game.
+     *
+     * A record is a view on the mapped archive: it is only valid while the archive is open.
+     *
+     **********************************************************************************************/
+    class Record
+    {
+
+    public:
+
+        Record() = default;
+        Record(const std::uint8_t* p_begin, const std::uint8_t* p_end) : m_begin{p_begin}, m_end{p_end} {}
+
+        const std::uint8_t* begin()   const {return m_begin;}                                   ///< The first move.
+        const std::uint8_t* end()     const {return m_end;}                                     ///< Past the last move.
+        int                 nbMoves() const {return static_cast<int>(m_end - m_begin);}         ///< The number of moves.
+        Column              column(int p_move) const {return Column{m_begin[p_move]};}          ///< The Column of a move.
+
+    private:
+
+        const std::uint8_t* m_begin{nullptr};   ///< The first move.
+        const std::uint8_t* m_end  {nullptr};   ///< Past the last move.
+
+    };
+
+
+    /*******************************************************************************************//**
+     * Current file format version.
+     *
+     * @return The version written by the GameArchiveWriter and expected by @c open().
+     *
+     **********************************************************************************************/
+    static std::uint32_t version() {return 1;}
+
+
+    /*******************************************************************************************//**
+     * File magic number.
+     *
+     * @return The eight (8) first bytes of every game archive.
+     *
+     **********************************************************************************************/
+    static const char* magic() {return "CXGAMES";}
+
+
+    /*******************************************************************************************//**
+     * End of record marker.
+     *
+     * @return The byte following the last move of every record. It can not be a Column.
+     *
+     **********************************************************************************************/
+    static std::uint8_t endOfGame() {return 0xFF;}
+
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Opens a game archive. Any archive previously opened is closed first.
+     *
+     * @param[in] p_path The archive file path.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be mapped or is
+     *         not a valid game archive.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode open(const std::string& p_path);
+
+
+    /*******************************************************************************************//**
+     * Closes the game archive. Records become invalid.
+     *
+     **********************************************************************************************/
+    void close();
+
+///@}
+
+///@{ @name Data access
+
+    bool        isOpen()    const {return m_header != nullptr;}                                ///< Checks if an archive is open.
+    int         nbRows()    const {return isOpen() ? m_header->m_nbRows    : 0;}              ///< Number of Rows accessor.
+    int         nbColumns() const {return isOpen() ? m_header->m_nbColumns : 0;}              ///< Number of Columns accessor.
+    int         inARow()    const {return isOpen() ? m_header->m_inARow    : 0;}              ///< @a inARow value accessor.
+    int         nbPlayers() const {return isOpen() ? m_header->m_nbPlayers : 0;}              ///< Number of Players accessor.
+    std::size_t size()      const {return isOpen() ? static_cast<std::size_t>(m_header->m_nbGames) : 0;} ///< Number of records.
+
+    const std::uint8_t* begin() const {return m_begin;}   ///< The first record, or @c nullptr.
+    const std::uint8_t* end()   const {return m_end;}     ///< Past the last record, or @c nullptr.
+
+
+    /*******************************************************************************************//**
+     * Reads a record and moves on to the next one.
+     *
+     * @param[in,out] p_cursor The start of a record, between @c begin() and @c end(). On
+     *                         return, the start of the next record, or @c end().
+     * @param[out]    p_record The record, untouched if there is none left.
+     *
+     * @return @c true if a record has been read, @c false if @c p_cursor was at @c end().
+     *
+     * @pre An archive is open.
+     *
+     **********************************************************************************************/
+    bool next(const std::uint8_t*& p_cursor, Record& p_record) const;
+
+
+    /*******************************************************************************************//**
+     * Finds the first record starting at, or after, some point in the archive. Splitting an
+     * archive in chunks is then a matter of aligning evenly spaced points on records: every
+     * record belongs to exactly one chunk.
+     *
+     * @param[in] p_from A point between @c begin() and @c end().
+     *
+     * @return The start of the first record starting at, or after, @c p_from, or @c end().
+     *
+     * @pre An archive is open.
+     *
+     **********************************************************************************************/
+    const std::uint8_t* align(const std::uint8_t* p_from) const;
+
+
+    /*******************************************************************************************//**
+     * Replays a record. Moves are made one by one, from the current state of the Game, and can
+     * be taken back with Game::undoMove(): the same Game can be used to replay any number of
+     * records without being created again.
+     *
+     * @param[in]     p_record The record.
+     * @param[in,out] p_game   The Game, of the archive shape.
+     *
+     * @return The number of moves made. It is less than the number of moves in the record if one
+     *         of them is invalid: outside the GameBoard, in a full Column or after the Game is
+     *         over.
+     *
+     * @pre An archive is open.
+     * @pre The Game has the shape of the archive.
+     *
+     **********************************************************************************************/
+    int replay(const Record& p_record, Game& p_game) const;
+
+///@}
+
+
+private:
+
+    cxutil::MappedFile  m_file;                 ///< The mapped archive file.
+    const Header*       m_header{nullptr};      ///< The header, in the mapped file.
+    const std::uint8_t* m_begin {nullptr};      ///< The first record, in the mapped file.
+    const std::uint8_t* m_end   {nullptr};      ///< Past the last record, in the mapped file.
+
+};
+
+} // namespace cxbase
+
+#endif /* GAMEARCHIVE_H_7B1E4F92_C06A_4D35_A8E7_25F9D03B6C14 */
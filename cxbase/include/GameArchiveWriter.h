@@ -0,0 +1,164 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    GameArchiveWriter.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a streaming game archive writer.
+ *
+ **************************************************************************************************/
+
+#ifndef GAMEARCHIVEWRITER_H_C4A82D17_9E3B_4F60_B1D5_6E08F7A2935B
+#define GAMEARCHIVEWRITER_H_C4A82D17_9E3B_4F60_B1D5_6E08F7A2935B
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include <cxutil/include/ReturnCode.h>
+#include <cxutil/include/UnCopyable.h>
+
+#include "GameArchive.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class GameArchiveWriter
+ *
+ * @brief Records Games, one after the other, in a game archive (see GameArchive).
+ *
+ * Records are buffered and written in large blocks: the memory used does not depend on the
+ * number of Games recorded. The number of Games is written in the header when the archive is
+ * closed, so an archive which has not been closed can not be opened.
+ *
+ **************************************************************************************************/
+class GameArchiveWriter final : private cxutil::UnCopyable
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default constructor. No archive is open.
+     *
+     **********************************************************************************************/
+    GameArchiveWriter() = default;
+
+
+    /*******************************************************************************************//**
+     * Destructor. Closes the archive, if any.
+     *
+     * Write errors are lost when the archive is closed here: call @c close() first to see them.
+     *
+     **********************************************************************************************/
+    ~GameArchiveWriter();
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Creates a game archive. Any archive previously open is closed first.
+     *
+     * @param[in] p_path      The archive file path. An existing file is replaced.
+     * @param[in] p_nbRows    The number of Rows of the Games.
+     * @param[in] p_nbColumns The number of Columns of the Games.
+     * @param[in] p_inARow    The @a inARow value of the Games.
+     * @param[in] p_nbPlayers The number of Players of the Games.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be created.
+     *
+     * @pre Every value fits in a byte and the number of Columns is smaller than
+     *      GameArchive::endOfGame().
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode open(const std::string& p_path, int p_nbRows, int p_nbColumns, int p_inARow, int p_nbPlayers);
+
+
+    /*******************************************************************************************//**
+     * Records the moves of a Game, in the order they were made.
+     *
+     * @param[in] p_game The Game.
+     *
+     * @pre An archive is open.
+     * @pre The Game has the shape of the archive.
+     *
+     **********************************************************************************************/
+    void write(const Game& p_game);
+
+
+    /*******************************************************************************************//**
+     * Records the moves of a Game, in the order they were made.
+     *
+     * @param[in] p_columns The Column of every move.
+     * @param[in] p_nbMoves The number of moves.
+     *
+     * @pre An archive is open.
+     * @pre Every Column is inside the GameBoard of the archive.
+     *
+     **********************************************************************************************/
+    void write(const std::uint8_t* p_columns, std::size_t p_nbMoves);
+
+
+    /*******************************************************************************************//**
+     * Writes the remaining records and the header, and closes the archive.
+     *
+     * @return A ReturnCode holding an error, with a message, if the archive could not be
+     *         written. Nothing is done if no archive is open.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode close();
+
+///@}
+
+///@{ @name Data access
+
+    bool        isOpen() const {return m_file.is_open();}                                     ///< Checks if an archive is open.
+    std::size_t size()   const {return static_cast<std::size_t>(m_header.m_nbGames);}         ///< Number of Games recorded.
+
+///@}
+
+
+private:
+
+    void flush();
+
+    std::ofstream             m_file;           ///< The archive file.
+    std::string               m_path;           ///< The archive file path.
+    GameArchive::Header       m_header{};       ///< The header, written last.
+    std::vector<std::uint8_t> m_buffer;         ///< Records not written yet.
+
+};
+
+} // namespace cxbase
+
+#endif /* GAMEARCHIVEWRITER_H_C4A82D17_9E3B_4F60_B1D5_6E08F7A2935B */
@@ -32,6 +32,8 @@
 #ifndef GAMEBOARD_H_59F7D710_94EA_491A_9C14_94AE5C014E9A
 #define GAMEBOARD_H_59F7D710_94EA_491A_9C14_94AE5C014E9A
 
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -39,6 +41,7 @@
 #include <cxutil/include/ContractException.h>
 
 #include "Disc.h"
+#include "DiscPalette.h"
 #include "Position.h"
 
 
@@ -67,6 +70,12 @@ namespace cxbase
  *
  * @note 3D GameBoards are not supported.
  *
+ * @note Internally, each distinct Disc used on the GameBoard is interned in a DiscPalette and
+ *       every Position of the Grid only stores the resulting DiscId. On top of this, each Disc
+ *       owns a bitplane holding one 64 bits word per Column, where bit @c n is set if the Disc
+ *       occupies Row @c n of that Column. This is why the maximal number of rows cannot exceed
+ *       64 without changing the storage.
+ *
  **************************************************************************************************/
 class GameBoard
 {
@@ -119,7 +128,7 @@ public:
      * @return The number of rows in the GameBoard.
      *
      **********************************************************************************************/
-    int nbRows() const;
+    int nbRows() const {return m_nbRows;}
 
 
     /*******************************************************************************************//**
@@ -128,7 +137,7 @@ public:
      * @return The number of columns in the GameBoard.
      *
      **********************************************************************************************/
-    int nbColumns() const;
+    int nbColumns() const {return m_nbColumns;}
 
 
     /*******************************************************************************************//**
@@ -139,6 +148,116 @@ public:
      **********************************************************************************************/
     int nbPositions() const;
 
+
+    /*******************************************************************************************//**
+     * Accessor for the Discs known to the GameBoard.
+     *
+     * @return The palette in which every Disc used on the GameBoard is registered.
+     *
+     **********************************************************************************************/
+    const DiscPalette& palette() const {return m_palette;}
+
+
+    /*******************************************************************************************//**
+     * Accessor for the identifier of the Disc located at a specific Position.
+     *
+     * This is the compact counterpart of the function operator: Discs can be compared through
+     * their identifiers, and the actual Disc recovered from the @c palette() when needed.
+     *
+     * @param[in] p_position The Position at which the needed Disc is located on the grid.
+     *
+     * @pre The Position is inside the grid.
+     *
+     * @return The identifier of the Disc located at the Position, @c DiscPalette::noDiscId()
+     *         if the Position is empty.
+     *
+     **********************************************************************************************/
+    DiscId discId(const Position& p_position) const;
+
+
+    /*******************************************************************************************//**
+     * Accessor for the Positions occupied by a Disc in a specific Column.
+     *
+     * Gives the Column's word of the Disc's bitplane: bit @c n is set if the Disc occupies Row
+     * @c n of the Column. Shifting and combining such words checks a whole Column at once,
+     * instead of one Position at a time.
+     *
+     * @param[in] p_discId  The identifier of the Disc.
+     * @param[in] p_column  The Column.
+     *
+     * @pre The identifier has been given by @c registerDisc() and is not
+     *      @c DiscPalette::noDiscId().
+     * @pre The Column is inside the grid.
+     *
+     * @return The Rows occupied by the Disc in the Column, as a bit mask.
+     *
+     **********************************************************************************************/
+    std::uint64_t columnBits(DiscId p_discId, const Column& p_column) const;
+
+
+    /*******************************************************************************************//**
+     * Hash accessor.
+     *
+     * The GameBoard hash is a Zobrist hash maintained incrementally as Discs are placed, so
+     * this accessor costs nothing. Equal GameBoards always have the same hash, regardless of
+     * the order in which Discs were placed or registered.
+     *
+     * @return The 64 bits Zobrist hash of the Grid.
+     *
+     * @see Zobrist
+     *
+     **********************************************************************************************/
+    std::uint64_t hash() const {return m_hash;}
+
+
+    /*******************************************************************************************//**
+     * Mirrored hash accessor.
+     *
+     * The hash the Grid would have if it was reflected horizontally, i.e. if every Disc in
+     * Column @c c was moved to Column @c nbColumns()-1-c. It is maintained incrementally along
+     * with @c hash(), so this accessor costs nothing either.
+     *
+     * @return The 64 bits Zobrist hash of the mirrored Grid.
+     *
+     **********************************************************************************************/
+    std::uint64_t mirroredHash() const {return m_mirroredHash;}
+
+
+    /*******************************************************************************************//**
+     * Canonical hash accessor.
+     *
+     * A Grid and its mirror image are equivalent: whatever holds for one holds for the other,
+     * Columns being mirrored. The canonical hash is the smallest of @c hash() and
+     * @c mirroredHash(), so both equivalent Grids share it. Tables keyed by it hold one entry
+     * for both.
+     *
+     * @return The 64 bits Zobrist hash of the canonical Grid.
+     *
+     * @see canonicalColumn()
+     *
+     **********************************************************************************************/
+    std::uint64_t canonicalHash() const {return m_mirroredHash < m_hash ? m_mirroredHash : m_hash;}
+
+
+    /*******************************************************************************************//**
+     * Maps a Column between the Grid and its canonical form.
+     *
+     * If the canonical Grid is the mirror image, the Column is mirrored, otherwise it is left
+     * as is. Since mirroring twice gives back the same Column, this maps a Column of the Grid to
+     * the canonical Grid as well as a Column of the canonical Grid (for example a move stored in
+     * a table) back to the real Grid.
+     *
+     * @param[in] p_column A Column.
+     *
+     * @pre The Column is inside the Grid.
+     *
+     * @return The matching Column.
+     *
+     * @see canonicalHash()
+     *
+     **********************************************************************************************/
+    Column canonicalColumn(const Column& p_column) const;
+
 ///@}
 
 
@@ -178,6 +297,71 @@ public:
     Position placeDisc(const Column& p_column, const Disc& p_disc);
 
 
+    /*******************************************************************************************//**
+     * Places a Disc, by identifier, in a specific Column.
+     *
+     * Same as placing the Disc itself, but without any Disc comparison.
+     *
+     * @param[in] p_column  The Column where to insert the Disc.
+     * @param[in] p_discId  The identifier of the Disc to insert.
+     *
+     * @return The Position where the Disc has been placed, if the Column specified as an argument
+     *         is not full, or the Column's top most Position otherwise.
+     *
+     * @pre The Column number is between 0 and the maximum Column number for the GameBoard.
+     * @pre The identifier has been given by @c registerDisc() and is not
+     *      @c DiscPalette::noDiscId().
+     *
+     **********************************************************************************************/
+    Position placeDisc(const Column& p_column, DiscId p_discId);
+
+
+    /*******************************************************************************************//**
+     * Removes the top most Disc from a specific Column.
+     *
+     * This is the exact opposite of @c placeDisc(): the last Disc placed in the Column is taken
+     * out and the GameBoard, hash included, is restored to what it was before that Disc was
+     * placed. For example:
+     *
+     *   @verbatim
+     *
+     *      |   |         |   |
+     *      | R |  --->   |   | <- Removed Disc.
+     *      | N |         | N |
+     *      | R |         | R |
+     *
+     *   @endverbatim
+     *
+     * This runs in constant time, which makes it possible to explore moves in place instead of
+     * copying the GameBoard.
+     *
+     * @param[in] p_column  The Column from which to remove the Disc.
+     *
+     * @return The Position that has been freed.
+     *
+     * @pre The Column number is between 0 and the maximum Column number for the GameBoard.
+     * @pre The Column contains at least one Disc.
+     *
+     **********************************************************************************************/
+    Position removeDisc(const Column& p_column);
+
+
+    /*******************************************************************************************//**
+     * Registers a Disc in the GameBoard's palette.
+     *
+     * Registering a Disc before it is placed gives it a stable identifier. Registering an already
+     * known Disc has no effect.
+     *
+     * @param[in] p_disc The Disc to register.
+     *
+     * @pre The Disc is not @c Disc::noDisc().
+     *
+     * @return The Disc identifier.
+     *
+     **********************************************************************************************/
+    DiscId registerDisc(const Disc& p_disc);
+
+
     /*******************************************************************************************//**
      * Checks if a specific Column is full.
      *
@@ -228,7 +412,8 @@ public:
      * Equal-to operator.
      *
      * Two GameBoards are considered equal <em> if and only if </em> both their Grids and
-     * dimension information are the same.
+     * dimension information are the same. GameBoards with different hashes are rejected
+     * without looking at their Grids.
      *
      * @param[in] p_gameBoard The GameBoard with which to compare.
      *
@@ -285,12 +470,41 @@ private:
     static const int   NB_COLUMNS_MIN   {7};
     static const int   NB_ROWS_MIN      {6};
 
-    std::vector<std::vector<std::shared_ptr<Disc>>>  m_grid;       ///< The GameBoard's grid (holds the Discs).
-    int                                              m_nbRows;     ///< The GameBoard grid's number of rows.
-    int                                              m_nbColumns;  ///< The GameBoard grid's number of columns.
+    std::size_t cellIndex(int p_row, int p_column) const;
+
+    DiscPalette                 m_palette;          ///< The distinct Discs used so far.
+    std::vector<std::uint64_t>  m_discKeys;         ///< The Zobrist key for each Disc, by DiscId.
+    std::vector<DiscId>         m_cells;            ///< The Grid, one DiscId per Position (Column major).
+    std::vector<std::uint64_t>  m_bitplanes;        ///< The bitplanes, one word per Column, for each Disc.
+    std::vector<int>            m_nextFreeRows;     ///< The next available Row, for each Column.
+    int                         m_nbRows;           ///< The GameBoard grid's number of rows.
+    int                         m_nbColumns;        ///< The GameBoard grid's number of columns.
+    std::uint64_t               m_hash{0};          ///< The Zobrist hash of the Grid.
+    std::uint64_t               m_mirroredHash{0};  ///< The Zobrist hash of the mirrored Grid.
 
 };
 
 } // namespace cxbase
 
+
+namespace std
+{
+
+/***********************************************************************************************//**
+ * @brief Hash specialization for GameBoards.
+ *
+ * Allows GameBoards to be used directly as keys in unordered containers.
+ *
+ **************************************************************************************************/
+template<>
+struct hash<cxbase::GameBoard>
+{
+    std::size_t operator()(const cxbase::GameBoard& p_gameBoard) const
+    {
+        return static_cast<std::size_t>(p_gameBoard.hash());
+    }
+};
+
+} // namespace std
+
 #endif /* GAMEBOARD_H_59F7D710_94EA_491A_9C14_94AE5C014E9A */
@@ -0,0 +1,239 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    LiveWindows.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for an incremental open window accounting utility.
+ *
+ **************************************************************************************************/
+
+#ifndef LIVEWINDOWS_H_8E3B7C52_0A4D_4F19_B6E2_5D9C1A7F3E04
+#define LIVEWINDOWS_H_8E3B7C52_0A4D_4F19_B6E2_5D9C1A7F3E04
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <cxutil/include/ContractException.h>
+
+#include "EvaluationWeights.h"
+#include "Position.h"
+#include "WinningLines.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class LiveWindows
+ *
+ * @brief Which Player can still complete each winning window, kept current Disc by Disc.
+ *
+ * For every window (see WinningLines), LiveWindows follows the Discs it holds as they are added
+ * and removed. A window holding only the Discs of one Player is open for this Player. From the
+ * open windows, LiveWindows gives:
+ *
+ *  @li The score of each Player: the sum of the weights (see EvaluationWeights) of its open
+ *      windows.
+ *  @li The number of open windows of each Player, by number of empty Positions left. A Player
+ *      has completed a window when it has an open window without empty Positions.
+ *  @li The number of empty windows, which any Player could still complete.
+ *
+ * Only the windows containing the added or removed Disc are visited, so both updates take time
+ * proportional to the number of windows through a Position, whatever the board size. This is
+ * the accounting behind cxbase::Game::score() and cxbase::Game::isEarlyDraw(), shared with
+ * search boards that need the same scores.
+ *
+ * Vertical windows can be left out: they are then not counted at all, and the owner is expected
+ * to follow them in another way.
+ *
+ * Discs may also belong to no Player (for example a Disc placed on the GameBoard by someone
+ * else than the Game's Players). A window holding such a Disc can no longer be completed.
+ *
+ * @invariant There are at least two (2) Players, unless no windows are followed.
+ *
+ **************************************************************************************************/
+class LiveWindows
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default constructor. No windows are followed: assign an object built with the other
+     * constructor before any update.
+     *
+     **********************************************************************************************/
+    LiveWindows() = default;
+
+
+    /*******************************************************************************************//**
+     * Constructor with parameters. All windows start empty.
+     *
+     * @param[in] p_lines                The windows for the board shape.
+     * @param[in] p_nbPlayers            The number of Players.
+     * @param[in] p_weights              The weights of the open windows.
+     * @param[in] p_withVerticalWindows  @c true to count vertical windows, @c false to leave
+     *                                   them out.
+     *
+     * @pre The windows and the weights are not @c nullptr.
+     * @pre There are at least two (2) Players.
+     * @pre The weights are for the windows' @a inARow value.
+     *
+     **********************************************************************************************/
+    LiveWindows(const std::shared_ptr<const WinningLines>&      p_lines,
+                int                                             p_nbPlayers,
+                const std::shared_ptr<const EvaluationWeights>& p_weights,
+                bool                                            p_withVerticalWindows);
+
+///@}
+
+
+///@{ @name Data access
+
+    int nbPlayers() const {return m_nbPlayers;}     ///< Number of Players accessor.
+
+
+    /*******************************************************************************************//**
+     * Score accessor.
+     *
+     * @param[in] p_player The index of the Player.
+     *
+     * @pre The index is between 0 and @c nbPlayers() - 1.
+     *
+     * @return The sum of the weights of the Player's open windows. This is always positive or
+     *         zero (0).
+     *
+     **********************************************************************************************/
+    std::int64_t score(int p_player) const;
+
+
+    /*******************************************************************************************//**
+     * Open windows counter accessor.
+     *
+     * @param[in] p_player  The index of the Player.
+     * @param[in] p_nbEmpty The number of empty Positions.
+     *
+     * @pre The index is between 0 and @c nbPlayers() - 1.
+     * @pre The number of empty Positions is between 0 and @a inARow - 1.
+     *
+     * @return The number of windows only holding Discs of the Player, with exactly
+     *         @c p_nbEmpty empty Positions.
+     *
+     **********************************************************************************************/
+    int nbLiveWindows(int p_player, int p_nbEmpty) const;
+
+
+    /*******************************************************************************************//**
+     * Empty windows counter accessor.
+     *
+     * @return The number of windows without any Disc.
+     *
+     **********************************************************************************************/
+    int nbEmptyWindows() const {return m_nbEmptyWindows;}
+
+///@}
+
+
+///@{ @name Updates
+
+    /*******************************************************************************************//**
+     * Adds a Disc to every window containing a Position.
+     *
+     * @param[in] p_position The Position of the Disc.
+     * @param[in] p_player   The index of the Player owning the Disc, or a negative value if
+     *                       the Disc belongs to no Player.
+     *
+     * @pre The Position is inside the grid and was not counted yet.
+     * @pre The index is smaller than @c nbPlayers().
+     *
+     **********************************************************************************************/
+    void addDisc(const Position& p_position, int p_player);
+
+
+    /*******************************************************************************************//**
+     * Removes a Disc from every window containing a Position. This is the exact reverse of
+     * @c addDisc().
+     *
+     * @param[in] p_position The Position of the Disc.
+     * @param[in] p_player   The index of the Player owning the Disc, as given to @c addDisc().
+     *
+     * @pre The Disc was added with @c addDisc().
+     *
+     **********************************************************************************************/
+    void removeDisc(const Position& p_position, int p_player);
+
+///@}
+
+
+private:
+
+    static const int NOT_WINNABLE{-2};  ///< Owner of a window no Player can win anymore.
+    static const int NOBODY      {-1};  ///< Owner of an empty window.
+
+    /*******************************************************************************************//**
+     * @brief The state of a window.
+     *
+     **********************************************************************************************/
+    struct Window
+    {
+        int m_owner    {NOBODY};  ///< The only Player with Discs in the window, if any.
+        int m_nbDiscs  {0};       ///< The number of Discs in the window.
+        int m_nbOwners {0};       ///< The number of owner slots (see @c ownerSlot()) with Discs
+                                  ///< in the window.
+        int m_slotsSum {0};       ///< The sum of these slots, which is the owner's when there is
+                                  ///< only one.
+    };
+
+    int  ownerSlot       (int p_player) const;
+    bool isCounted       (int p_window) const;
+    void countWindow     (const Window& p_window, int p_count);
+    void addToWindow     (int p_window, int p_slot);
+    void removeFromWindow(int p_window, int p_slot);
+
+    void checkInvariant() const;
+
+    std::shared_ptr<const WinningLines>      m_lines;                      ///< The windows for the board shape.
+    std::shared_ptr<const EvaluationWeights> m_weights;                    ///< The weights of the open windows.
+    int                                      m_nbPlayers          {0};     ///< The number of Players.
+    int                                      m_inARow             {0};     ///< The @a inARow value.
+    bool                                     m_withVerticalWindows{false}; ///< Whether vertical windows are counted.
+    std::vector<Window>                      m_windows;                    ///< All windows, by index in @c m_lines.
+    std::vector<std::uint8_t>                m_windowCounts;               ///< For each window, the number of Discs
+                                                                           ///< of each owner slot.
+    std::vector<int>                         m_nbLiveWindows;              ///< For each Player, the number of open
+                                                                           ///< windows, by number of empty Positions
+                                                                           ///< left.
+    int                                      m_nbEmptyWindows     {0};     ///< The number of windows without any Disc.
+    std::vector<std::int64_t>                m_scores;                     ///< The score of each Player.
+
+};
+
+} // namespace cxbase
+
+#endif /* LIVEWINDOWS_H_8E3B7C52_0A4D_4F19_B6E2_5D9C1A7F3E04 */
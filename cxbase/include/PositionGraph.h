@@ -0,0 +1,223 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    PositionGraph.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a memory-mapped graph of distinct Game positions.
+ *
+ **************************************************************************************************/
+
+#ifndef POSITIONGRAPH_H_5A0C3E81_D7F2_4B96_A41E_8C3B92F06D57
+#define POSITIONGRAPH_H_5A0C3E81_D7F2_4B96_A41E_8C3B92F06D57
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include <cxutil/include/MappedFile.h>
+#include <cxutil/include/ReturnCode.h>
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class PositionGraph
+ *
+ * @brief The distinct positions reached by a set of Games, and the moves between them.
+ *
+ * Games often transpose: different move orders lead to the same position. A position graph
+ * holds every distinct position once, as a node, whatever the number of Games or move orders
+ * reaching it. Each node tells how many Games went through the position and how these Games
+ * ended. Each edge is a move from a position to another, with the number of Games which made
+ * it. Since Discs can not be taken back, the graph has no cycle: its only root is the empty
+ * GameBoard.
+ *
+ * A position graph is a binary file made by a PositionGraphBuilder. It holds a @c Header, the
+ * nodes sorted by key, the edges sorted by origin node and Column, and the number of wins of
+ * every seat for every node. Numbers are stored in the byte order of the machine which built
+ * the graph. The file is mapped in memory, not read: opening a graph is immediate whatever its
+ * size.
+ *
+ * A position and its mirror image are equivalent and share a node: positions are keyed by
+ * their canonical Game hash (see Game::canonicalHash()), and the Column of an edge is the one
+ * of the move in the canonical form of its origin position (see Game::canonicalColumn()). This
+ * key depends on the Discs of the Players, so a node can only be found from a Game whose
+ * Players have the Discs used to build the graph. Walking the edges from the root does not
+ * have this limitation.
+ *
+ **************************************************************************************************/
+class PositionGraph
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief The file header.
+     *
+     **********************************************************************************************/
+    struct Header
+    {
+        char          m_magic[8];       ///< "CXGRAPH" followed by a zero (0).
+        std::uint32_t m_version;        ///< The file format version.
+        std::uint8_t  m_nbRows;         ///< The number of Rows of the GameBoard.
+        std::uint8_t  m_nbColumns;      ///< The number of Columns of the GameBoard.
+        std::uint8_t  m_inARow;         ///< The @a inARow value.
+        std::uint8_t  m_nbPlayers;      ///< The number of Players.
+        std::uint64_t m_nbNodes;        ///< The number of nodes.
+        std::uint64_t m_nbEdges;        ///< The number of edges.
+        std::uint64_t m_root;           ///< The index of the empty GameBoard node.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief A distinct position.
+     *
+     **********************************************************************************************/
+    struct Node
+    {
+        std::uint64_t m_key;            ///< The position canonical Game hash.
+        std::uint32_t m_nbVisits;       ///< The number of Games which went through the position.
+        std::uint32_t m_nbDraws;        ///< How many of these Games ended with a full GameBoard.
+        std::uint32_t m_firstEdge;      ///< The index of the first move from the position.
+        std::uint32_t m_nbEdges;        ///< The number of moves from the position.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief A move from a position to another.
+     *
+     **********************************************************************************************/
+    struct Edge
+    {
+        std::uint32_t m_child;          ///< The index of the position after the move.
+        std::uint32_t m_nbVisits;       ///< The number of Games which made the move.
+        std::uint8_t  m_column;         ///< The Column of the move, in the canonical origin position.
+        std::uint8_t  m_reserved[3];    ///< Zeros (0).
+    };
+
+
+    /*******************************************************************************************//**
+     * Current file format version.
+     *
+     * @return The version written by the PositionGraphBuilder and expected by @c open().
+     *
+     **********************************************************************************************/
+    static std::uint32_t version() {return 2;}
+
+
+    /*******************************************************************************************//**
+     * File magic number.
+     *
+     * @return The eight (8) first bytes of every position graph.
+     *
+     **********************************************************************************************/
+    static const char* magic() {return "CXGRAPH";}
+
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Opens a position graph. Any graph previously opened is closed first.
+     *
+     * @param[in] p_path The graph file path.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be mapped or is
+     *         not a valid position graph.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode open(const std::string& p_path);
+
+
+    /*******************************************************************************************//**
+     * Closes the position graph.
+     *
+     **********************************************************************************************/
+    void close();
+
+///@}
+
+///@{ @name Data access
+
+    bool        isOpen()    const {return m_header != nullptr;}                                ///< Checks if a graph is open.
+    int         nbRows()    const {return isOpen() ? m_header->m_nbRows    : 0;}              ///< Number of Rows accessor.
+    int         nbColumns() const {return isOpen() ? m_header->m_nbColumns : 0;}              ///< Number of Columns accessor.
+    int         inARow()    const {return isOpen() ? m_header->m_inARow    : 0;}              ///< @a inARow value accessor.
+    int         nbPlayers() const {return isOpen() ? m_header->m_nbPlayers : 0;}              ///< Number of Players accessor.
+    std::size_t size()      const {return isOpen() ? static_cast<std::size_t>(m_header->m_nbNodes) : 0;} ///< Number of nodes.
+    std::size_t nbEdges()   const {return isOpen() ? static_cast<std::size_t>(m_header->m_nbEdges) : 0;} ///< Number of edges.
+    std::size_t root()      const {return isOpen() ? static_cast<std::size_t>(m_header->m_root)    : 0;} ///< The empty GameBoard node.
+
+    const Node& node(std::size_t p_node) const {return m_nodes[p_node];}                      ///< A node, by index.
+    const Edge* beginEdges(const Node& p_node) const {return m_edges + p_node.m_firstEdge;}   ///< The first move from a node.
+    const Edge* endEdges  (const Node& p_node) const {return m_edges + p_node.m_firstEdge + p_node.m_nbEdges;} ///< Past the last one.
+
+
+    /*******************************************************************************************//**
+     * Finds a position.
+     *
+     * @param[in] p_key The position canonical Game hash.
+     *
+     * @return The index of the node, or @c size() if the position is not in the graph.
+     *
+     * @pre A graph is open.
+     *
+     **********************************************************************************************/
+    std::size_t find(std::uint64_t p_key) const;
+
+
+    /*******************************************************************************************//**
+     * Number of wins accessor.
+     *
+     * @param[in] p_node The index of a node.
+     * @param[in] p_seat The index of a Player, in the Game's Player list.
+     *
+     * @return The number of Games through the node which were won by the Player.
+     *
+     * @pre A graph is open, the node exists and the Player index is smaller than the number of
+     *      Players.
+     *
+     **********************************************************************************************/
+    std::uint32_t nbWins(std::size_t p_node, int p_seat) const;
+
+///@}
+
+
+private:
+
+    cxutil::MappedFile   m_file;                ///< The mapped graph file.
+    const Header*        m_header{nullptr};     ///< The header, in the mapped file.
+    const Node*          m_nodes {nullptr};     ///< The nodes, in the mapped file.
+    const Edge*          m_edges {nullptr};     ///< The edges, in the mapped file.
+    const std::uint32_t* m_wins  {nullptr};     ///< The wins, by node then seat, in the mapped file.
+
+};
+
+} // namespace cxbase
+
+#endif /* POSITIONGRAPH_H_5A0C3E81_D7F2_4B96_A41E_8C3B92F06D57 */
@@ -0,0 +1,175 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    PositionGraphBuilder.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a position graph builder.
+ *
+ **************************************************************************************************/
+
+#ifndef POSITIONGRAPHBUILDER_H_E83F1B26_4C7D_4A09_9D5B_07A6E2C4F198
+#define POSITIONGRAPHBUILDER_H_E83F1B26_4C7D_4A09_9D5B_07A6E2C4F198
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cxutil/include/ReturnCode.h>
+
+#include "Game.h"
+#include "PositionGraph.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class PositionGraphBuilder
+ *
+ * @brief Replays Games and merges their positions in a position graph (see PositionGraph).
+ *
+ * Each Game is replayed on a Game owned by the builder, and each position it goes through is
+ * looked up by its canonical Game hash (see Game::canonicalHash()): a position already reached
+ * by another Game, maybe through other moves or as its mirror image, only has its counts
+ * updated. The whole graph is kept in memory until it is written.
+ *
+ * Distinct positions with the same 64 bits hash would be merged. This is very unlikely for the
+ * number of positions a graph can hold in memory, and is not checked.
+ *
+ **************************************************************************************************/
+class PositionGraphBuilder
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Constructor.
+     *
+     * @param[in] p_players   The Players of the Games. Their Discs define the position keys.
+     * @param[in] p_nbRows    The number of Rows of the Games.
+     * @param[in] p_nbColumns The number of Columns of the Games.
+     * @param[in] p_inARow    The @a inARow value of the Games.
+     *
+     * @pre The Players, GameBoard and @a inARow value make a valid Game, with at most 255 Rows,
+     *      Columns and Players.
+     *
+     **********************************************************************************************/
+    PositionGraphBuilder(const std::vector<std::shared_ptr<Player>>& p_players, int p_nbRows, int p_nbColumns, int p_inARow);
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Adds the positions of a Game.
+     *
+     * @param[in] p_columns The Column of every move of the Game, in order.
+     * @param[in] p_nbMoves The number of moves.
+     *
+     * @return @c true if the Game has been added, @c false if one of its moves is invalid
+     *         (outside the GameBoard, in a full Column or after the Game is won) or if the
+     *         counts of the graph are full. Nothing is added then.
+     *
+     **********************************************************************************************/
+    bool add(const std::uint8_t* p_columns, std::size_t p_nbMoves);
+
+
+    /*******************************************************************************************//**
+     * Adds the positions of a Game.
+     *
+     * @param[in] p_game The Game.
+     *
+     * @return @c true if the Game has been added, @c false otherwise (see above).
+     *
+     * @pre The Game has the shape of the graph.
+     *
+     **********************************************************************************************/
+    bool add(const Game& p_game);
+
+
+    /*******************************************************************************************//**
+     * Writes the position graph.
+     *
+     * @param[in] p_path The graph file path. An existing file is replaced.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file can not be written.
+     *
+     **********************************************************************************************/
+    cxutil::ReturnCode write(const std::string& p_path) const;
+
+///@}
+
+///@{ @name Data access
+
+    std::size_t   size()        const {return        m_keys.size();}    ///< Number of distinct positions.
+    std::size_t   nbEdges()     const {return        m_edges.size();}   ///< Number of distinct moves.
+    std::uint64_t nbGames()     const {return        m_nbGames;}        ///< Number of Games added.
+    std::uint64_t nbPositions() const {return        m_nbPositions;}    ///< Number of positions added, with repetitions.
+
+///@}
+
+
+private:
+
+    /*******************************************************************************************//**
+     * @brief An edge, before the nodes are sorted.
+     *
+     **********************************************************************************************/
+    struct Edge
+    {
+        std::uint32_t m_child;          ///< The index of the position after the move.
+        std::uint32_t m_nbVisits;       ///< The number of Games which made the move.
+    };
+
+    std::uint32_t nodeIndex(std::uint64_t p_key);
+
+    std::unique_ptr<Game>                            m_game;            ///< The Game on which Games are replayed.
+    int                                              m_nbPlayers;       ///< The number of Players.
+
+    std::unordered_map<std::uint64_t, std::uint32_t> m_indexes;         ///< The node index of every key.
+    std::vector<std::uint64_t>                       m_keys;            ///< The key of every node.
+    std::vector<std::uint32_t>                       m_nbVisits;        ///< The number of visits of every node.
+    std::vector<std::uint32_t>                       m_nbDraws;         ///< The number of draws of every node.
+    std::vector<std::uint32_t>                       m_nbWins;          ///< The wins of every node, by seat.
+    std::unordered_map<std::uint64_t, Edge>          m_edges;           ///< Edges, by origin node and Column.
+
+    std::vector<std::uint64_t>                       m_path;            ///< The keys of the Game being added.
+    std::vector<std::uint8_t>                        m_moves;           ///< Its moves, in canonical Columns.
+    std::uint64_t                                    m_nbGames    {0};  ///< The number of Games added.
+    std::uint64_t                                    m_nbPositions{0};  ///< The number of positions added.
+
+};
+
+} // namespace cxbase
+
+#endif /* POSITIONGRAPHBUILDER_H_E83F1B26_4C7D_4A09_9D5B_07A6E2C4F198 */
@@ -0,0 +1,233 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    WinningLines.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a winning line geometry utility.
+ *
+ **************************************************************************************************/
+
+#ifndef WINNINGLINES_H_6B2D9E47_1C8A_4F35_A0E6_93D74B5C218F
+#define WINNINGLINES_H_6B2D9E47_1C8A_4F35_A0E6_93D74B5C218F
+
+#include <memory>
+#include <vector>
+
+#include <cxutil/include/ContractException.h>
+
+#include "Position.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class WinningLines
+ *
+ * @brief Every winning window for a given board shape.
+ *
+ * A window is a string of @a inARow adjacent Positions (horizontal, vertical or diagonal) a
+ * Player could fill to win. For a given shape, i.e. a number of rows, a number of columns and an
+ * @a inARow value, the windows never change. WinningLines lists all of them once, as well as an
+ * index giving, for each Position, the windows containing it. Win, draw and threat checks then
+ * become simple table walks.
+ *
+ * WinningLines objects are immutable. Use @c forShape() to get the table for a specific shape:
+ * it is built the first time and then shared by every caller asking for the same shape.
+ *
+ * @invariant Every window holds exactly @a inARow Positions, all inside the grid.
+ *
+ **************************************************************************************************/
+class WinningLines
+{
+
+public:
+
+    /*******************************************************************************************//**
+     * @brief Window directions.
+     *
+     **********************************************************************************************/
+    enum class Direction: int
+    {
+        Horizontal,         ///< From left to right.
+        Vertical,           ///< From bottom to top.
+        DiagonalUpward,     ///< From bottom left to top right.
+        DiagonalDownward    ///< From top left to bottom right.
+    };
+
+
+    /*******************************************************************************************//**
+     * @brief A contiguous range of window indexes, usable in range-based for loops.
+     *
+     **********************************************************************************************/
+    class WindowRange
+    {
+
+    public:
+
+        WindowRange(const int* p_begin, const int* p_end): m_begin{p_begin}, m_end{p_end} {}
+
+        const int* begin() const {return m_begin;}
+        const int* end()   const {return m_end;}
+        int        size()  const {return static_cast<int>(m_end - m_begin);}
+
+    private:
+
+        const int* m_begin;
+        const int* m_end;
+
+    };
+
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default destructor.
+     *
+     **********************************************************************************************/
+    virtual ~WinningLines();
+
+
+    /*******************************************************************************************//**
+     * Constructor with parameters.
+     *
+     * Builds the table for a specific shape. Prefer @c forShape(), which only builds it once.
+     *
+     * @param[in] p_nbRows      The number of rows in the grid.
+     * @param[in] p_nbColumns   The number of columns in the grid.
+     * @param[in] p_inARow      The @a inARow value.
+     *
+     * @pre @c p_inARow is at least two (2).
+     * @pre @c p_inARow is not bigger than the number of rows or the number of columns.
+     *
+     **********************************************************************************************/
+    WinningLines(int p_nbRows, int p_nbColumns, int p_inARow);
+
+
+    /*******************************************************************************************//**
+     * Shared table accessor.
+     *
+     * Gives the table for a specific shape. It is built on the first call for this shape and
+     * shared afterwards. This method can safely be called from several threads.
+     *
+     * @param[in] p_nbRows      The number of rows in the grid.
+     * @param[in] p_nbColumns   The number of columns in the grid.
+     * @param[in] p_inARow      The @a inARow value.
+     *
+     * @pre Same as for the constructor.
+     *
+     * @return The shared table for the shape.
+     *
+     **********************************************************************************************/
+    static std::shared_ptr<const WinningLines> forShape(int p_nbRows, int p_nbColumns, int p_inARow);
+
+///@}
+
+
+///@{ @name Data access
+
+    int nbRows()     const {return m_nbRows;}
+    int nbColumns()  const {return m_nbColumns;}
+    int inARow()     const {return m_inARow;}
+
+
+    /*******************************************************************************************//**
+     * Number of windows accessor.
+     *
+     * @return The total number of windows, in all directions.
+     *
+     **********************************************************************************************/
+    int nbWindows() const {return static_cast<int>(m_directions.size());}
+
+
+    /*******************************************************************************************//**
+     * Window direction accessor.
+     *
+     * @param[in] p_window The window index.
+     *
+     * @pre The window index is between 0 and @c nbWindows() - 1.
+     *
+     * @return The direction of the window.
+     *
+     **********************************************************************************************/
+    Direction direction(int p_window) const;
+
+
+    /*******************************************************************************************//**
+     * Window Position accessor.
+     *
+     * @param[in] p_window The window index.
+     * @param[in] p_offset The offset of the Position in the window, from its first Position.
+     *
+     * @pre The window index is between 0 and @c nbWindows() - 1.
+     * @pre The offset is between 0 and @a inARow - 1.
+     *
+     * @return The Position.
+     *
+     **********************************************************************************************/
+    Position position(int p_window, int p_offset) const;
+
+
+    /*******************************************************************************************//**
+     * Windows containing a Position.
+     *
+     * @param[in] p_position The Position.
+     *
+     * @pre The Position is inside the grid.
+     *
+     * @return The indexes of all windows containing the Position.
+     *
+     **********************************************************************************************/
+    WindowRange windows(const Position& p_position) const;
+
+///@}
+
+
+protected:
+
+    void checkInvariant() const;
+
+
+private:
+
+    void addWindow(Direction p_direction, int p_startRow, int p_startColumn);
+
+    int                   m_nbRows;             ///< The number of rows in the grid.
+    int                   m_nbColumns;          ///< The number of columns in the grid.
+    int                   m_inARow;             ///< The @a inARow value.
+
+    std::vector<Direction> m_directions;        ///< The direction of each window.
+    std::vector<Position>  m_positions;         ///< The Positions of each window, in order.
+    std::vector<int>       m_positionOffsets;   ///< For each Position, where its windows start
+                                                ///< in @c m_positionWindows.
+    std::vector<int>       m_positionWindows;   ///< The windows containing each Position.
+
+};
+
+} // namespace cxbase
+
+#endif /* WINNINGLINES_H_6B2D9E47_1C8A_4F35_A0E6_93D74B5C218F */
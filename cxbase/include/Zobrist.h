@@ -0,0 +1,130 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    Zobrist.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a Zobrist hashing utility.
+ *
+ **************************************************************************************************/
+
+#ifndef ZOBRIST_H_A4E1C7B2_5D3F_4E8A_B6C9_0F2D7E91A35C
+#define ZOBRIST_H_A4E1C7B2_5D3F_4E8A_B6C9_0F2D7E91A35C
+
+#include <cstdint>
+
+#include <cxutil/include/ContractException.h>
+
+#include "Disc.h"
+#include "Position.h"
+
+
+namespace cxbase
+{
+
+/***********************************************************************************************//**
+ * @class Zobrist
+ *
+ * @brief Zobrist keys for Connect X positions.
+ *
+ * A Zobrist hash is the exclusive or of one pseudo-random key per occupied Position. Placing or
+ * removing a Disc is then a single exclusive or with the key for that Position and Disc, which
+ * makes the hash cheap to maintain incrementally.
+ *
+ * Keys only depend on the Row and Column of a Position and on the Color of the Disc. They do
+ * not depend on the order in which Discs were registered on a GameBoard, so two equal
+ * GameBoards always hash to the same value. Keys are generated from a fixed seed and are stable
+ * from one run to the next: hashes can be persisted.
+ *
+ **************************************************************************************************/
+class Zobrist
+{
+
+public:
+
+///@{ @name Keys
+
+    /*******************************************************************************************//**
+     * Key for a Disc.
+     *
+     * @param[in] p_disc The Disc.
+     *
+     * @return A key identifying the Disc, to be used with @c positionKey(). The key for
+     *         @c Disc::noDisc() is zero (0).
+     *
+     **********************************************************************************************/
+    static std::uint64_t discKey(const Disc& p_disc);
+
+
+    /*******************************************************************************************//**
+     * Key for a Disc at a specific Position.
+     *
+     * @param[in] p_row      The Row subscript of the Position.
+     * @param[in] p_column   The Column subscript of the Position.
+     * @param[in] p_discKey  The key of the Disc at this Position, as given by @c discKey().
+     *
+     * @pre The Row and Column subscripts are between 0 and 63.
+     *
+     * @return The Zobrist key for the Disc at the Position.
+     *
+     **********************************************************************************************/
+    static std::uint64_t positionKey(int p_row, int p_column, std::uint64_t p_discKey);
+
+
+    /*******************************************************************************************//**
+     * Key for a Disc at a specific Position.
+     *
+     * @param[in] p_position The Position.
+     * @param[in] p_disc     The Disc at the Position.
+     *
+     * @pre The Row and Column of the Position are between 0 and 63.
+     *
+     * @return The Zobrist key for the Disc at the Position.
+     *
+     **********************************************************************************************/
+    static std::uint64_t positionKey(const Position& p_position, const Disc& p_disc);
+
+
+    /*******************************************************************************************//**
+     * Key for the Player turn.
+     *
+     * @param[in] p_turn The Player turn.
+     *
+     * @pre The turn is positive.
+     *
+     * @return The Zobrist key for the turn. The key for the first turn is zero (0), so that a
+     *         Game hash for the first Player equals the hash of its GameBoard.
+     *
+     **********************************************************************************************/
+    static std::uint64_t turnKey(int p_turn);
+
+///@}
+
+};
+
+} // namespace cxbase
+
+#endif /* ZOBRIST_H_A4E1C7B2_5D3F_4E8A_B6C9_0F2D7E91A35C */
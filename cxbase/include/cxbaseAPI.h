@@ -34,9 +34,20 @@
 
 #include "Position.h"
 #include "Disc.h"
+#include "DiscPalette.h"
+#include "Zobrist.h"
 #include "GameBoard.h"
+#include "FixedGameBoard.h"
 #include "Player.h"
+#include "DefaultPlayers.h"
+#include "WinningLines.h"
+#include "EvaluationWeights.h"
+#include "LiveWindows.h"
 #include "Game.h"
+#include "GameArchive.h"
+#include "GameArchiveWriter.h"
+#include "PositionGraph.h"
+#include "PositionGraphBuilder.h"
 
 #endif /* CXBASEAPI_H_4CE91685_F206_49F2_AEBE_5CE420E5E72F */
 
@@ -0,0 +1,83 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    DefaultPlayers.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a default Players factory and a Game shape check.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+
+#include <cxutil/include/ContractException.h>
+
+#include "../include/DefaultPlayers.h"
+
+
+std::vector<std::shared_ptr<cxbase::Player>> cxbase::defaultPlayers(int p_nbPlayers)
+{
+    PRECONDITION(p_nbPlayers >= 0);
+
+    const Disc discs[]{Disc::blackDisc(),
+                       Disc::redDisc(),
+                       Disc::yellowDisc(),
+                       Disc::blueDisc(),
+                       Disc::greenDisc(),
+                       Disc::whiteDisc()};
+
+    std::vector<std::shared_ptr<Player>> players;
+
+    for(int player{0}; player < p_nbPlayers; ++player)
+    {
+        // Past the named colors, shades of grey:
+        const std::uint8_t grey{static_cast<std::uint8_t>(20 * player)};
+        const Disc disc{player < 6 ? discs[player] : Disc{cxutil::Color{cxutil::RGBA{grey, grey, grey, 255}}}};
+
+        players.push_back(std::make_shared<Player>(cxutil::Name{"Player " + std::to_string(player + 1)}, disc));
+    }
+
+    return players;
+}
+
+
+bool cxbase::isValidGameShape(int p_nbRows, int p_nbColumns, int p_inARow, int p_nbPlayers)
+{
+    // The GameBoard limits, then the Game constructor preconditions:
+    if(p_nbRows < 6 || p_nbRows > 64 || p_nbColumns < 7 || p_nbColumns > 64)
+    {
+        return false;
+    }
+
+    const int nbPositions{p_nbRows * p_nbColumns};
+
+    return p_inARow    >= 2                               &&
+           p_inARow    <  std::min(p_nbRows, p_nbColumns) &&
+           p_nbPlayers >= 2                               &&
+           p_nbPlayers <= nbPositions / p_inARow          &&
+           nbPositions % p_nbPlayers == 0;
+}
@@ -0,0 +1,101 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    DiscPalette.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a Disc interning utility.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <limits>
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/DiscPalette.h"
+
+
+using namespace cxbase;
+
+
+DiscPalette::~DiscPalette() = default;
+
+
+DiscPalette::DiscPalette(): m_discs{Disc::noDisc()}
+{
+    INVARIANTS();
+}
+
+
+bool DiscPalette::contains(const Disc& p_disc) const
+{
+    return std::find(m_discs.cbegin(), m_discs.cend(), p_disc) != m_discs.cend();
+}
+
+
+DiscId DiscPalette::id(const Disc& p_disc) const
+{
+    const auto position{std::find(m_discs.cbegin(), m_discs.cend(), p_disc)};
+
+    PRECONDITION(position != m_discs.cend());
+
+    return cxutil::narrow_cast<DiscId>(position - m_discs.cbegin());
+}
+
+
+const Disc& DiscPalette::disc(DiscId p_id) const
+{
+    PRECONDITION(p_id < m_discs.size());
+
+    return m_discs[p_id];
+}
+
+
+DiscId DiscPalette::intern(const Disc& p_disc)
+{
+    const auto position{std::find(m_discs.cbegin(), m_discs.cend(), p_disc)};
+
+    if(position != m_discs.cend())
+    {
+        return cxutil::narrow_cast<DiscId>(position - m_discs.cbegin());
+    }
+
+    PRECONDITION(m_discs.size() <= std::numeric_limits<DiscId>::max());
+
+    m_discs.push_back(p_disc);
+
+    INVARIANTS();
+
+    return cxutil::narrow_cast<DiscId>(m_discs.size() - 1);
+}
+
+
+void DiscPalette::checkInvariant() const
+{
+    INVARIANT(!m_discs.empty());
+    INVARIANT(m_discs[noDiscId()] == Disc::noDisc());
+    INVARIANT(m_discs.size() <= std::size_t{std::numeric_limits<DiscId>::max()} + 1);
+}
@@ -0,0 +1,166 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    EvaluationWeights.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a static evaluation weight table.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/EvaluationWeights.h"
+
+
+using namespace cxbase;
+
+
+namespace
+{
+
+using Shape = std::tuple<int, int, int>;
+
+/***********************************************************************************************//**
+ * @brief The tables in use, by shape.
+ *
+ **************************************************************************************************/
+struct Registry
+{
+    std::mutex                                                m_mutex;   ///< Guards the tables.
+    std::map<Shape, std::shared_ptr<const EvaluationWeights>> m_tables;  ///< The tables, by shape.
+};
+
+Registry& registry()
+{
+    static Registry s_registry;
+
+    return s_registry;
+}
+
+/***********************************************************************************************//**
+ * Builds the default table for an @a inARow value: each additional Disc in a window weighs four
+ * (4) times more. Weights stop growing after 21 Discs, so that no score can overflow.
+ *
+ * @param[in] p_inARow The @a inARow value.
+ *
+ * @return The default table.
+ *
+ **************************************************************************************************/
+std::shared_ptr<const EvaluationWeights> defaultWeights(int p_inARow)
+{
+    std::vector<std::int64_t> weights;
+
+    for(int nbDiscs{1}; nbDiscs <= p_inARow; ++nbDiscs)
+    {
+        weights.push_back(std::int64_t{1} << (2 * std::min(nbDiscs - 1, 20)));
+    }
+
+    return std::make_shared<const EvaluationWeights>(p_inARow, weights);
+}
+
+} // unamed namespace
+
+
+EvaluationWeights::~EvaluationWeights() = default;
+
+
+EvaluationWeights::EvaluationWeights(int p_inARow, const std::vector<std::int64_t>& p_weights): m_inARow{p_inARow}
+{
+    PRECONDITION(p_inARow >= 2);
+    PRECONDITION(p_weights.size() == cxutil::narrow_cast<std::size_t>(p_inARow));
+    PRECONDITION(std::none_of(p_weights.cbegin(), p_weights.cend(), [](std::int64_t p_weight){return p_weight < 0;}));
+
+    m_cumulatedWeights.push_back(0);
+
+    for(const std::int64_t weight : p_weights)
+    {
+        m_cumulatedWeights.push_back(m_cumulatedWeights.back() + weight);
+    }
+
+    INVARIANTS();
+}
+
+
+std::shared_ptr<const EvaluationWeights> EvaluationWeights::forShape(int p_nbRows, int p_nbColumns, int p_inARow)
+{
+    PRECONDITION(p_inARow >= 2);
+
+    Registry&                   registry{::registry()};
+    std::lock_guard<std::mutex> lock{registry.m_mutex};
+
+    std::shared_ptr<const EvaluationWeights>& table{registry.m_tables[Shape{p_nbRows, p_nbColumns, p_inARow}]};
+
+    if(!table)
+    {
+        table = defaultWeights(p_inARow);
+    }
+
+    return table;
+}
+
+
+void EvaluationWeights::registerShape(int p_nbRows, int p_nbColumns, const std::shared_ptr<const EvaluationWeights>& p_weights)
+{
+    PRECONDITION(p_weights != nullptr);
+
+    Registry&                   registry{::registry()};
+    std::lock_guard<std::mutex> lock{registry.m_mutex};
+
+    registry.m_tables[Shape{p_nbRows, p_nbColumns, p_weights->inARow()}] = p_weights;
+}
+
+
+std::int64_t EvaluationWeights::weight(int p_nbDiscs) const
+{
+    PRECONDITION(p_nbDiscs >= 1);
+    PRECONDITION(p_nbDiscs <= m_inARow);
+
+    const std::size_t nbDiscs{cxutil::narrow_cast<std::size_t>(p_nbDiscs)};
+
+    return m_cumulatedWeights[nbDiscs] - m_cumulatedWeights[nbDiscs - 1];
+}
+
+
+std::int64_t EvaluationWeights::cumulatedWeight(int p_nbDiscs) const
+{
+    PRECONDITION(p_nbDiscs >= 0);
+    PRECONDITION(p_nbDiscs <= m_inARow);
+
+    return m_cumulatedWeights[cxutil::narrow_cast<std::size_t>(p_nbDiscs)];
+}
+
+
+void EvaluationWeights::checkInvariant() const
+{
+    INVARIANT(m_cumulatedWeights.size() == cxutil::narrow_cast<std::size_t>(m_inARow + 1));
+}
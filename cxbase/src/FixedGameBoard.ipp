@@ -0,0 +1,320 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    FixedGameBoard.ipp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a GameBoard template utility with compile-time dimensions.
+ *
+ **************************************************************************************************/
+
+
+template<int NbRows, int NbColumns, int InARow>
+const std::size_t cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::NB_DISCS_MAX;
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::FixedGameBoard()
+{
+    m_discKeys.fill(Zobrist::discKey(Disc::noDisc()));
+    m_cells.fill(DiscPalette::noDiscId());
+    m_nextFreeRows.fill(0);
+
+    for(auto& bitplane : m_bitplanes)
+    {
+        bitplane.fill(0);
+    }
+
+    INVARIANTS();
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::DiscId cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::discId(const Position& p_position) const
+{
+    PRECONDITION(p_position.rowValue()    >= 0);
+    PRECONDITION(p_position.columnValue() >= 0);
+
+    PRECONDITION(p_position.rowValue()    < NbRows   );
+    PRECONDITION(p_position.columnValue() < NbColumns);
+
+    return m_cells[cellIndex(p_position.rowValue(), p_position.columnValue())];
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+std::uint64_t cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::columnBits(DiscId p_discId, const Column& p_column) const
+{
+    PRECONDITION(p_discId != DiscPalette::noDiscId());
+    PRECONDITION(p_discId < m_palette.size());
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < NbColumns);
+
+    return m_bitplanes[p_discId][static_cast<std::size_t>(p_column.value())];
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::Column cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::canonicalColumn(const Column& p_column) const
+{
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < NbColumns);
+
+    return m_mirroredHash < m_hash ? Column{NbColumns - 1 - p_column.value()} : p_column;
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::Position cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::placeDisc(const Column& p_column, const Disc& p_disc)
+{
+    PRECONDITION(p_disc != Disc::noDisc());
+
+    return placeDisc(p_column, registerDisc(p_disc));
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::Position cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::placeDisc(const Column& p_column, DiscId p_discId)
+{
+    PRECONDITION(p_discId != DiscPalette::noDiscId());
+    PRECONDITION(p_discId < m_palette.size());
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < NbColumns);
+
+    const std::size_t column{static_cast<std::size_t>(p_column.value())};
+    int               rowSubscript{m_nextFreeRows[column]};
+
+    if(rowSubscript < NbRows)
+    {
+        m_cells[cellIndex(rowSubscript, p_column.value())] = p_discId;
+        m_bitplanes[p_discId][column] |= std::uint64_t{1} << rowSubscript;
+        ++m_nextFreeRows[column];
+
+        m_hash         ^= Zobrist::positionKey(rowSubscript, p_column.value(), m_discKeys[p_discId]);
+        m_mirroredHash ^= Zobrist::positionKey(rowSubscript, NbColumns - 1 - p_column.value(), m_discKeys[p_discId]);
+    }
+    else
+    {
+        // Full Column: the top most Position is returned.
+        rowSubscript = NbRows - 1;
+    }
+
+    INVARIANTS();
+
+    return Position{Row{rowSubscript}, p_column};
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::Position cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::removeDisc(const Column& p_column)
+{
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < NbColumns);
+
+    const std::size_t column{static_cast<std::size_t>(p_column.value())};
+
+    PRECONDITION(m_nextFreeRows[column] > 0);
+
+    const int         rowSubscript{--m_nextFreeRows[column]};
+    const std::size_t index{cellIndex(rowSubscript, p_column.value())};
+    const DiscId      discId{m_cells[index]};
+
+    m_bitplanes[discId][column] &= ~(std::uint64_t{1} << rowSubscript);
+    m_cells[index] = DiscPalette::noDiscId();
+
+    m_hash         ^= Zobrist::positionKey(rowSubscript, p_column.value(), m_discKeys[discId]);
+    m_mirroredHash ^= Zobrist::positionKey(rowSubscript, NbColumns - 1 - p_column.value(), m_discKeys[discId]);
+
+    INVARIANTS();
+
+    return Position{Row{rowSubscript}, p_column};
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::DiscId cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::registerDisc(const Disc& p_disc)
+{
+    PRECONDITION(p_disc != Disc::noDisc());
+    PRECONDITION(m_palette.contains(p_disc) || m_palette.size() < NB_DISCS_MAX);
+
+    const DiscId id{m_palette.intern(p_disc)};
+
+    m_discKeys[id] = Zobrist::discKey(p_disc);
+
+    INVARIANTS();
+
+    return id;
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+bool cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::isColumnFull(const Column& p_column) const
+{
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < NbColumns);
+
+    return m_nextFreeRows[static_cast<std::size_t>(p_column.value())] == NbRows;
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+bool cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::isWinningPosition(const Position& p_position) const
+{
+    const DiscId id{discId(p_position)};
+
+    if(id == DiscPalette::noDiscId())
+    {
+        return false;
+    }
+
+    const Bitplane& bitplane{m_bitplanes[id]};
+
+    // Vertical: the run must start between the lower limit and the Position itself.
+    const std::size_t column{static_cast<std::size_t>(p_position.columnValue())};
+    const int         lowerLimit{lowerValidationLimit(p_position.rowValue())};
+
+    std::uint64_t verticalRuns{bitplane[column] & windowStartRows(WinningLines::Direction::Vertical)};
+
+    for(int offset{1}; offset < InARow; ++offset)
+    {
+        verticalRuns &= bitplane[column] >> offset;
+    }
+
+    const std::uint64_t candidateStarts{(std::uint64_t{2} << p_position.rowValue()) - (std::uint64_t{1} << lowerLimit)};
+
+    return (verticalRuns & candidateStarts) != 0 ||
+           hasLine(bitplane, p_position,  0, WinningLines::Direction::Horizontal) ||
+           hasLine(bitplane, p_position,  1, WinningLines::Direction::DiagonalUpward) ||
+           hasLine(bitplane, p_position, -1, WinningLines::Direction::DiagonalDownward);
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+bool cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::operator==(const FixedGameBoard& p_gameBoard) const
+{
+    if(m_hash != p_gameBoard.m_hash || m_nextFreeRows != p_gameBoard.m_nextFreeRows)
+    {
+        return false;
+    }
+
+    // Both palettes are not necessarily in the same order, so bitplanes are matched by Disc:
+    for(std::size_t id{1}; id < m_palette.size(); ++id)
+    {
+        const Disc& disc{m_palette.disc(static_cast<DiscId>(id))};
+
+        if(!p_gameBoard.m_palette.contains(disc))
+        {
+            if(m_bitplanes[id] != Bitplane{})
+            {
+                return false;
+            }
+        }
+        else if(m_bitplanes[id] != p_gameBoard.m_bitplanes[p_gameBoard.m_palette.id(disc)])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+bool cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::operator!=(const FixedGameBoard& p_gameBoard) const
+{
+    return !(*this == p_gameBoard);
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+cxbase::Disc cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::operator()(const Position& p_position) const
+{
+    return m_palette.disc(discId(p_position));
+}
+
+
+/***********************************************************************************************//**
+ * Checks for a winning line going through a Position, from left to right. Each Column word is
+ * shifted so that the Rows of a same line are aligned, and then all @a inARow words are combined.
+ * The Rows where a line can start (see @c windowStartRows()) are known at compile time, so lines
+ * leaving the grid are masked out instead of being checked.
+ *
+ * @param[in] p_bitplane  The bitplane of the Disc at the Position.
+ * @param[in] p_position  The Position the line must go through.
+ * @param[in] p_rowStep   The Row increment from one Column to the next: 0 for horizontal lines,
+ *                        1 for upward diagonals and -1 for downward diagonals.
+ * @param[in] p_direction The direction matching the Row increment.
+ *
+ * @return @c true if such a line exists, @c false otherwise.
+ *
+ **************************************************************************************************/
+template<int NbRows, int NbColumns, int InARow>
+bool cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::hasLine(const Bitplane&          p_bitplane,
+                                                               const Position&          p_position,
+                                                               int                      p_rowStep,
+                                                               WinningLines::Direction  p_direction) const
+{
+    const int row{p_position.rowValue()};
+    const int column{p_position.columnValue()};
+
+    const int firstStart{leftValidationLimit(column)};
+    const int lastStart{rightValidationLimit(column) - (InARow - 1)};
+
+    for(int start{firstStart}; start <= lastStart; ++start)
+    {
+        // Row of the line in its first Column:
+        const int startRow{row - p_rowStep * (column - start)};
+
+        if(startRow < 0 || startRow >= NbRows)
+        {
+            continue;
+        }
+
+        std::uint64_t line{windowStartRows(p_direction)};
+
+        for(int offset{0}; offset < InARow; ++offset)
+        {
+            const std::uint64_t word{p_bitplane[static_cast<std::size_t>(start + offset)]};
+
+            line &= p_rowStep >= 0 ? word >> (p_rowStep * offset) : word << (-p_rowStep * offset);
+        }
+
+        if(((line >> startRow) & 1) != 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+template<int NbRows, int NbColumns, int InARow>
+void cxbase::FixedGameBoard<NbRows, NbColumns, InARow>::checkInvariant() const
+{
+    INVARIANT(m_palette.size() <= NB_DISCS_MAX);
+
+    INVARIANT(std::all_of(m_nextFreeRows.cbegin(), m_nextFreeRows.cend(), [](int p_row){return p_row >= 0 && p_row <= NbRows;}));
+}
@@ -30,14 +30,68 @@
  **************************************************************************************************/
 
 #include <algorithm>
+#include <limits>
 
 #include <cxutil/include/narrow_cast.h>
 
 #include "../include/Game.h"
+#include "../include/Zobrist.h"
 
 using namespace cxbase;
 
 
+namespace
+{
+
+// Row steps of the horizontal, diagonal upward and diagonal downward lines, Columns going right:
+const int         LINE_ROW_STEPS[]{0, 1, -1};
+const std::size_t NB_LINES        {3};
+
+/***********************************************************************************************//**
+ * Checks if a Position is a threat of a Player along one horizontal or diagonal line, whether
+ * the Position is empty or not. This is the case if the Player's Discs on both sides of the
+ * Position, along the line, add up to at least @a inARow - 1.
+ *
+ * @param[in] p_words   The Player's word for the Column of the Position, with at least
+ *                      @a inARow - 1 words on each side (see GameBoard::columnBits()).
+ * @param[in] p_nbRows  The number of Rows.
+ * @param[in] p_inARow  The @a inARow value.
+ * @param[in] p_row     The Row of the Position.
+ * @param[in] p_rowStep The Row increment for each Column to the right (-1, 0 or 1).
+ *
+ * @return @c true if the Position is a threat along the line, @c false otherwise.
+ *
+ **************************************************************************************************/
+bool isLineThreat(const std::uint64_t* p_words, int p_nbRows, int p_inARow, int p_row, int p_rowStep)
+{
+    const auto isOwned = [p_words, p_nbRows](int p_distance, int p_lineRow)
+    {
+        return p_lineRow >= 0 && p_lineRow < p_nbRows && ((p_words[p_distance] >> p_lineRow) & 1u) != 0;
+    };
+
+    int nbDiscs{0};
+
+    for(int distance{1}; nbDiscs < p_inARow - 1 && isOwned(-distance, p_row - distance * p_rowStep); ++distance)
+    {
+        ++nbDiscs;
+    }
+
+    for(int distance{1}; nbDiscs < p_inARow - 1 && isOwned(distance, p_row + distance * p_rowStep); ++distance)
+    {
+        ++nbDiscs;
+    }
+
+    return nbDiscs == p_inARow - 1;
+}
+
+} // unamed namespace
+
+
+
+const int Game::NOT_WINNABLE;
+const int Game::NOBODY;
+
+
 Game::~Game() = default;
 
 
@@ -59,67 +113,134 @@ Game::Game(const std::vector<std::shared_ptr<Player>>& p_players, const std::sha
     PRECONDITION(p_inARow < std::min(p_gameboard->nbColumns(), p_gameboard->nbRows()));
     PRECONDITION((p_gameboard->nbColumns() * p_gameboard->nbRows()) % m_players.size() == 0);
 
+    // Every Player Disc gets its identifier on the GameBoard before the first move:
+    for(const auto& player : m_players)
+    {
+        m_playerDiscIds.push_back(m_gameboard->registerDisc(player->disc()));
+    }
+
+    // So that making moves never allocates:
+    m_completedMovePositions.reserve(cxutil::narrow_cast<std::size_t>(m_gameboard->nbPositions()));
+    m_winningPositions.reserve(cxutil::narrow_cast<std::size_t>(4 * 2 * (m_inARow - 1) + 1));
+
+    // Early draws and scores are followed through live windows from now on:
+    m_lines   = WinningLines::forShape(m_gameboard->nbRows(), m_gameboard->nbColumns(), m_inARow);
+    m_weights = EvaluationWeights::forShape(m_gameboard->nbRows(), m_gameboard->nbColumns(), m_inARow);
+
+    initializeLiveWindows();
+    updateEarlyDraw();
+
+    // And threats through the Players' bitplanes:
+    initializeThreats();
+
     INVARIANTS();
 }
 
 
-Player Game::activePlayer() const
+const Player& Game::activePlayer() const
 {
-    return *(m_players[m_turn]);
+    return *(m_players[cxutil::narrow_cast<std::size_t>(m_turn)]);
 }
 
 
-// Source: https://stackoverflow.com/questions/46921528/detect-early-tie-in-connect-4/46928055#46928055
-bool Game::isEarlyDraw() const
+DiscId Game::discIdOf(int p_playerIndex) const
 {
-    bool validPlaysAreStillAvailable{false};
+    PRECONDITION(p_playerIndex >= 0);
+    PRECONDITION(p_playerIndex < nbPlayers());
 
-    for(auto& player : m_players)
-    {
-        validPlaysAreStillAvailable |= canPlayerWinHorizontal(*player);
+    return m_playerDiscIds[cxutil::narrow_cast<std::size_t>(p_playerIndex)];
+}
 
-        if(!validPlaysAreStillAvailable)
-        {
-            validPlaysAreStillAvailable |= canPlayerWinVertical(*player);
-        }
 
-        if(!validPlaysAreStillAvailable)
-        {
-            validPlaysAreStillAvailable |= canPlayerWinDiagonalUpward(*player);
-        }
-        
-        if(!validPlaysAreStillAvailable)
-        {
-            validPlaysAreStillAvailable |= canPlayerWinDiagonalDownward(*player);
-        }
-    }
+std::uint64_t Game::hash() const
+{
+    return m_gameboard->hash() ^ Zobrist::turnKey(m_turn);
+}
 
-    return !validPlaysAreStillAvailable;
+
+std::uint64_t Game::canonicalHash() const
+{
+    const std::uint64_t turnKey{Zobrist::turnKey(m_turn)};
+
+    return std::min(m_gameboard->hash() ^ turnKey, m_gameboard->mirroredHash() ^ turnKey);
 }
 
 
-bool Game::isDraw() const
+Column Game::canonicalColumn(const Column& p_column) const
 {
-     return m_nbOfCompletedMoves == m_gameboard->nbPositions();
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < m_gameboard->nbColumns());
+
+    // The turn key changes the order of both hashes, so the GameBoard's choice may not hold:
+    const std::uint64_t turnKey{Zobrist::turnKey(m_turn)};
+    const bool          isMirrored{(m_gameboard->mirroredHash() ^ turnKey) < (m_gameboard->hash() ^ turnKey)};
+
+    return isMirrored ? Column{m_gameboard->nbColumns() - 1 - p_column.value()} : p_column;
 }
 
 
-bool Game::isWon() const
+std::uint64_t Game::threats(int p_playerIndex, const Column& p_column) const
 {
-    bool isWinner{false};
+    PRECONDITION(p_playerIndex >= 0);
+    PRECONDITION(p_playerIndex < nbPlayers());
+    PRECONDITION(p_column.value() >= 0);
+    PRECONDITION(p_column.value() < m_gameboard->nbColumns());
 
-    const int nbOfSucessfulMoves{cxutil::narrow_cast<int>(m_completedMovePositions.size())};
-    const int nbOfPlayers{cxutil::narrow_cast<int>(m_players.size())};
+    return columnThreats(p_playerIndex, p_column.value());
+}
 
-    if(nbOfSucessfulMoves >= nbOfPlayers * (m_inARow - 1) + 1)
+
+std::uint64_t Game::winningColumns(int p_playerIndex) const
+{
+    PRECONDITION(p_playerIndex >= 0);
+    PRECONDITION(p_playerIndex < nbPlayers());
+
+    return m_winningColumns[cxutil::narrow_cast<std::size_t>(p_playerIndex)];
+}
+
+
+std::int64_t Game::score(int p_playerIndex) const
+{
+    PRECONDITION(p_playerIndex >= 0);
+    PRECONDITION(p_playerIndex < nbPlayers());
+
+    return m_liveWindows.score(p_playerIndex) + m_columnScores[cxutil::narrow_cast<std::size_t>(p_playerIndex)];
+}
+
+
+std::int64_t Game::evaluation() const
+{
+    std::int64_t bestOtherScore{std::numeric_limits<std::int64_t>::min()};
+
+    for(int index{0}; index < nbPlayers(); ++index)
     {
-        if(checkHorizontalWinner() || checkVerticalWinner() || checkUpwardWinner()|| checkDownwardWinner())
+        if(index != m_turn)
         {
-            isWinner = true;
+            bestOtherScore = std::max(bestOtherScore, score(index));
         }
     }
 
-    return isWinner;
+    return score(m_turn) - bestOtherScore;
+}
+
+
+void Game::setEvaluationWeights(const std::shared_ptr<const EvaluationWeights>& p_weights)
+{
+    PRECONDITION(p_weights != nullptr);
+    PRECONDITION(p_weights->inARow() == m_inARow);
+
+    m_weights = p_weights;
+
+    // Live windows are counted again with the new weights:
+    initializeLiveWindows();
+
+    INVARIANTS();
+}
+
+
+bool Game::isDraw() const
+{
+     return m_nbOfCompletedMoves == m_gameboard->nbPositions();
 }
 
 
@@ -133,17 +254,33 @@ bool Game::makeMove(const Column& p_column)
     if(!m_gameboard->isColumnFull(p_column))
     {
         // The move is good, we make it:
-        Position completedMovePosition{m_gameboard->placeDisc(p_column, m_players[m_turn]->disc())};
+        Position completedMovePosition{m_gameboard->placeDisc(p_column, m_playerDiscIds[cxutil::narrow_cast<std::size_t>(m_turn)])};
 
         // Then, we register its position:
         m_completedMovePositions.push_back(completedMovePosition);
 
         // And the number of completed moves:
         m_nbOfCompletedMoves = cxutil::narrow_cast<int>(m_completedMovePositions.size());
-        //std::cout << m_nbOfCompletedMoves << std::endl;
+
+        // Then, we check if it was a winning move:
+        updateWinningPositions();
+
+        // Only the windows containing the new Disc are affected:
+        m_liveWindows.addDisc(completedMovePosition, m_turn);
+
+        const LiveColumn& column{m_liveColumns[cxutil::narrow_cast<std::size_t>(p_column.value())]};
+
+        m_verticalRuns[cxutil::narrow_cast<std::size_t>(p_column.value() * m_gameboard->nbRows() + completedMovePosition.rowValue())] =
+            (column.m_topOwner == m_turn) ? std::min(column.m_topRun + 1, m_inARow) : 1;
+
+        updateLiveColumn(p_column.value(), completedMovePosition.rowValue() + 1);
+
+        updateThreats(m_turn, completedMovePosition);
 
         // Finally, next player is up:
-        m_turn = (m_turn + 1) % cxutil::narrow_cast<int>(m_players.size());
+        m_turn = (m_turn + 1) % nbPlayers();
+
+        updateEarlyDraw();
 
         success = true;
     }
@@ -152,6 +289,39 @@ bool Game::makeMove(const Column& p_column)
 }
 
 
+void Game::undoMove()
+{
+    PRECONDITION(!m_completedMovePositions.empty());
+
+    // The last Disc is taken out:
+    const Position lastMovePosition{m_completedMovePositions.back()};
+    const int      lastPlayerIndex {previousPlayerIndex()};
+
+    m_gameboard->removeDisc(lastMovePosition.column());
+    m_completedMovePositions.pop_back();
+
+    // Only the windows that contained it are affected, and exactly as they were by makeMove():
+    m_liveWindows.removeDisc(lastMovePosition, lastPlayerIndex);
+
+    // The freed Position is the Column's next available one:
+    updateLiveColumn(lastMovePosition.columnValue(), lastMovePosition.rowValue());
+
+    // The number of completed moves is updated:
+    m_nbOfCompletedMoves = cxutil::narrow_cast<int>(m_completedMovePositions.size());
+
+    // The now last move could have been a winning one:
+    updateWinningPositions();
+
+    // Finally, the previous player is up again:
+    m_turn = lastPlayerIndex;
+
+    updateThreats(m_turn, lastMovePosition);
+    updateEarlyDraw();
+
+    INVARIANTS();
+}
+
+
 const int& Game::connectThree()
 {
     static const int CONNECT_THREE{3};
@@ -238,14 +408,12 @@ void Game::checkInvariant() const
 /***********************************************************************************************//**
  * Finds the last Player to have successfully placed a Disc in the GameBoard.
  *
- * @return The last Player to have successfully placed a Disc in the GameBoard.
+ * @return The index of the last Player to have successfully placed a Disc in the GameBoard.
  *
  **************************************************************************************************/
-Player Game::previousPlayer() const
+int Game::previousPlayerIndex() const
 {
-    const int nbPlayers{cxutil::narrow_cast<int>(m_players.size())};
-
-    return *(m_players[(m_turn + (nbPlayers - 1)) % nbPlayers]);
+    return (m_turn + (nbPlayers() - 1)) % nbPlayers();
 }
 
 
@@ -271,72 +439,18 @@ Position Game::positionOfLastSuccessFullMove() const
  **************************************************************************************************/
 bool Game::isPlayerInGame(const Player& p_player) const
 {
-    const auto player{std::find(m_players.begin(), m_players.end(), std::make_shared<Player>(p_player))};
-    
-    return player != m_players.end();
-}
-
-
-/***********************************************************************************************//**
- * Calculates the remaining possible moves number for a Player from the numbers of moves already
- * consluded in the Game. 
- *
- * @pre The Player specified as an argument is registered in the Game.
- *
- * @param[in] p_player          The Player which we want to know the current count of remaining
- *                              actual moves available.
- * @param[in] p_nbOfCompletedMoves The number of moves completed at the point in the Game for which 
- *                              the number of remaining moves needs to be known.
- *
- * @return The number of actual moves remaining for the Player.
- *
- **************************************************************************************************/
-int Game::nbRemainingMoves(const Player& p_player, const int p_nbOfCompletedMoves) const
-{
-    const int nbMovesLeft{m_gameboard->nbPositions() - p_nbOfCompletedMoves};//
-    const int remainingMovesQuotient{nbMovesLeft / cxutil::narrow_cast<int>(m_players.size())};
-    const int remainingMovesRest{nbMovesLeft % cxutil::narrow_cast<int>(m_players.size())};
-
-    int nbRemainingMoves{remainingMovesQuotient};
-
-    // Check if process is really necessary: do all players deserve an equal share?
-    if(remainingMovesRest != 0)
-    {
-        // Find position of p_player in the player list:
-        const auto playerPosition{std::find(m_players.begin(),
-                                            m_players.end(),
-                                            std::make_shared<Player>(p_player))};
-
-        // Check all candidate postition for an extra turn and see if the player is there:
-        for(int offset{0}; offset < remainingMovesRest; ++offset)
-        {
-            const int firstTurnWithMoreMoves{currentTurn()};
-            const int nextTurnWithMoreMoves{(firstTurnWithMoreMoves + offset) % cxutil::narrow_cast<int>(m_players.size())};
-
-            const auto candidatePosition{m_players.begin() + nextTurnWithMoreMoves};
-
-            if(playerPosition == candidatePosition)
-            {
-                nbRemainingMoves = remainingMovesQuotient + 1;
-            }
-            else
-            {
-                nbRemainingMoves = remainingMovesQuotient;
-            }
-        }
-    }
-    else
-    {
-        nbRemainingMoves = remainingMovesQuotient;
-    }
-    
-    return nbRemainingMoves;
+    return std::any_of(m_players.cbegin(), m_players.cend(), [&p_player](const std::shared_ptr<Player>& p_candidate)
+                       {
+                           return *p_candidate == p_player;
+                       });
 }
 
 
 /***********************************************************************************************//**
- * Calculates the remaining possible moves number for a Player from the current configuration. For 
- * example, consider this classic Connect 4 gameboard, where the Player A made the last move:
+ * Calculates the number of moves a Player has left before the GameBoard is full. Moves are given
+ * in turn, starting with the active Player, so Players coming sooner in the turn order may get one
+ * more move than the others. For example, consider this classic Connect 4 gameboard, where the
+ * Player A made the last move:
  *
  * @verbatim
  *
@@ -354,974 +468,514 @@ int Game::nbRemainingMoves(const Player& p_player, const int p_nbOfCompletedMove
  *
  * In this situation, Player A has at most two more moves.
  *
- * @pre The Player specified as an argument is registered in the Game.
- *
- * @param[in] p_player The Player which we want to know the current count of remaining actual 
- *                     moves available.
+ * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
  *
  * @return The number of actual moves remaining for the Player.
  *
- * @see @c isTie()
- * @see @c canPlayerWinHorizontal()
- *
  **************************************************************************************************/
-int Game::nbRemainingMoves(const Player& p_player) const
+int Game::nbRemainingMoves(int p_playerIndex) const
 {
-    return nbRemainingMoves(p_player, nbOfCompletedMoves());
+    const int nbOfPlayers{cxutil::narrow_cast<int>(m_players.size())};
+    const int nbMovesLeft{m_gameboard->nbPositions() - m_nbOfCompletedMoves};
+
+    // Number of moves other Players make before this Player's next move:
+    const int nbMovesBeforeNextTurn{(p_playerIndex - m_turn + nbOfPlayers) % nbOfPlayers};
+
+    return nbMovesBeforeNextTurn < nbMovesLeft ? (nbMovesLeft - nbMovesBeforeNextTurn - 1) / nbOfPlayers + 1 : 0;
 }
 
 
 /***********************************************************************************************//**
- * Finds the turn of a specific player.
+ * Finds the Player owning a Disc on the GameBoard.
  *
- * @param[in] p_player The Player whose turn is needed.
+ * @param[in] p_discId The identifier of a Disc on the GameBoard.
  *
- * @return The turn of the Player.
+ * @return The index of the Player, in the Game's Player list, or @c NOT_WINNABLE if the Disc
+ *         does not belong to any Player (in which case no window holding it can be won).
  *
  **************************************************************************************************/
-int Game::playerTurn(const Player& p_player) const
+int Game::playerIndex(DiscId p_discId) const
 {
-    int playerTurn{0};
-
-    if(p_player == activePlayer())
-    {
-        playerTurn = currentTurn();
-    }
-    else
-    {
-        for(int position{0}; position < cxutil::narrow_cast<int>(m_players.size()); ++position)
-        {
-            if(*m_players[position] == p_player)
-            {
-                break;
-            }
-
-            ++playerTurn;
-        }
-    }
-    
-    return playerTurn;
+    return p_discId < m_playerIndexes.size() ? m_playerIndexes[p_discId] : NOT_WINNABLE;
 }
 
 
 /***********************************************************************************************//**
- * Finds the number of turns that took place since a Player last successfully placed a disc.
- *
- * param[in] p_player The Player for which the number of turn since last sucessful move is
- *                    needed.
+ * Adds (or removes) the vertical windows of a Column to the scores. The only open vertical
+ * windows are the ones holding the top of the Player's run on top of the Column, and enough
+ * empty Positions above it to complete the window inside the GameBoard. There is one for each
+ * number of Discs, from the number of Discs the empty Positions can not hold by themselves up to
+ * the length of the run.
  *
- * return The number of turns since the Player made his last successful move.
+ * @param[in] p_column The Column.
+ * @param[in] p_count  One (1) to add the windows, minus one (-1) to remove them.
  *
  **************************************************************************************************/
-int Game::nbOfMovesSinceLastPlay(const Player& p_player) const
+void Game::countLiveColumn(const LiveColumn& p_column, int p_count)
 {
-    int positionCurrent{0};
-    
-    if(m_turn == 0)
-    {
-        positionCurrent = cxutil::narrow_cast<int>(m_players.size()) - 1;
-    }
-    else
+    if(p_column.m_topOwner < 0)
     {
-        positionCurrent = m_turn - 1;
+        return;
     }
-    const int positionInspected{playerTurn(p_player)};
-
-    // Find the distance between the two Players:
-    int nbOfMoves{0};
 
-    if(positionCurrent < positionInspected)
-    {
-        nbOfMoves = positionCurrent + (cxutil::narrow_cast<int>(m_players.size()) - positionInspected);
-    }
+    const int fewestDiscs{std::max(m_inARow - p_column.m_nbEmpty, 1)};
+    const int mostDiscs  {std::min(p_column.m_topRun, m_inARow)};
 
-    if(positionCurrent > positionInspected)
+    if(fewestDiscs <= mostDiscs)
     {
-        nbOfMoves = positionCurrent - positionInspected;
+        m_columnScores[cxutil::narrow_cast<std::size_t>(p_column.m_topOwner)] += p_count * (m_weights->cumulatedWeight(mostDiscs) - m_weights->cumulatedWeight(fewestDiscs - 1));
     }
-
-    return nbOfMoves;
 }
 
 
 /***********************************************************************************************//**
- * Checks if a Column contains at least one Disc from a specific Player.
- *
- * @pre p_column is valid on the GameBoard.
- *
- * @param[in] p_player The Players for which we want to know if at least one of his Disc is 
- *                     present in the specified Column.
- * @param[in] p_column The Column in which to perform the check.
+ * Updates the top of a Column after a Disc was added to it or removed from it. The new top Disc
+ * is found from the Column's next available Row, and the length of its run was recorded when it
+ * was played, so nothing needs to be scanned.
  *
- * return A @c bool indicating if the Column contains at least one Disc from the specified Player.
+ * @param[in] p_column      The Column.
+ * @param[in] p_nextFreeRow The Column's next available Row.
  *
  **************************************************************************************************/
-bool Game::isPlayerPresentInColumn(const Player& p_player, const Column& p_column) const
+void Game::updateLiveColumn(int p_column, int p_nextFreeRow)
 {
-    bool isPlayerPresent{false};
+    LiveColumn& column{m_liveColumns[cxutil::narrow_cast<std::size_t>(p_column)]};
 
-    for(int rowIndex{0}; rowIndex < m_gameboard->nbRows(); ++rowIndex)
+    countLiveColumn(column, -1);
+
+    column = LiveColumn{};
+    column.m_nbEmpty = m_gameboard->nbRows() - p_nextFreeRow;
+
+    if(p_nextFreeRow > 0)
     {
-        if((*m_gameboard)(Position{Row{rowIndex}, p_column}) == p_player.disc())
-        {
-            isPlayerPresent = true;
-            break;
-        }
+        const int topRow{p_nextFreeRow - 1};
+
+        column.m_topOwner = playerIndex(m_gameboard->discId(Position{Row{topRow}, Column{p_column}}));
+        column.m_topRun   = m_verticalRuns[cxutil::narrow_cast<std::size_t>(p_column * m_gameboard->nbRows() + topRow)];
     }
 
-    return isPlayerPresent;
+    countLiveColumn(column, 1);
 }
 
 
 /***********************************************************************************************//**
- * Finds the Player' Disc Position that is the furthest away from the bottom of the GameBoard in 
- * the specified column.
- *
- * @pre  The specified Player must have a Disc present in the speficied Column.
- * @post The @c return ed value corresponds to a valid row index.
- *
- * @param[in] p_player The Player whose maximum Position in the specified Column must be known.
- * @param[in] p_column The Column in which to perform the check.
- *
- * @return An integer corresponding to the Row index of the furthest away from the bottom Player's 
- *         Disc Position. If the Player has no Disc in the specified Column, the @c return ed 
- *         integer is zero (0).
- *
- * @see Game::isPlayerPresentInColumn
+ * Builds the live windows and Columns from the GameBoard's current content.
  *
  **************************************************************************************************/
-int Game::maxVerticalPositionForPlayerInColumn(const Player& p_player, const Column& p_column) const
+void Game::initializeLiveWindows()
 {
-    int maxPosition{0};
+    const int nbRows   {m_gameboard->nbRows()};
+    const int nbColumns{m_gameboard->nbColumns()};
 
-    for(int rowIndex{0}; rowIndex < m_gameboard->nbRows(); ++rowIndex)
+    m_playerIndexes.assign(m_gameboard->palette().size(), NOT_WINNABLE);
+
+    for(int index{nbPlayers() - 1}; index >= 0; --index)
     {
-        if((*m_gameboard)(Position{Row{rowIndex}, p_column}) == p_player.disc())
-        {
-            maxPosition = rowIndex;
-        }
+        m_playerIndexes[m_playerDiscIds[cxutil::narrow_cast<std::size_t>(index)]] = index;
     }
 
-    return maxPosition;
-}
-
+    // Vertical windows are followed through the Columns instead:
+    m_liveWindows = LiveWindows{m_lines, nbPlayers(), m_weights, false};
+    m_columnScores.assign(m_players.size(), 0);
 
-/***********************************************************************************************//**
- * This method checks for any remaining winnable horizontal combinations for a Player on a 
- * GameBoard. For example, consider this GameBoard, where Player A just made a move:
- *
- * @verbatim
- *
- *                               |
- *                               v
- *   5 | B |   |   |   |   |   | A |
- *   4 | A | B | A | B | A | B | A |
- *   3 | A | B | A | B | A | B | A |
- *   2 | B | A | B | A | B | A | B |
- *   1 | B | A | B | A | B | A | B |
- *   0 | A | B | A | B | A | B | A |
- *       0   1   2   3   4   5   6
- *
- * @endverbatim
- *
- * If you call this method on Player A, it will return @c false since Player A has no more 
- * horizontal and winnable moves ahead. However, if you call it in Player B, it will return 
- * @c true since Player B has one last possibility for a win:
- *
- * @verbatim
- *
- *     ***   WIN!   ***
- *   5 | B | B | B | B | A | A | A |
- *   4 | A | B | A | B | A | B | A |
- *   3 | A | B | A | B | A | B | A |
- *   2 | B | A | B | A | B | A | B |
- *   1 | B | A | B | A | B | A | B |
- *   0 | A | B | A | B | A | B | A |
- *       0   1   2   3   4   5   6
- *
- * @endverbatim
- *
- * @param[in] p_player The Player we want to know if he/she can still win horizontally.
- *
- * @return @c true if the player can still win horizontally, @c false otherwise.
- *
- **************************************************************************************************/
-bool Game::canPlayerWinHorizontal(const Player& p_player) const
-{
-    bool canPlayerWin{false};
+    m_liveColumns.assign(cxutil::narrow_cast<std::size_t>(nbColumns), LiveColumn{});
+    m_verticalRuns.assign(cxutil::narrow_cast<std::size_t>(m_gameboard->nbPositions()), 0);
 
-    // Row to check:
-    for(int rowIndex{0}; rowIndex < m_gameboard->nbRows(); ++rowIndex)
+    for(int column{0}; column < nbColumns; ++column)
     {
-        // Use these columns for starting point of the checks:
-        for(int columnIndex{0}; columnIndex < (m_gameboard->nbColumns() - m_inARow) + 1; ++columnIndex)
+        int row{0};
+
+        for(; row < nbRows; ++row)
         {
-            bool isPlayFree{true};
-            int nbOfEmptyDiscsInRow{0};
+            const Position position{Row{row}, Column{column}};
+            const DiscId   discId  {m_gameboard->discId(position)};
 
-            // Check only for the good inARow value:
-            for(int offset{0}; offset < m_inARow; ++offset)
+            if(discId == DiscPalette::noDiscId())
             {
-                isPlayFree &= (*m_gameboard)(Position{Row{rowIndex}, Column{columnIndex + offset}}) == p_player.disc() ||
-                              (*m_gameboard)(Position{Row{rowIndex}, Column{columnIndex + offset}}) == Disc::noDisc();
-
-                // If the space is free, we record it for later checks:
-                if((*m_gameboard)(Position{Row{rowIndex}, Column{columnIndex + offset}}) == Disc::noDisc())
-                {
-                    ++nbOfEmptyDiscsInRow;
-                }
+                break;
             }
 
-            // Make sure there is enough space left for the current player to win:
-            isPlayFree &= (nbOfEmptyDiscsInRow <= nbRemainingMoves(p_player));
+            m_liveWindows.addDisc(position, playerIndex(discId));
 
-            // As soon as one play is still free for a win, we record it:
-            canPlayerWin |= isPlayFree;
+            const std::size_t run{cxutil::narrow_cast<std::size_t>(column * nbRows + row)};
+            const bool        isOnRun{row > 0 && m_gameboard->discId(Position{Row{row - 1}, Column{column}}) == discId};
 
-            if(canPlayerWin)
-            {
-                break;
-            }
+            m_verticalRuns[run] = isOnRun ? std::min(m_verticalRuns[run - 1] + 1, m_inARow) : 1;
         }
 
-        if(canPlayerWin)
-        {
-            break;
-        }
+        updateLiveColumn(column, row);
     }
-
-    return canPlayerWin;
 }
 
 
 /***********************************************************************************************//**
- * This method checks for any remaining winnable vertical combinations for a Player on a 
- * GameBoard. For example, consider this GameBoard, where Player B just made a move:
+ * Checks if a Player can still win the Game. A Player can still win if at least one window is
+ * free of other Players' Discs and has no more empty Positions than the Player has remaining
+ * moves. For example, consider this GameBoard, where Player A just made a move:
  *
  * @verbatim
  *
- *                           |
- *                           v
- *   5 | B | A | B | B |   |   |   |
- *   4 | A | B | A | A | B |   |   |
- *   3 | B | A | B | B | A | B |   |
- *   2 | A | B | A | A | B | A | A |
- *   1 | B | A | B | B | A | B | B |
- *   0 | A | B | A | A | B | A | A |
+ *                               |
+ *                               v
+ *   5 | B |   |   |   |   |   | A |
+ *   4 | A | B | A | B | A | B | A |
+ *   3 | A | B | A | B | A | B | A |
+ *   2 | B | A | B | A | B | A | B |
+ *   1 | B | A | B | A | B | A | B |
+ *   0 | A | B | A | B | A | B | A |
  *       0   1   2   3   4   5   6
  *
  * @endverbatim
  *
- * If you call this method on Player B, it will return @c false because there are no more 
- * vertical winner moves for B. If you call it for Player A though, the method will return 
- * @c true because A can still win vertically like so:
+ * Player A can no longer win, but Player B still can, by filling Row 5 from Column 1 to 3.
  *
- * @verbatim
+ * Vertical windows are handled differently, since they are filled from the bottom: the Player
+ * must drop its missing Discs in the Column one after the other, while the other Players play
+ * their moves in between elsewhere. The only moves they can give to the Column are the ones made
+ * before the Player's next turn, to start a new string higher up, if the Column has enough room
+ * for it. The Player's earliest chance is always the best one, so a vertical string can be
+ * completed if, at that moment, the other Players' moves fit in the empty Positions of the
+ * other Columns.
  *
- *   5 | B | A | B | B | B |   | A | ***
- *   4 | A | B | A | A | B | B | A | WIN
- *   3 | B | A | B | B | A | B | A |
- *   2 | A | B | A | A | B | A | A | ***
- *   1 | B | A | B | B | A | B | B |
- *   0 | A | B | A | A | B | A | A |
- *       0   1   2   3   4   5   6
+ * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
  *
- * @endverbatim
- *
- * @param[in] p_player The Player we want to know if he/she can still win vertically.
- *
- * @return @c true if the player can still win vertically, @c false otherwise.
+ * @return @c true if the Player can still win, @c false otherwise.
  *
  **************************************************************************************************/
-bool Game::canPlayerWinVertical(const Player& p_player) const
+bool Game::canPlayerWin(int p_playerIndex) const
 {
-    bool canPlayerWin{false};
-
-    // We calculate the number of remaining moves for all the other players:
-    int nbRemainingMovesOtherPlayers{0};
+    const int nbRemainingMoves{this->nbRemainingMoves(p_playerIndex)};
 
-    // Find the inspected Player's turn:
-    int inspectedPlayerTurn{playerTurn(p_player)};
+    if(m_liveWindows.nbEmptyWindows() > 0 && m_inARow <= nbRemainingMoves)
+    {
+        return true;
+    }
 
-    for(int playerTurn{0}; playerTurn < cxutil::narrow_cast<int>(m_players.size()); ++playerTurn)
+    for(int nbEmpty{0}; nbEmpty <= std::min(m_inARow - 1, nbRemainingMoves); ++nbEmpty)
     {
-        if(playerTurn != inspectedPlayerTurn)
+        if(m_liveWindows.nbLiveWindows(p_playerIndex, nbEmpty) > 0)
         {
-            const int nbOfTurnsRemainingFromLastMove{nbOfCompletedMoves() - nbOfMovesSinceLastPlay(*m_players[playerTurn])};
-            nbRemainingMovesOtherPlayers += nbRemainingMoves(*m_players[playerTurn], nbOfTurnsRemainingFromLastMove);
+            return true;
         }
     }
 
-    // Then we perform the check on the grid:
+    const int nbOfPlayers          {nbPlayers()};
+    const int nbMovesLeft          {m_gameboard->nbPositions() - m_nbOfCompletedMoves};
+    const int nbMovesBeforeNextTurn{(p_playerIndex - m_turn + nbOfPlayers) % nbOfPlayers};
 
-    // Column to check:
-    for(int columnIndex{0}; columnIndex <  m_gameboard->nbColumns(); ++columnIndex)
+    for(const auto& column : m_liveColumns)
     {
-        // Use these columns for starting point of the checks:
-        for(int rowIndex{0}; rowIndex < m_gameboard->nbRows() - (m_inARow - 1); ++rowIndex)
-        {
-            bool isPlayFree{true};
-
-            // Check only for the good inARow value:
-            for(int offset{0}; offset < m_inARow; ++offset)
-            {
-                isPlayFree &= (*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex}}) == p_player.disc() ||
-                              (*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex}}) == Disc::noDisc();
-            }
+        const bool isOnTop {column.m_topOwner == p_playerIndex};
+        const int  nbNeeded{isOnTop ? m_inARow - column.m_topRun : m_inARow};
 
-                // The following makes sure that even though a move is seen as free, there is 
-                // enough free positions and remaining moves for the current player.
-                if(isPlayFree)
-                {
-                    const int  nbRemainingMovesTotal          {(m_gameboard->nbRows() * m_gameboard->nbColumns()) - nbOfCompletedMoves()};
-                    const bool isPlayerInColumn               {isPlayerPresentInColumn(p_player, Column{columnIndex})};
-                    const int  maxVerticalPositionForPlayer   {isPlayerInColumn ? maxVerticalPositionForPlayerInColumn(p_player, Column{columnIndex}): -1};
-                    const int  nbRemainingMovesInOtherColumns {nbRemainingMovesTotal - (m_gameboard->nbRows() - (maxVerticalPositionForPlayer + 1))};
-
-                    // There should be enough room elswhere on the board to store all other players'
-                    // remaining moves, otherwhise the move will pile up on the critical column and 
-                    // a win becomes impossible: the discs will alternate!
-                    isPlayFree &= (nbRemainingMovesOtherPlayers <= nbRemainingMovesInOtherColumns);
-                }
+        // Moves given to the Column below a new string, and moves left to play elsewhere:
+        const int nbBelow     {isOnTop ? 0 : std::max(std::min(nbMovesBeforeNextTurn, column.m_nbEmpty - m_inARow), 0)};
+        const int nbOtherMoves{nbMovesBeforeNextTurn - nbBelow + (nbNeeded - 1) * (nbOfPlayers - 1)};
 
-            // As soon as one play is still free for a win, we record it:
-            canPlayerWin |= isPlayFree;
+        if(nbBelow + nbNeeded <= column.m_nbEmpty && nbOtherMoves <= nbMovesLeft - column.m_nbEmpty)
+        {
+            return true;
         }
     }
 
-    return canPlayerWin;
+    return false;
 }
 
 
 /***********************************************************************************************//**
- * This method checks for any remaining winnable upward diagonal combinations for a Player on a 
- * GameBoard. For example, consider this GameBoard, where Player A just made a move:
- *
- * @verbatim
- *
- *                                |
- *                                v
- *    5 | B | B | A | B |   |   |   |
- *    4 | A | A | B | A | A | B | A |
- *    3 | B | B | A | B | B | B | A |
- *    2 | A | A | B | A | A | A | B |
- *    1 | B | B | A | B | B | B | A |
- *    0 | A | A | B | A | A | B | A |
- *        0   1   2   3   4   5   6
- *
- * @endverbatim
- *
- * If you call this method on Player B, it will return @c false since Player B has no more 
- * upward diagonal and winnable moves ahead. However, if you call it in Player A, it will return 
- * @c true since Player A has one last possibility for a win:
- *
- * @verbatim
- *
- *          ***   WIN    ***
- *    5 | B | B | A | B | A | B |   |
- *    4 | A | A | B | A | A | B | A |
- *    3 | B | B | A | B | B | B | A |
- *    2 | A | A | B | A | A | A | B |
- *    1 | B | B | A | B | B | B | A |
- *    0 | A | A | B | A | A | B | A |
- *        0   1   2   3   4   5   6
- *
- * @endverbatim
- *
- * @param[in] p_player The Player we want to know if he/she can still win upward diagonally.
- *
- * @return @c true if the player can still win upward diagonally, @c false otherwise.
+ * Updates the cached early draw status from the live window counters.
  *
  **************************************************************************************************/
-bool Game::canPlayerWinDiagonalUpward(const Player& p_player) const
+void Game::updateEarlyDraw()
 {
-    bool canPlayerWin{false};
+    m_isEarlyDraw = true;
 
-    // Row to check:
-    for(int rowIndex{0}; rowIndex < (m_gameboard->nbRows() - m_inARow) + 1; ++rowIndex)
+    for(int index{0}; index < nbPlayers() && m_isEarlyDraw; ++index)
     {
-        // Use these columns for starting point of the checks:
-        for(int columnIndex{0}; columnIndex < (m_gameboard->nbColumns() - m_inARow) + 1; ++columnIndex)
-        {
-            bool isPlayFree{true};
-            int nbOfEmptyDiscsInDiagonal{0};
-
-            // Check only for the good inARow value:
-            for(int offset{0}; offset < m_inARow; ++offset)
-            {
-                isPlayFree &= (*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex + offset}}) == p_player.disc() ||
-                              (*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex + offset}}) == Disc::noDisc();
-
-                // If the space is free, we record it for later checks:
-                if((*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex + offset}}) == Disc::noDisc())
-                {
-                    ++nbOfEmptyDiscsInDiagonal;
-                }
-            }
-
-            // Make sure there is enough space left for the current player to win:
-            isPlayFree &= (nbOfEmptyDiscsInDiagonal <= nbRemainingMoves(p_player));
-
-            // As soon as one play is still free for a win, we record it:
-            canPlayerWin |= isPlayFree;
-
-            if(canPlayerWin)
-            {
-                break;
-            }
-        }
-
-        if(canPlayerWin)
-        {
-            break;
-        }
+        m_isEarlyDraw = !canPlayerWin(index);
     }
-
-    return canPlayerWin;
 }
 
 
 /***********************************************************************************************//**
- * This method checks for any remaining winnable downward diagonal combinations for a Player on a 
- * GameBoard. For example, consider this GameBoard, where Player A just made a move:
- *
- * @verbatim
- *
- *        |
- *        v
- *    5 |   |   |   | B | A | B | B |
- *    4 | A | B | A | A | B | A | A |
- *    3 | A | B | B | B | A | B | B |
- *    2 | B | A | A | A | B | A | A |
- *    1 | A | B | B | B | A | B | B |
- *    0 | A | B | A | A | B | A | A |
- *        0   1   2   3   4   5   6
+ * Gives the threats of a Player in a Column, in all directions, on empty Positions only.
+ * Vertical threats only depend on the top of the Column, so they are found from the live
+ * Column instead of being stored.
  *
- * @endverbatim
- *
- * If you call this method on Player B, it will return @c false since Player B has no more 
- * downward diagonal and winnable moves ahead. However, if you call it in Player A, it will return 
- * @c true since Player A has one last possibility for a win:
- *
- * @verbatim
- *
- *              ***   WIN    ***
- *    5 |   | B | A | B | A | B | B |
- *    4 | A | B | A | A | B | A | A |
- *    3 | A | B | B | B | A | B | B |
- *    2 | B | A | A | A | B | A | A |
- *    1 | A | B | B | B | A | B | B |
- *    0 | A | B | A | A | B | A | A |
- *        0   1   2   3   4   5   6
- *
- * @endverbatim
+ * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+ * @param[in] p_column      The Column.
  *
- * @param[in] p_player The Player we want to know if he/she can still win downward diagonally.
- *
- * @return @c true if the player can still win downward diagonally @c false otherwise.
+ * @return The threat Rows of the Player in the Column, as a bit mask.
  *
  **************************************************************************************************/
-bool Game::canPlayerWinDiagonalDownward(const Player& p_player) const
+std::uint64_t Game::columnThreats(int p_playerIndex, int p_column) const
 {
-    bool canPlayerWin{false};
+    const LiveColumn& column{m_liveColumns[cxutil::narrow_cast<std::size_t>(p_column)]};
 
-    // Row to check:
-    for(int rowIndex{0}; rowIndex < (m_gameboard->nbRows()) - (m_inARow - 1); ++rowIndex)
+    if(column.m_nbEmpty == 0)
     {
-        // Use these columns for starting point of the checks:
-        for(int columnIndex{m_inARow - 1}; columnIndex < m_gameboard->nbColumns() - 1; ++columnIndex)
-        {
-            bool isPlayFree{true};
-            int nbOfEmptyDiscsInDiagonal{0};
-
-            // Check only for the good inARow value:
-            for(int offset{0}; offset < m_inARow; ++offset)
-            {
-                isPlayFree &= (*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex - offset}}) == p_player.disc() ||
-                              (*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex - offset}}) == Disc::noDisc();
-
-                // If the space is free, we record it for later checks:
-                if((*m_gameboard)(Position{Row{rowIndex + offset}, Column{columnIndex - offset}}) == Disc::noDisc())
-                {
-                    ++nbOfEmptyDiscsInDiagonal;
-                }
-            }
+        return 0;
+    }
 
-            // Make sure there is enough space left for the current player to win:
-            isPlayFree &= (nbOfEmptyDiscsInDiagonal <= nbRemainingMoves(p_player));
+    const int           nbRows     {m_gameboard->nbRows()};
+    const int           nextFreeRow{nbRows - column.m_nbEmpty};
+    const std::uint64_t emptyRows  {(~std::uint64_t{0} >> (64 - nbRows)) & (~std::uint64_t{0} << nextFreeRow)};
 
-            // As soon as one play is still free for a win, we record it:
-            canPlayerWin |= isPlayFree;
+    const std::uint64_t* const lineThreats{&m_threats[threatIndex(p_playerIndex, p_column)]};
 
-            if(canPlayerWin)
-            {
-                break;
-            }
-        }
+    std::uint64_t threats{(lineThreats[0] | lineThreats[1] | lineThreats[2]) & emptyRows};
 
-        if(canPlayerWin)
-        {
-            break;
-        }
+    // A vertical string can only be completed right on top of the Column:
+    if(column.m_topOwner == p_playerIndex && column.m_topRun >= m_inARow - 1)
+    {
+        threats |= std::uint64_t{1} << nextFreeRow;
     }
 
-    return canPlayerWin;
+    return threats;
 }
 
 
 /***********************************************************************************************//**
- * Computes the left-most limit needed for validation.
- *
- * @param[in] p_validationType The type of validation.
+ * Updates whether a Player wins by dropping a Disc in a Column, from its threats and the
+ * Column's next available Row.
  *
- * @return The index of the left-most column to consider in the validation.
+ * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+ * @param[in] p_column      The Column.
  *
  **************************************************************************************************/
-int Game::leftValidationLimit(GridValidationType p_validationType) const
+void Game::updateWinningColumn(int p_playerIndex, int p_column)
 {
-    const Position lastMovePosition{positionOfLastSuccessFullMove()};
-
-    const int lastPlayedRow{lastMovePosition.rowValue()};
-    const int lastPlayedColumn{lastMovePosition.columnValue()};
+    const int  nbEmpty  {m_liveColumns[cxutil::narrow_cast<std::size_t>(p_column)].m_nbEmpty};
+    const bool isWinning{nbEmpty > 0 && ((columnThreats(p_playerIndex, p_column) >> (m_gameboard->nbRows() - nbEmpty)) & 1u) != 0};
 
-    int leftSubscript{lastPlayedColumn - (m_inARow - 1)};
-    leftSubscript = std::max(leftSubscript, 0);
+    std::uint64_t& winningColumns{m_winningColumns[cxutil::narrow_cast<std::size_t>(p_playerIndex)]};
 
-    if(p_validationType == GridValidationType::DiagonalDownward)
-    {
-        int lowerSubscript{lastPlayedRow + (m_inARow - 1)};
-        lowerSubscript = std::min(m_gameboard->nbRows() - 1, lowerSubscript);
-
-        if(lastPlayedColumn - leftSubscript > lowerSubscript - lastPlayedRow)
-        {
-            leftSubscript = lastPlayedColumn - (lowerSubscript - lastPlayedRow);
-        }
-    }
-    else if(p_validationType == GridValidationType::DiagonalUpward)
-    {
-        int upperSubscript{lastPlayedRow - (m_inARow - 1)};
-        upperSubscript = std::max(0, upperSubscript);
-
-        if(lastPlayedColumn - leftSubscript > lastPlayedRow - upperSubscript)
-        {
-            leftSubscript = lastPlayedColumn - (lastPlayedRow - upperSubscript);
-        }
-    }
-
-    return leftSubscript;
+    winningColumns = (winningColumns & ~(std::uint64_t{1} << p_column)) | (std::uint64_t{isWinning} << p_column);
 }
 
 
 /***********************************************************************************************//**
- * Computes the right-most limit needed for validation.
- *
- * @param[in] p_validationType The type of validation.
+ * Updates the threats after a Player has made (or taken back) a move. Only this Player's Discs
+ * have changed, and a Position's threat status along a line only depends on the Discs within
+ * @a inARow - 1 Positions on that line. So only the Positions on the three non vertical lines
+ * through the move, up to @a inARow - 1 Columns away, are checked again. The threat status of
+ * the move Position itself does not depend on its own content. The height of the Column has
+ * changed for everybody though, which can make it a winning Column (or not anymore) for any
+ * Player.
  *
- * @return The index of the right-most column to consider in the validation.
+ * @param[in] p_playerIndex The index of the Player who made the move.
+ * @param[in] p_position    The Position of the move.
  *
  **************************************************************************************************/
-int Game::rightValidationLimit(GridValidationType p_validationType) const
-
+void Game::updateThreats(int p_playerIndex, const Position& p_position)
 {
-    const Position lastMovePosition{positionOfLastSuccessFullMove()};
+    const int row   {p_position.rowValue()};
+    const int column{p_position.columnValue()};
+    const int nbRows{m_gameboard->nbRows()};
 
-    const int lastPlayedRow{lastMovePosition.rowValue()};
-    const int lastPlayedColumn{lastMovePosition.columnValue()};
+    m_discWords[discWordIndex(p_playerIndex, column)] ^= std::uint64_t{1} << row;
 
-    int rightSubscript{lastPlayedColumn + (m_inARow - 1)};
-    rightSubscript = std::min(rightSubscript, m_gameboard->nbColumns() - 1);
+    const int first{std::max(column - (m_inARow - 1), 0)};
+    const int last {std::min(column + (m_inARow - 1), m_gameboard->nbColumns() - 1)};
 
-    if(p_validationType == GridValidationType::DiagonalDownward)
+    for(int other{first}; other <= last; ++other)
     {
-        int upperSubscript{(lastPlayedRow) - (m_inARow - 1)};
-        upperSubscript = std::max(0, upperSubscript);
-
-        if(rightSubscript - lastPlayedColumn > lastPlayedRow - upperSubscript)
+        if(other == column)
         {
-            rightSubscript = lastPlayedColumn + (lastPlayedRow - upperSubscript);
+            continue;
         }
-    }
-    else if(p_validationType == GridValidationType::DiagonalUpward)
-    {
-        int lowerSubscript{lastPlayedRow + (m_inARow - 1)};
-        lowerSubscript = std::min(m_gameboard->nbRows() - 1, lowerSubscript);
 
-        if(rightSubscript - lastPlayedColumn > lowerSubscript - lastPlayedRow)
-        {
-            rightSubscript = lastPlayedColumn + (lowerSubscript - lastPlayedRow);
-        }
-    }
-
-    return rightSubscript;
-}
-
-
-/***********************************************************************************************//**
- * Computes the upper-most limit needed for validation.
- *
- * @param[in] p_validationType The type of validation.
- *
- * @return The index of the upper-most row to consider in the validation.
- *
- **************************************************************************************************/
-int Game::upperValidationLimit(GridValidationType p_validationType) const
-{
-    const Position lastMovePosition{positionOfLastSuccessFullMove()};
+        // Columns outside the GameBoard have empty words, so walking the lines needs no bound:
+        const std::uint64_t* const words      {&m_discWords[discWordIndex(p_playerIndex, other)]};
+        std::uint64_t* const       lineThreats{&m_threats[threatIndex(p_playerIndex, other)]};
 
-    const int lastPlayedRow{lastMovePosition.rowValue()};
-    const int lastPlayedColumn{lastMovePosition.columnValue()};
-
-    int upperSubscript{lastPlayedRow + (m_inARow - 1)};
-    upperSubscript = std::min(m_gameboard->nbRows() - 1, upperSubscript);
+        for(std::size_t line{0}; line < NB_LINES; ++line)
+        {
+            const int lineRow{row + (other - column) * LINE_ROW_STEPS[line]};
 
-    if(p_validationType == GridValidationType::DiagonalDownward)
-    {
-        int leftSubscript{lastPlayedColumn - (m_inARow - 1)};
-        leftSubscript = std::max(leftSubscript, 0);
+            if(lineRow >= 0 && lineRow < nbRows)
+            {
+                const std::uint64_t bit{std::uint64_t{1} << lineRow};
 
-        if(upperSubscript - lastPlayedRow > lastPlayedColumn - leftSubscript)
-        {
-            upperSubscript = lastPlayedRow + (lastPlayedColumn - leftSubscript);
+                lineThreats[line] = isLineThreat(words, nbRows, m_inARow, lineRow, LINE_ROW_STEPS[line]) ? (lineThreats[line] | bit) : (lineThreats[line] & ~bit);
+            }
         }
-    }
-    else if(p_validationType == GridValidationType::DiagonalUpward)
-    {
-        int rightSubscript{lastPlayedColumn + (m_inARow - 1)};
-        rightSubscript = std::min(rightSubscript, m_gameboard->nbColumns() - 1);
 
-        if(upperSubscript - lastPlayedRow > rightSubscript - lastPlayedColumn)
-        {
-            upperSubscript = lastPlayedRow + (rightSubscript - lastPlayedColumn);
-        }
+        updateWinningColumn(p_playerIndex, other);
     }
 
-    return upperSubscript;
+    for(int index{0}; index < nbPlayers(); ++index)
+    {
+        updateWinningColumn(index, column);
+    }
 }
 
 
 /***********************************************************************************************//**
- * Computes the lower-most limit needed for validation.
+ * Finds a Player's word for a Column in @c m_discWords.
  *
- * @param[in] p_validationType The type of validation.
+ * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+ * @param[in] p_column      The Column, possibly up to @a inARow - 1 Columns outside the GameBoard.
  *
- * @return The index of the lower-most row to consider in the validation.
+ * @return The index of the word.
  *
  **************************************************************************************************/
-int Game::lowerValidationLimit(GridValidationType p_validationType) const
+std::size_t Game::discWordIndex(int p_playerIndex, int p_column) const
 {
-    const Position lastMovePosition{positionOfLastSuccessFullMove()};
-
-    const int lastPlayedRow{lastMovePosition.rowValue()};
-    const int lastPlayedColumn{lastMovePosition.columnValue()};
+    const int nbWords{m_gameboard->nbColumns() + 2 * (m_inARow - 1)};
 
-    int lowerSubscript{lastPlayedRow - (m_inARow - 1)};
-    lowerSubscript = std::max(0, lowerSubscript);
-
-    if(p_validationType == GridValidationType::DiagonalDownward)
-    {
-        int rightSubscript{lastPlayedColumn + (m_inARow - 1)};
-        rightSubscript = std::min(rightSubscript, m_gameboard->nbColumns() - 1);
-
-        if(lastPlayedRow - lowerSubscript > rightSubscript - lastPlayedColumn)
-        {
-            lowerSubscript = lastPlayedRow - (rightSubscript - lastPlayedColumn);
-        }
-    }
-    else if(p_validationType == GridValidationType::DiagonalUpward)
-    {
-        int leftSubscript = lastPlayedColumn - (m_inARow - 1);
-        leftSubscript = std::max(leftSubscript, 0);
-
-        if(lastPlayedRow - lowerSubscript > lastPlayedColumn - leftSubscript)
-        {
-            lowerSubscript = lastPlayedRow - (lastPlayedColumn - leftSubscript);
-        }
-    }
-
-    return lowerSubscript;
+    return cxutil::narrow_cast<std::size_t>(p_playerIndex * nbWords + (m_inARow - 1) + p_column);
 }
 
 
 /***********************************************************************************************//**
- * Computes the number of <em> in a row </em> Positions to check.
+ * Finds a Player's threats for a Column in @c m_threats.
  *
- * @param[in] p_minValidationLimit The minimum index to check.
- * @param[in] p_maxValidationLimit The maximum index to check.
+ * @param[in] p_playerIndex The index of the Player, in the Game's Player list.
+ * @param[in] p_column      The Column.
  *
- * @return The number of Positions to check.
+ * @return The index of the Column's horizontal threats, followed by its diagonal ones.
  *
  **************************************************************************************************/
-int Game::nbOfValidations(int p_minValidationLimit, int p_maxValidationLimit) const
+std::size_t Game::threatIndex(int p_playerIndex, int p_column) const
 {
-    int nbCombinationsToCheck{abs(p_maxValidationLimit - p_minValidationLimit) + 1};
-    nbCombinationsToCheck = nbCombinationsToCheck - (m_inARow - 1);
-
-    return nbCombinationsToCheck;
+    return (cxutil::narrow_cast<std::size_t>(p_playerIndex) * m_liveColumns.size() + cxutil::narrow_cast<std::size_t>(p_column)) * NB_LINES;
 }
 
 
 /***********************************************************************************************//**
- * Computes the number of adjacent, identical Discs that are horizontally alligned from the 
- * current Position. The bounds for the computation are determined by the GameBoard geometry 
- * and the <em> in a row </em> value for the Game. Note that the method filters empty Discs
- * from the computation, as Players are not allow to use them.
- *
- * @return The number of adjacent, identical Discs that are horizontally alligned from the current
- *         Position.
+ * Reads the Players' Discs from the GameBoard, then computes all threats and winning Columns,
+ * one Position at a time, the same way @c updateThreats() does.
  *
  **************************************************************************************************/
-int Game::horizontalNbOfAdjacentDiscs() const
+void Game::initializeThreats()
 {
+    const int nbRows   {m_gameboard->nbRows()};
+    const int nbColumns{m_gameboard->nbColumns()};
 
-    const int leftLimit{leftValidationLimit()};
-    const int rightLimit{rightValidationLimit()};
-    const int nbValidations{nbOfValidations(leftLimit, rightLimit)};
-
-    int pairIdenticalDiscs{0};
-    int nbIdenticalDiscs{0};
+    m_discWords.assign(m_players.size() * cxutil::narrow_cast<std::size_t>(nbColumns + 2 * (m_inARow - 1)), 0);
+    m_threats.assign(m_players.size() * m_liveColumns.size() * NB_LINES, 0);
+    m_winningColumns.assign(m_players.size(), 0);
 
-    const Position lastMovePosition{positionOfLastSuccessFullMove()};
-
-    Row rowLastPlacedDisc{lastMovePosition.row()};
-
-    for(int i{leftLimit}; i < leftLimit + nbValidations; ++i)
+    for(int index{0}; index < nbPlayers(); ++index)
     {
-        for(int j{0}; j < m_inARow - 1; ++j)
+        for(int column{0}; column < nbColumns; ++column)
         {
-            if(((*m_gameboard)(Position{rowLastPlacedDisc, Column{i + j}}) != Disc::noDisc()) &&
-               ((*m_gameboard)(Position{rowLastPlacedDisc, Column{i + j}}) == (*m_gameboard)(Position{rowLastPlacedDisc, Column{i + j + 1}})))
-            {
-                pairIdenticalDiscs++;
-            }
+            m_discWords[discWordIndex(index, column)] = m_gameboard->columnBits(discIdOf(index), Column{column});
         }
+    }
 
-        if(pairIdenticalDiscs == m_inARow - 1)
+    for(int index{0}; index < nbPlayers(); ++index)
+    {
+        for(int column{0}; column < nbColumns; ++column)
         {
-            nbIdenticalDiscs = pairIdenticalDiscs + 1;
+            const std::uint64_t* const words{&m_discWords[discWordIndex(index, column)]};
 
-            break;
-        }
-        else
-        {
-            pairIdenticalDiscs = 0;
+            for(std::size_t line{0}; line < NB_LINES; ++line)
+            {
+                std::uint64_t threats{0};
+
+                for(int row{0}; row < nbRows; ++row)
+                {
+                    threats |= std::uint64_t{isLineThreat(words, nbRows, m_inARow, row, LINE_ROW_STEPS[line])} << row;
+                }
+
+                m_threats[threatIndex(index, column) + line] = threats;
+            }
+
+            updateWinningColumn(index, column);
         }
     }
-
-    return nbIdenticalDiscs;
 }
 
 
 /***********************************************************************************************//**
- * Computes the number of adjacent, identical Discs that are vertically alligned from the 
- * current Position. The bounds for the computation are determined by the GameBoard geometry 
- * and the <em> in a row </em> value for the Game. Note that the method filters empty Discs
- * from the computation, as Players are not allow to use them.
+ * Counts the adjacent Discs identical to the one at a specific Position, walking away from this
+ * Position in a single direction. The walk stops at the first different Disc, at the edge of the
+ * GameBoard or after @a inARow - 1 Discs, whichever comes first: before the last move, no run
+ * could reach @a inARow, so nothing longer can be found on either side.
+ *
+ * @param[in] p_from       The Position to walk from. Its Disc is not counted.
+ * @param[in] p_rowStep    The Row increment for each step (-1, 0 or 1).
+ * @param[in] p_columnStep The Column increment for each step (-1, 0 or 1).
  *
- * @return The number of adjacent, identical Discs that are vertically alligned from the current
- *         Position.
+ * @return The number of identical adjacent Discs found in that direction.
  *
  **************************************************************************************************/
-int Game::verticalNbOfAdjacentDiscs() const
+int Game::nbOfAdjacentDiscs(const Position& p_from, int p_rowStep, int p_columnStep) const
 {
-    const int lowerLimit{lowerValidationLimit()};
-    const int upperLimit{upperValidationLimit()};
-    const int nbValidations{nbOfValidations(lowerLimit, upperLimit)};
-
-    int pairIdenticalDiscs{0};
-    int nbIdenticalDiscs{0};
-
-    const Position lastMovePosition{positionOfLastSuccessFullMove()};
+    const DiscId fromDiscId{m_gameboard->discId(p_from)};
 
-    Column columnLastPlacedDisc{lastMovePosition.column()};
+    int row{p_from.rowValue() + p_rowStep};
+    int column{p_from.columnValue() + p_columnStep};
+    int nbAdjacentDiscs{0};
 
-    for(int i{lowerLimit}; i < lowerLimit + nbValidations; ++i)
+    while(nbAdjacentDiscs < m_inARow - 1                             &&
+          row    >= 0 && row    < m_gameboard->nbRows()              &&
+          column >= 0 && column < m_gameboard->nbColumns()           &&
+          m_gameboard->discId(Position{Row{row}, Column{column}}) == fromDiscId)
     {
-        for(int j{0}; j < m_inARow - 1; ++j)
-        {
-            if(((*m_gameboard)(Position{Row{i + j}, columnLastPlacedDisc}) != Disc::noDisc()) &&
-               ((*m_gameboard)(Position{Row{i + j}, columnLastPlacedDisc}) == (*m_gameboard)(Position{Row{i + j + 1}, columnLastPlacedDisc})))
-            {
-                pairIdenticalDiscs++;
-            }
-        }
+        ++nbAdjacentDiscs;
 
-        if(pairIdenticalDiscs == m_inARow - 1)
-        {
-            nbIdenticalDiscs = pairIdenticalDiscs + 1;
-
-            break;
-        }
-        else
-        {
-            pairIdenticalDiscs = 0;
-        }
+        row    += p_rowStep;
+        column += p_columnStep;
     }
 
-    return nbIdenticalDiscs;
+    return nbAdjacentDiscs;
 }
 
 
 /***********************************************************************************************//**
- * Computes the number of adjacent, identical Discs that are diagonally upward alligned from the 
- * current Position. The bounds for the computation are determined by the GameBoard geometry 
- * and the <em> in a row </em> value for the Game. Note that the method filters empty Discs
- * from the computation, as Players are not allow to use them.
+ * Looks for winning strings of Discs through the last Position played and records them. Only the
+ * four lines crossing that Position (horizontal, vertical and both diagonals) need to be
+ * checked, and each of them is walked at most @a inARow - 1 Positions on each side, so the cost
+ * does not depend on the size of the GameBoard.
  *
- * @return The number of adjacent, identical Discs that are diagonally upward alligned from the 
- *         current Position.
+ * If several lines are winning, all their Positions are recorded, the last Position played
+ * being recorded only once.
  *
  **************************************************************************************************/
-int Game::upwardNbOfAdjacentDiscs() const
+void Game::updateWinningPositions()
 {
-    const int lowerLimit{lowerValidationLimit(GridValidationType::DiagonalUpward)};
-    const int leftLimit{leftValidationLimit(GridValidationType::DiagonalUpward)};
-    const int rightLimit{rightValidationLimit(GridValidationType::DiagonalUpward)};
-    const int nbValidations{nbOfValidations(leftLimit, rightLimit)};
+    m_winningPositions.clear();
 
-    int pairIdenticalDiscs{0};
-    int nbIdenticalDiscs{0};
-    int counter{0};
+    const int nbOfSucessfulMoves{cxutil::narrow_cast<int>(m_completedMovePositions.size())};
+    const int nbOfPlayers{cxutil::narrow_cast<int>(m_players.size())};
 
-    for(int i{leftLimit}; i < leftLimit + nbValidations; ++i)
+    // Not enough Discs yet for anyone to have won:
+    if(nbOfSucessfulMoves < nbOfPlayers * (m_inARow - 1) + 1)
     {
-        int k{lowerLimit + counter};
-
-        for(int j{0}; j < m_inARow - 1; ++j)
-        {
-            if(((*m_gameboard)(Position{Row{k}, Column{i + j}}) != Disc::noDisc()) &&
-               ((*m_gameboard)(Position{Row{k}, Column{i + j}}) == (*m_gameboard)(Position{Row{k + 1}, Column{i + j + 1}})))
-            {
-                pairIdenticalDiscs++;
-            }
-
-            ++k;
-        }
-
-        if(pairIdenticalDiscs == m_inARow - 1)
-        {
-            nbIdenticalDiscs = pairIdenticalDiscs + 1;
-
-            break;
-        }
-
-        pairIdenticalDiscs = 0;
-        ++counter;
+        return;
     }
 
-    return nbIdenticalDiscs;
-}
-
-
-/***********************************************************************************************//**
- * Computes the number of adjacent, identical Discs that are diagonally downward alligned from the 
- * current Position. The bounds for the computation are determined by the GameBoard geometry 
- * and the <em> in a row </em> value for the Game. Note that the method filters empty Discs
- * from the computation, as Players are not allow to use them.
- *
- * @return The number of adjacent, identical Discs that are diagonally downward alligned from 
- *         the current Position.
- *
- **************************************************************************************************/
-int Game::downwardNbOfAdjacentDiscs() const
-{
-    const int upperLimit{upperValidationLimit(GridValidationType::DiagonalDownward)};
-    const int leftLimit{leftValidationLimit(GridValidationType::DiagonalDownward)};
-    const int rightLimit{rightValidationLimit(GridValidationType::DiagonalDownward)};
-    const int nbValidations{nbOfValidations(leftLimit, rightLimit)};
+    const Position lastMovePosition{positionOfLastSuccessFullMove()};
 
-    int pairIdenticalDiscs{0};
-    int nbIdenticalDiscs{0};
-    int counter{0};
+    // Horizontal, vertical, diagonal upward and diagonal downward (row step, column step):
+    const int directions[4][2]{{0, 1}, {1, 0}, {1, 1}, {-1, 1}};
 
-    for(int i{leftLimit}; i < leftLimit + nbValidations; ++i)
+    for(const auto& direction : directions)
     {
-        int k{upperLimit - counter};
+        const int rowStep{direction[0]};
+        const int columnStep{direction[1]};
 
-        for(int j{0}; j < m_inARow - 1; ++j)
+        const int nbForward {nbOfAdjacentDiscs(lastMovePosition,  rowStep,  columnStep)};
+        const int nbBackward{nbOfAdjacentDiscs(lastMovePosition, -rowStep, -columnStep)};
+
+        if(nbForward + nbBackward + 1 >= m_inARow)
         {
-            if(((*m_gameboard)(Position{Row{k}, Column{i + j}}) != Disc::noDisc()) &&
-               ((*m_gameboard)(Position{Row{k}, Column{i + j}}) == (*m_gameboard)(Position{Row{k - 1}, Column{i + j + 1}})))
+            if(m_winningPositions.empty())
             {
-                ++pairIdenticalDiscs;
+                m_winningPositions.push_back(lastMovePosition);
             }
 
-            --k;
-        }
-
-        if(pairIdenticalDiscs == m_inARow - 1)
-        {
-            nbIdenticalDiscs = pairIdenticalDiscs + 1;
-
-            break;
+            for(int offset{-nbBackward}; offset <= nbForward; ++offset)
+            {
+                if(offset != 0)
+                {
+                    m_winningPositions.push_back(Position{Row{lastMovePosition.rowValue() + offset * rowStep},
+                                                          Column{lastMovePosition.columnValue() + offset * columnStep}});
+                }
+            }
         }
-
-        pairIdenticalDiscs = 0;
-        ++counter;
     }
-
-    return nbIdenticalDiscs;
-}
-
-
-/***********************************************************************************************//**
- * Checks in the number of adjacent, horizontally aligned Discs, is equal to the required 
- * number of adjacent Discs for a win.
- *
- * @return @c true if the number of adjacent, horizontally aligned Discs, is equal to the required 
- *         number of adjacent Discs for a win, @c false otherwhise.
- *
- **************************************************************************************************/
-bool Game::checkHorizontalWinner() const
-{
-    const int nbAdjacentIdenticalDiscs{horizontalNbOfAdjacentDiscs()};
-
-    return nbAdjacentIdenticalDiscs == m_inARow;
-}
-
-
-/***********************************************************************************************//**
- * Checks in the number of adjacent, vertically aligned Discs, is equal to the required 
- * number of adjacent Discs for a win.
- *
- * @return @c true if the number of adjacent, vertically aligned Discs, is equal to the required 
- *         number of adjacent Discs for a win, @c false otherwhise.
- *
- **************************************************************************************************/
-bool Game::checkVerticalWinner() const
-{
-    const int nbAdjacentIdenticalDiscs{verticalNbOfAdjacentDiscs()};
-
-    return nbAdjacentIdenticalDiscs == m_inARow;
-}
-
-
-/***********************************************************************************************//**
- * Checks in the number of adjacent, diagonally upward aligned Discs, is equal to the required 
- * number of adjacent Discs for a win.
- *
- * @return @c true if the number of adjacent, diagonally upward aligned Discs, is equal to the 
- *         required number of adjacent Discs for a win, @c false otherwhise.
- *
- **************************************************************************************************/
-bool Game::checkUpwardWinner() const
-{
-    const int nbAdjacentIdenticalDiscs{upwardNbOfAdjacentDiscs()};
-
-    return nbAdjacentIdenticalDiscs == m_inARow;
-}
-
-
-/***********************************************************************************************//**
- * Checks in the number of adjacent, diagonally downward aligned Discs, is equal to the required 
- * number of adjacent Discs for a win.
- *
- * @return @c true if the number of adjacent, diagonally downward aligned Discs, is equal to the 
- *         required number of adjacent Discs for a win, @c false otherwhise.
- *
- **************************************************************************************************/
-bool Game::checkDownwardWinner() const
-{
-    const int nbAdjacentIdenticalDiscs{downwardNbOfAdjacentDiscs()};
-
-    return nbAdjacentIdenticalDiscs == m_inARow;
 }
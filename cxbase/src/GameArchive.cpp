@@ -0,0 +1,159 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    GameArchive.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a memory-mapped game archive.
+ *
+ **************************************************************************************************/
+
+#include <cstring>
+
+#include "../include/GameArchive.h"
+
+
+using namespace cxbase;
+
+
+cxutil::ReturnCode GameArchive::open(const std::string& p_path)
+{
+    close();
+
+    cxutil::ReturnCode status{m_file.open(p_path)};
+
+    if(!status.isOk())
+    {
+        return status;
+    }
+
+    const std::size_t headerSize{sizeof(Header)};
+
+    if(m_file.size() < headerSize)
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is too small to be a game archive."};
+    }
+
+    const Header* header{reinterpret_cast<const Header*>(m_file.data())};
+
+    if(std::memcmp(header->m_magic, magic(), sizeof(header->m_magic)) != 0 || header->m_version != version())
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is not a supported game archive."};
+    }
+
+    // Every record ends with its marker, so a complete archive does too:
+    const std::uint8_t* begin{m_file.data() + headerSize};
+    const std::uint8_t* end  {m_file.data() + m_file.size()};
+
+    if((begin == end && header->m_nbGames != 0) || (begin != end && *(end - 1) != endOfGame()))
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is truncated."};
+    }
+
+    m_header = header;
+    m_begin  = begin;
+    m_end    = end;
+
+    return cxutil::ReturnCode{};
+}
+
+
+void GameArchive::close()
+{
+    m_header = nullptr;
+    m_begin  = nullptr;
+    m_end    = nullptr;
+
+    m_file.close();
+}
+
+
+bool GameArchive::next(const std::uint8_t*& p_cursor, Record& p_record) const
+{
+    PRECONDITION(isOpen());
+    PRECONDITION(p_cursor >= m_begin && p_cursor <= m_end);
+
+    if(p_cursor == m_end)
+    {
+        return false;
+    }
+
+    // The archive ends with a marker, so one is always found:
+    const std::uint8_t* marker{static_cast<const std::uint8_t*>(std::memchr(p_cursor, endOfGame(), static_cast<std::size_t>(m_end - p_cursor)))};
+
+    p_record = Record{p_cursor, marker};
+    p_cursor = marker + 1;
+
+    return true;
+}
+
+
+const std::uint8_t* GameArchive::align(const std::uint8_t* p_from) const
+{
+    PRECONDITION(isOpen());
+    PRECONDITION(p_from >= m_begin && p_from <= m_end);
+
+    if(p_from == m_begin || p_from == m_end)
+    {
+        return p_from;
+    }
+
+    // A record starts right after the marker ending the previous one:
+    const std::uint8_t* marker{static_cast<const std::uint8_t*>(std::memchr(p_from - 1, endOfGame(), static_cast<std::size_t>(m_end - p_from + 1)))};
+
+    return marker + 1;
+}
+
+
+int GameArchive::replay(const Record& p_record, Game& p_game) const
+{
+    PRECONDITION(isOpen());
+    PRECONDITION(p_game.gameboard().nbRows()    == nbRows());
+    PRECONDITION(p_game.gameboard().nbColumns() == nbColumns());
+    PRECONDITION(p_game.inARowValue()           == inARow());
+    PRECONDITION(p_game.nbPlayers()             == nbPlayers());
+
+    int nbMoves{0};
+
+    for(const std::uint8_t* move{p_record.begin()}; move != p_record.end(); ++move)
+    {
+        if(*move >= nbColumns() || p_game.isWon() || !p_game.makeMove(Column{*move}))
+        {
+            break;
+        }
+
+        ++nbMoves;
+    }
+
+    return nbMoves;
+}
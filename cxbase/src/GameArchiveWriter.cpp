@@ -0,0 +1,188 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    GameArchiveWriter.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a streaming game archive writer.
+ *
+ **************************************************************************************************/
+
+#include <cstring>
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/GameArchiveWriter.h"
+
+
+using namespace cxbase;
+
+
+namespace
+{
+
+const std::size_t BUFFER_SIZE{1 << 20}; // Records are written by blocks of at least this size (bytes).
+
+} // unamed namespace
+
+
+GameArchiveWriter::~GameArchiveWriter()
+{
+    if(isOpen())
+    {
+        // Nowhere to report an error from here, see the destructor documentation:
+        static_cast<void>(close());
+    }
+}
+
+
+cxutil::ReturnCode GameArchiveWriter::open(const std::string& p_path, int p_nbRows, int p_nbColumns, int p_inARow, int p_nbPlayers)
+{
+    PRECONDITION(p_nbRows    > 0 && p_nbRows    <= 0xFF);
+    PRECONDITION(p_nbColumns > 0 && p_nbColumns <  GameArchive::endOfGame());
+    PRECONDITION(p_inARow    > 0 && p_inARow    <= 0xFF);
+    PRECONDITION(p_nbPlayers > 0 && p_nbPlayers <= 0xFF);
+
+    if(isOpen())
+    {
+        cxutil::ReturnCode status{close()};
+
+        if(!status.isOk())
+        {
+            return status;
+        }
+    }
+
+    m_file.open(p_path, std::ios::binary | std::ios::trunc);
+
+    if(!m_file)
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, "Unable to create " + p_path + "."};
+    }
+
+    m_path = p_path;
+
+    std::memcpy(m_header.m_magic, GameArchive::magic(), sizeof(m_header.m_magic));
+    m_header.m_version   = GameArchive::version();
+    m_header.m_nbRows    = cxutil::narrow_cast<std::uint8_t>(p_nbRows);
+    m_header.m_nbColumns = cxutil::narrow_cast<std::uint8_t>(p_nbColumns);
+    m_header.m_inARow    = cxutil::narrow_cast<std::uint8_t>(p_inARow);
+    m_header.m_nbPlayers = cxutil::narrow_cast<std::uint8_t>(p_nbPlayers);
+    m_header.m_nbGames   = 0;
+
+    // Written again, with the number of Games, when the archive is closed:
+    m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+
+    m_buffer.reserve(BUFFER_SIZE + m_header.m_nbRows * m_header.m_nbColumns + 1);
+
+    return cxutil::ReturnCode{};
+}
+
+
+void GameArchiveWriter::write(const Game& p_game)
+{
+    PRECONDITION(isOpen());
+    PRECONDITION(p_game.gameboard().nbRows()    == m_header.m_nbRows);
+    PRECONDITION(p_game.gameboard().nbColumns() == m_header.m_nbColumns);
+    PRECONDITION(p_game.inARowValue()           == m_header.m_inARow);
+    PRECONDITION(p_game.nbPlayers()             == m_header.m_nbPlayers);
+
+    for(const Position& position : p_game.completedMovePositions())
+    {
+        m_buffer.push_back(cxutil::narrow_cast<std::uint8_t>(position.column().value()));
+    }
+
+    m_buffer.push_back(GameArchive::endOfGame());
+    ++m_header.m_nbGames;
+
+    if(m_buffer.size() >= BUFFER_SIZE)
+    {
+        flush();
+    }
+}
+
+
+void GameArchiveWriter::write(const std::uint8_t* p_columns, std::size_t p_nbMoves)
+{
+    PRECONDITION(isOpen());
+    PRECONDITION(p_columns != nullptr || p_nbMoves == 0);
+
+    for(std::size_t move{0}; move < p_nbMoves; ++move)
+    {
+        PRECONDITION(p_columns[move] < m_header.m_nbColumns);
+    }
+
+    m_buffer.insert(m_buffer.end(), p_columns, p_columns + p_nbMoves);
+    m_buffer.push_back(GameArchive::endOfGame());
+    ++m_header.m_nbGames;
+
+    if(m_buffer.size() >= BUFFER_SIZE)
+    {
+        flush();
+    }
+}
+
+
+cxutil::ReturnCode GameArchiveWriter::close()
+{
+    if(!isOpen())
+    {
+        return cxutil::ReturnCode{};
+    }
+
+    flush();
+
+    // The header is complete only now:
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(&m_header), sizeof(m_header));
+    m_file.close();
+
+    const bool isWritten{!m_file.fail()};
+
+    m_header = GameArchive::Header{};
+    m_buffer.clear();
+
+    if(!isWritten)
+    {
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, "Unable to write " + m_path + "."};
+    }
+
+    return cxutil::ReturnCode{};
+}
+
+
+/***********************************************************************************************//**
+ * Writes the buffered records to the file. Errors are reported when the archive is closed.
+ *
+ **************************************************************************************************/
+void GameArchiveWriter::flush()
+{
+    m_file.write(reinterpret_cast<const char*>(m_buffer.data()), static_cast<std::streamsize>(m_buffer.size()));
+    m_buffer.clear();
+}
@@ -30,7 +30,12 @@
  **************************************************************************************************/
 
 
+#include <algorithm>
+
+#include <cxutil/include/narrow_cast.h>
+
 #include "../include/GameBoard.h"
+#include "../include/Zobrist.h"
 
 
 using namespace cxbase;
@@ -39,34 +44,12 @@ using namespace cxbase;
 GameBoard::~GameBoard() = default;
 
 
-GameBoard::GameBoard(): m_grid(NB_ROWS_MIN, std::vector<std::shared_ptr<Disc>>(NB_COLUMNS_MIN, std::make_shared<Disc>())),
-                        m_nbRows{NB_ROWS_MIN}, m_nbColumns{NB_COLUMNS_MIN}
-
+GameBoard::GameBoard(): GameBoard(NB_ROWS_MIN, NB_COLUMNS_MIN)
 {
-    int nbPositionsGameBoard{0};
-
-    for(auto& row : m_grid)
-    {
-        for(auto& disc : row)
-        {
-            if(*disc == Disc::noDisc())
-            {
-                ++nbPositionsGameBoard;
-            }
-        }
-    }
-
-    ASSERTION(nbPositionsGameBoard >= NB_ROWS_MIN * NB_COLUMNS_MIN);
-    ASSERTION(nbPositionsGameBoard <= NB_ROWS_MAX * NB_COLUMNS_MAX);
-    ASSERTION(nbPositionsGameBoard ==  m_nbRows * m_nbColumns);
-
-    INVARIANTS();
 }
 
 
-GameBoard::GameBoard(int p_nbRows, int p_nbColumns): m_grid(p_nbRows, std::vector<std::shared_ptr<Disc>>(p_nbColumns, std::make_shared<Disc>())),
-                                                     m_nbRows{p_nbRows}, m_nbColumns{p_nbColumns}
-
+GameBoard::GameBoard(int p_nbRows, int p_nbColumns): m_nbRows{p_nbRows}, m_nbColumns{p_nbColumns}
 {
     PRECONDITION(p_nbRows >= NB_ROWS_MIN);
     PRECONDITION(p_nbRows <= NB_ROWS_MAX);
@@ -74,64 +57,78 @@ GameBoard::GameBoard(int p_nbRows, int p_nbColumns): m_grid(p_nbRows, std::vecto
     PRECONDITION(p_nbColumns >= NB_COLUMNS_MIN);
     PRECONDITION(p_nbColumns <= NB_COLUMNS_MAX);
 
-    int nbPositionsGameBoard{0};
+    m_discKeys.assign(m_palette.size(), Zobrist::discKey(Disc::noDisc()));
+    m_cells.assign(cxutil::narrow_cast<std::size_t>(m_nbRows * m_nbColumns), DiscPalette::noDiscId());
+    m_bitplanes.assign(m_palette.size() * cxutil::narrow_cast<std::size_t>(m_nbColumns), 0);
+    m_nextFreeRows.assign(cxutil::narrow_cast<std::size_t>(m_nbColumns), 0);
 
-    for(auto& row : m_grid)
-    {
-        for(auto& disc : row)
-        {
-            if(*disc == Disc::noDisc())
-            {
-                ++nbPositionsGameBoard;
-            }
-        }
-    }
-
-    ASSERTION(nbPositionsGameBoard >= NB_ROWS_MIN * NB_COLUMNS_MIN);
-    ASSERTION(nbPositionsGameBoard <= NB_ROWS_MAX * NB_COLUMNS_MAX);
-    ASSERTION(nbPositionsGameBoard == m_nbRows * m_nbColumns);
+    ASSERTION(std::all_of(m_cells.cbegin(), m_cells.cend(), [](DiscId p_id){return p_id == DiscPalette::noDiscId();}));
+    ASSERTION(std::all_of(m_nextFreeRows.cbegin(), m_nextFreeRows.cend(), [](int p_row){return p_row == 0;}));
 
     INVARIANTS();
 }
 
 
-int GameBoard::nbColumns() const
+int GameBoard::nbPositions() const
 {
-    return m_nbColumns;
+    return m_nbColumns * m_nbRows;
 }
 
 
-int GameBoard::nbRows() const
+DiscId GameBoard::discId(const Position& p_position) const
 {
-    return m_nbRows;
+    PRECONDITION(p_position.row()    >= Row{0}   );
+    PRECONDITION(p_position.column() >= Column{0});
+
+    PRECONDITION(p_position.row()    < Row{m_nbRows}      );
+    PRECONDITION(p_position.column() < Column{m_nbColumns});
+
+    return m_cells[cellIndex(p_position.rowValue(), p_position.columnValue())];
 }
 
 
-int GameBoard::nbPositions() const
+std::uint64_t GameBoard::columnBits(DiscId p_discId, const Column& p_column) const
 {
-    return m_nbColumns * m_nbRows;
+    PRECONDITION(p_discId != DiscPalette::noDiscId());
+    PRECONDITION(p_discId < m_palette.size());
+    PRECONDITION(p_column >= Column{0});
+    PRECONDITION(p_column < Column{m_nbColumns});
+
+    return m_bitplanes[p_discId * m_nextFreeRows.size() + cxutil::narrow_cast<std::size_t>(p_column.value())];
 }
 
 
 Position GameBoard::placeDisc(const Column& p_column, const Disc& p_disc)
 {
     PRECONDITION(p_disc != Disc::noDisc());
+
+    return placeDisc(p_column, registerDisc(p_disc));
+}
+
+
+Position GameBoard::placeDisc(const Column& p_column, DiscId p_discId)
+{
+    PRECONDITION(p_discId != DiscPalette::noDiscId());
+    PRECONDITION(p_discId < m_palette.size());
     PRECONDITION(p_column >= Column{0});
     PRECONDITION(p_column < Column{m_nbColumns});
 
-    int        rowSubscript{0};
+    const std::size_t column{cxutil::narrow_cast<std::size_t>(p_column.value())};
+    int               rowSubscript{m_nextFreeRows[column]};
 
-    for(auto row = m_grid.begin(); row != m_grid.end(); ++row)
+    if(rowSubscript < m_nbRows)
     {
-        std::shared_ptr<Disc> currentDiscAddress{std::make_shared<Disc>((*this)(Position{Row{rowSubscript}, p_column}))};
-        
-        if(*currentDiscAddress == Disc::noDisc())
-        {
-            m_grid[rowSubscript][p_column.value()] = std::make_shared<Disc>(p_disc);
-            break;
-        }
+        m_cells[cellIndex(rowSubscript, p_column.value())] = p_discId;
+        m_bitplanes[p_discId * m_nextFreeRows.size() + column] |= std::uint64_t{1} << rowSubscript;
+        ++m_nextFreeRows[column];
 
-        ++rowSubscript;
+        m_hash         ^= Zobrist::positionKey(rowSubscript, p_column.value(), m_discKeys[p_discId]);
+        m_mirroredHash ^= Zobrist::positionKey(rowSubscript, m_nbColumns - 1 - p_column.value(), m_discKeys[p_discId]);
+    }
+    else
+    {
+        // Full Column: the top most Position is returned.
+        rowSubscript = m_nbRows - 1;
     }
 
     INVARIANTS();
@@ -140,28 +137,62 @@ Position GameBoard::placeDisc(const Column& p_column, const Disc& p_disc)
 }
 
 
+Position GameBoard::removeDisc(const Column& p_column)
+{
+    PRECONDITION(p_column >= Column{0});
+    PRECONDITION(p_column < Column{m_nbColumns});
+
+    const std::size_t column{cxutil::narrow_cast<std::size_t>(p_column.value())};
+
+    PRECONDITION(m_nextFreeRows[column] > 0);
+
+    const int         rowSubscript{--m_nextFreeRows[column]};
+    const std::size_t index{cellIndex(rowSubscript, p_column.value())};
+    const DiscId      discId{m_cells[index]};
+
+    m_cells[index] = DiscPalette::noDiscId();
+    m_bitplanes[discId * m_nextFreeRows.size() + column] &= ~(std::uint64_t{1} << rowSubscript);
+
+    m_hash         ^= Zobrist::positionKey(rowSubscript, p_column.value(), m_discKeys[discId]);
+    m_mirroredHash ^= Zobrist::positionKey(rowSubscript, m_nbColumns - 1 - p_column.value(), m_discKeys[discId]);
+
+    INVARIANTS();
+
+    return Position{Row{rowSubscript}, p_column};
+}
+
+
+DiscId GameBoard::registerDisc(const Disc& p_disc)
+{
+    PRECONDITION(p_disc != Disc::noDisc());
+
+    const DiscId id{m_palette.intern(p_disc)};
+
+    // If the Disc is new, it needs its own bitplane and key:
+    m_bitplanes.resize(m_palette.size() * m_nextFreeRows.size(), 0);
+    m_discKeys.resize(m_palette.size(), Zobrist::discKey(p_disc));
+
+    INVARIANTS();
+
+    return id;
+}
+
+
 bool GameBoard::isColumnFull(const Column& p_column) const
 {
     PRECONDITION(p_column >= Column{0});
-    PRECONDITION(p_column < Column{NB_COLUMNS_MAX});
+    PRECONDITION(p_column < Column{m_nbColumns});
 
-    bool isPlayable{false};
-    int  rowSubscript{m_nbRows - 1};
+    return m_nextFreeRows[cxutil::narrow_cast<std::size_t>(p_column.value())] == m_nbRows;
+}
 
-    for(auto row = m_grid.rbegin(); row != m_grid.rend(); ++row)
-    {
-        std::shared_ptr<Disc> currentDiscAddress{std::make_shared<Disc>((*this)(Position{Row{rowSubscript}, p_column}))};
-    
-        if(*currentDiscAddress == Disc::noDisc())
-        {
-            isPlayable = true;
-            break;
-        }
 
-        --rowSubscript;
-    }
+Column GameBoard::canonicalColumn(const Column& p_column) const
+{
+    PRECONDITION(p_column >= Column{0});
+    PRECONDITION(p_column < Column{m_nbColumns});
 
-    return !isPlayable;
+    return m_mirroredHash < m_hash ? Column{m_nbColumns - 1 - p_column.value()} : p_column;
 }
 
 
@@ -170,33 +201,34 @@ bool GameBoard::operator==(const GameBoard& p_gameBoard) const
     PRECONDITION(m_nbColumns == p_gameBoard.m_nbColumns);
     PRECONDITION(m_nbRows == p_gameBoard.m_nbRows);
 
-    bool isEqual{true};
-    int rowSubscript{0};
-    int columnSubscript{0};
+    if(m_hash != p_gameBoard.m_hash || m_nextFreeRows != p_gameBoard.m_nextFreeRows)
+    {
+        return false;
+    }
 
-    for(auto& row : m_grid)
+    // Same occupied Positions: each Disc must now cover the exact same Positions on both GameBoards.
+    // Both palettes are not necessarily in the same order, so bitplanes are matched by Disc:
+    const std::size_t nbColumns{m_nextFreeRows.size()};
+
+    for(std::size_t id{1}; id < m_palette.size(); ++id)
     {
-        for(auto& disc :row)
+        const Disc& disc{m_palette.disc(cxutil::narrow_cast<DiscId>(id))};
+        const bool  isDiscKnownToOther{p_gameBoard.m_palette.contains(disc)};
+        const std::size_t otherId{isDiscKnownToOther ? p_gameBoard.m_palette.id(disc) : 0u};
+
+        for(std::size_t column{0}; column < nbColumns; ++column)
         {
-            if(*disc != p_gameBoard(Position{Row{rowSubscript}, Column{columnSubscript}}))
+            const std::uint64_t word{m_bitplanes[id * nbColumns + column]};
+            const std::uint64_t otherWord{isDiscKnownToOther ? p_gameBoard.m_bitplanes[otherId * nbColumns + column] : 0};
+
+            if(word != otherWord)
             {
-                isEqual = false;
-                break;
+                return false;
             }
-
-            ++columnSubscript;
         }
-
-        if(isEqual)
-        {
-            break;
-        }
-
-        columnSubscript = 0;
-        ++rowSubscript;
     }
 
-    return isEqual;
+    return true;
 }
 
 
@@ -211,13 +243,7 @@ bool GameBoard::operator!=(const GameBoard &p_gameBoard) const
 
 Disc GameBoard::operator()(const Position& p_position) const
 {
-    PRECONDITION(p_position.row()    >= Row{0}   );
-    PRECONDITION(p_position.column() >= Column{0});
-
-    PRECONDITION(p_position.row()    < Row{m_nbRows}      );
-    PRECONDITION(p_position.column() < Column{m_nbColumns});
-
-    return *m_grid[p_position.rowValue()][p_position.columnValue()];
+    return m_palette.disc(discId(p_position));
 }
 
 
@@ -228,5 +254,24 @@ void GameBoard::checkInvariant() const
 
     INVARIANT(m_nbColumns >= NB_COLUMNS_MIN);
     INVARIANT(m_nbColumns < NB_COLUMNS_MAX + 1);
+
+    INVARIANT(m_cells.size() == cxutil::narrow_cast<std::size_t>(m_nbRows * m_nbColumns));
+    INVARIANT(m_bitplanes.size() == m_palette.size() * m_nextFreeRows.size());
+    INVARIANT(m_discKeys.size() == m_palette.size());
 }
 
+
+/***********************************************************************************************//**
+ * Computes the index of a Position in the Grid storage. The Grid is stored Column by Column so
+ * that all Positions of a Column are contiguous.
+ *
+ * @param[in] p_row    The Row subscript.
+ * @param[in] p_column The Column subscript.
+ *
+ * @return The index of the Position in the Grid storage.
+ *
+ **************************************************************************************************/
+std::size_t GameBoard::cellIndex(int p_row, int p_column) const
+{
+    return cxutil::narrow_cast<std::size_t>(p_column * m_nbRows + p_row);
+}
@@ -0,0 +1,254 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    LiveWindows.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for an incremental open window accounting utility.
+ *
+ **************************************************************************************************/
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/LiveWindows.h"
+
+
+using namespace cxbase;
+
+
+const int LiveWindows::NOT_WINNABLE;
+const int LiveWindows::NOBODY;
+
+
+LiveWindows::LiveWindows(const std::shared_ptr<const WinningLines>&      p_lines,
+                         int                                             p_nbPlayers,
+                         const std::shared_ptr<const EvaluationWeights>& p_weights,
+                         bool                                            p_withVerticalWindows): m_lines{p_lines},
+                                                                                                 m_weights{p_weights},
+                                                                                                 m_nbPlayers{p_nbPlayers},
+                                                                                                 m_withVerticalWindows{p_withVerticalWindows}
+{
+    PRECONDITION(p_lines != nullptr);
+    PRECONDITION(p_weights != nullptr);
+    PRECONDITION(p_nbPlayers >= 2);
+    PRECONDITION(p_weights->inARow() == p_lines->inARow());
+
+    m_inARow = m_lines->inARow();
+
+    const std::size_t nbPlayers{cxutil::narrow_cast<std::size_t>(m_nbPlayers)};
+
+    m_windows.assign(cxutil::narrow_cast<std::size_t>(m_lines->nbWindows()), Window{});
+    m_windowCounts.assign(m_windows.size() * (nbPlayers + 1), 0);
+    m_nbLiveWindows.assign(nbPlayers * cxutil::narrow_cast<std::size_t>(m_inARow + 1), 0);
+    m_scores.assign(nbPlayers, 0);
+
+    for(int window{0}; window < m_lines->nbWindows(); ++window)
+    {
+        if(isCounted(window))
+        {
+            countWindow(m_windows[cxutil::narrow_cast<std::size_t>(window)], 1);
+        }
+    }
+
+    INVARIANTS();
+}
+
+
+std::int64_t LiveWindows::score(int p_player) const
+{
+    PRECONDITION(p_player >= 0);
+    PRECONDITION(p_player < m_nbPlayers);
+
+    return m_scores[cxutil::narrow_cast<std::size_t>(p_player)];
+}
+
+
+int LiveWindows::nbLiveWindows(int p_player, int p_nbEmpty) const
+{
+    PRECONDITION(p_player >= 0);
+    PRECONDITION(p_player < m_nbPlayers);
+    PRECONDITION(p_nbEmpty >= 0);
+    PRECONDITION(p_nbEmpty < m_inARow);
+
+    return m_nbLiveWindows[cxutil::narrow_cast<std::size_t>(p_player * (m_inARow + 1) + p_nbEmpty)];
+}
+
+
+void LiveWindows::addDisc(const Position& p_position, int p_player)
+{
+    PRECONDITION(p_player < m_nbPlayers);
+
+    const int slot{ownerSlot(p_player)};
+
+    for(const int window : m_lines->windows(p_position))
+    {
+        if(isCounted(window))
+        {
+            addToWindow(window, slot);
+        }
+    }
+}
+
+
+void LiveWindows::removeDisc(const Position& p_position, int p_player)
+{
+    PRECONDITION(p_player < m_nbPlayers);
+
+    const int slot{ownerSlot(p_player)};
+
+    for(const int window : m_lines->windows(p_position))
+    {
+        if(isCounted(window))
+        {
+            removeFromWindow(window, slot);
+        }
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Finds the slot under which a Disc is counted in the windows. Each Player has its own slot and
+ * all Discs that do not belong to a Player share an extra one.
+ *
+ * @param[in] p_player The index of the Player owning the Disc, or a negative value.
+ *
+ * @return The slot, between 0 and the number of Players.
+ *
+ **************************************************************************************************/
+int LiveWindows::ownerSlot(int p_player) const
+{
+    return p_player >= 0 ? p_player : m_nbPlayers;
+}
+
+
+/***********************************************************************************************//**
+ * Checks if a window is followed.
+ *
+ * @param[in] p_window The index of the window in the winning lines table.
+ *
+ * @return @c false for vertical windows, if they are left out, @c true otherwise.
+ *
+ **************************************************************************************************/
+bool LiveWindows::isCounted(int p_window) const
+{
+    return m_withVerticalWindows || m_lines->direction(p_window) != WinningLines::Direction::Vertical;
+}
+
+
+/***********************************************************************************************//**
+ * Adds (or removes) a window to the counters and scores.
+ *
+ * @param[in] p_window The window.
+ * @param[in] p_count  One (1) to add the window, minus one (-1) to remove it.
+ *
+ **************************************************************************************************/
+void LiveWindows::countWindow(const Window& p_window, int p_count)
+{
+    if(p_window.m_nbDiscs == 0)
+    {
+        m_nbEmptyWindows += p_count;
+    }
+    else if(p_window.m_owner != NOT_WINNABLE)
+    {
+        m_nbLiveWindows[cxutil::narrow_cast<std::size_t>(p_window.m_owner * (m_inARow + 1) + (m_inARow - p_window.m_nbDiscs))] += p_count;
+        m_scores[cxutil::narrow_cast<std::size_t>(p_window.m_owner)] += p_count * m_weights->weight(p_window.m_nbDiscs);
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Adds a Disc to a window. The owner slots holding Discs in the window are followed through their
+ * number and sum, so that the owner is known in constant time, whichever slot was added or
+ * removed last.
+ *
+ * @param[in] p_window The index of the window in the winning lines table.
+ * @param[in] p_slot   The owner slot of the Disc (see @c ownerSlot()).
+ *
+ **************************************************************************************************/
+void LiveWindows::addToWindow(int p_window, int p_slot)
+{
+    Window&       window{m_windows[cxutil::narrow_cast<std::size_t>(p_window)]};
+    std::uint8_t& count {m_windowCounts[cxutil::narrow_cast<std::size_t>(p_window * (m_nbPlayers + 1) + p_slot)]};
+
+    countWindow(window, -1);
+
+    if(count == 0)
+    {
+        ++window.m_nbOwners;
+        window.m_slotsSum += p_slot;
+    }
+
+    ++count;
+    ++window.m_nbDiscs;
+
+    window.m_owner = (window.m_nbOwners == 1 && window.m_slotsSum < m_nbPlayers) ? window.m_slotsSum : NOT_WINNABLE;
+
+    countWindow(window, 1);
+}
+
+
+/***********************************************************************************************//**
+ * Removes a Disc from a window. This is the exact reverse of @c addToWindow(): a window which was
+ * not winnable anymore becomes winnable again as soon as the Discs left in it all belong to the
+ * same Player.
+ *
+ * @param[in] p_window The index of the window in the winning lines table.
+ * @param[in] p_slot   The owner slot of the Disc (see @c ownerSlot()).
+ *
+ **************************************************************************************************/
+void LiveWindows::removeFromWindow(int p_window, int p_slot)
+{
+    Window&       window{m_windows[cxutil::narrow_cast<std::size_t>(p_window)]};
+    std::uint8_t& count {m_windowCounts[cxutil::narrow_cast<std::size_t>(p_window * (m_nbPlayers + 1) + p_slot)]};
+
+    countWindow(window, -1);
+
+    --count;
+    --window.m_nbDiscs;
+
+    if(count == 0)
+    {
+        --window.m_nbOwners;
+        window.m_slotsSum -= p_slot;
+    }
+
+    if(window.m_nbDiscs == 0)
+    {
+        window.m_owner = NOBODY;
+    }
+    else
+    {
+        window.m_owner = (window.m_nbOwners == 1 && window.m_slotsSum < m_nbPlayers) ? window.m_slotsSum : NOT_WINNABLE;
+    }
+
+    countWindow(window, 1);
+}
+
+
+void LiveWindows::checkInvariant() const
+{
+    INVARIANT(m_nbPlayers >= 2 || m_windows.empty());
+}
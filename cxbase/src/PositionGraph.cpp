@@ -0,0 +1,128 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    PositionGraph.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a memory-mapped graph of distinct Game positions.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+
+#include <cxutil/include/ContractException.h>
+
+#include "../include/PositionGraph.h"
+
+
+using namespace cxbase;
+
+
+cxutil::ReturnCode PositionGraph::open(const std::string& p_path)
+{
+    close();
+
+    cxutil::ReturnCode status{m_file.open(p_path)};
+
+    if(!status.isOk())
+    {
+        return status;
+    }
+
+    const std::size_t headerSize{sizeof(Header)};
+
+    if(m_file.size() < headerSize)
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is too small to be a position graph."};
+    }
+
+    const Header* header{reinterpret_cast<const Header*>(m_file.data())};
+
+    if(std::memcmp(header->m_magic, magic(), sizeof(header->m_magic)) != 0 || header->m_version != version())
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is not a supported position graph."};
+    }
+
+    const std::size_t nodesSize{static_cast<std::size_t>(header->m_nbNodes) * sizeof(Node)};
+    const std::size_t edgesSize{static_cast<std::size_t>(header->m_nbEdges) * sizeof(Edge)};
+    const std::size_t winsSize {static_cast<std::size_t>(header->m_nbNodes) * header->m_nbPlayers * sizeof(std::uint32_t)};
+
+    if(m_file.size() != headerSize + nodesSize + edgesSize + winsSize || (header->m_nbNodes > 0 && header->m_root >= header->m_nbNodes))
+    {
+        m_file.close();
+
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, p_path + " is truncated."};
+    }
+
+    m_header = header;
+    m_nodes  = reinterpret_cast<const Node*>(m_file.data() + headerSize);
+    m_edges  = reinterpret_cast<const Edge*>(m_file.data() + headerSize + nodesSize);
+    m_wins   = reinterpret_cast<const std::uint32_t*>(m_file.data() + headerSize + nodesSize + edgesSize);
+
+    return cxutil::ReturnCode{};
+}
+
+
+void PositionGraph::close()
+{
+    m_header = nullptr;
+    m_nodes  = nullptr;
+    m_edges  = nullptr;
+    m_wins   = nullptr;
+
+    m_file.close();
+}
+
+
+std::size_t PositionGraph::find(std::uint64_t p_key) const
+{
+    PRECONDITION(isOpen());
+
+    const Node* end{m_nodes + size()};
+
+    const Node* node{std::lower_bound(m_nodes, end, p_key, [](const Node& p_node, std::uint64_t p_nodeKey)
+                                                           {
+                                                               return p_node.m_key < p_nodeKey;
+                                                           })};
+
+    return (node != end && node->m_key == p_key) ? static_cast<std::size_t>(node - m_nodes) : size();
+}
+
+
+std::uint32_t PositionGraph::nbWins(std::size_t p_node, int p_seat) const
+{
+    PRECONDITION(isOpen());
+    PRECONDITION(p_node < size());
+    PRECONDITION(p_seat >= 0 && p_seat < nbPlayers());
+
+    return m_wins[p_node * static_cast<std::size_t>(nbPlayers()) + static_cast<std::size_t>(p_seat)];
+}
@@ -0,0 +1,288 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+
+/***********************************************************************************************//**
+ * @file    PositionGraphBuilder.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a position graph builder.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/PositionGraphBuilder.h"
+
+
+using namespace cxbase;
+
+
+namespace
+{
+
+const std::uint32_t MAX_COUNT{std::numeric_limits<std::uint32_t>::max()}; // Counts are stored on 32 bits.
+
+// Edges are keyed by origin node and Column:
+std::uint64_t edgeKey(std::uint32_t p_parent, std::uint8_t p_column)
+{
+    return (static_cast<std::uint64_t>(p_parent) << 8) | p_column;
+}
+
+} // unamed namespace
+
+
+PositionGraphBuilder::PositionGraphBuilder(const std::vector<std::shared_ptr<Player>>& p_players, int p_nbRows, int p_nbColumns, int p_inARow)
+ : m_game{new Game{p_players, std::make_shared<GameBoard>(p_nbRows, p_nbColumns), p_inARow}}
+ , m_nbPlayers{cxutil::narrow_cast<int>(p_players.size())}
+{
+    PRECONDITION(p_nbRows    <= 0xFF);
+    PRECONDITION(p_nbColumns <= 0xFF);
+    PRECONDITION(m_nbPlayers <= 0xFF);
+}
+
+
+bool PositionGraphBuilder::add(const std::uint8_t* p_columns, std::size_t p_nbMoves)
+{
+    PRECONDITION(p_columns != nullptr || p_nbMoves == 0);
+
+    const int nbColumns{m_game->gameboard().nbColumns()};
+
+    // The Game is replayed first, so that nothing is added from an invalid one:
+    m_path.clear();
+    m_path.push_back(m_game->canonicalHash());
+    m_moves.clear();
+
+    bool isValid{true};
+    int  nbMoves{0};
+
+    for(std::size_t move{0}; move < p_nbMoves; ++move)
+    {
+        if(p_columns[move] >= nbColumns || m_game->isWon())
+        {
+            isValid = false;
+            break;
+        }
+
+        // Moves are stored as seen from the canonical form of the position they are made from:
+        const Column canonicalColumn{m_game->canonicalColumn(Column{p_columns[move]})};
+
+        if(!m_game->makeMove(Column{p_columns[move]}))
+        {
+            isValid = false;
+            break;
+        }
+
+        ++nbMoves;
+        m_path.push_back(m_game->canonicalHash());
+        m_moves.push_back(cxutil::narrow_cast<std::uint8_t>(canonicalColumn.value()));
+    }
+
+    const bool isWon {m_game->isWon()};
+    const bool isDraw{!isWon && m_game->isDraw()};
+
+    for(int move{0}; move < nbMoves; ++move)
+    {
+        m_game->undoMove();
+    }
+
+    if(!isValid || m_nbGames >= MAX_COUNT)
+    {
+        return false;
+    }
+
+    // The last Player to move won:
+    const std::size_t winner{isWon ? static_cast<std::size_t>((nbMoves - 1) % m_nbPlayers) : 0};
+
+    std::uint32_t parent{0};
+
+    for(std::size_t position{0}; position < m_path.size(); ++position)
+    {
+        const std::uint32_t node{nodeIndex(m_path[position])};
+
+        ++m_nbVisits[node];
+        m_nbDraws[node] += isDraw ? 1 : 0;
+        m_nbWins[node * static_cast<std::size_t>(m_nbPlayers) + winner] += isWon ? 1 : 0;
+
+        if(position > 0)
+        {
+            // The same move from the same position always leads to the same position:
+            Edge& edge{m_edges[edgeKey(parent, m_moves[position - 1])]};
+
+            edge.m_child = node;
+            ++edge.m_nbVisits;
+        }
+
+        parent = node;
+    }
+
+    ++m_nbGames;
+    m_nbPositions += m_path.size();
+
+    return true;
+}
+
+
+bool PositionGraphBuilder::add(const Game& p_game)
+{
+    PRECONDITION(p_game.gameboard().nbRows()    == m_game->gameboard().nbRows());
+    PRECONDITION(p_game.gameboard().nbColumns() == m_game->gameboard().nbColumns());
+    PRECONDITION(p_game.inARowValue()           == m_game->inARowValue());
+    PRECONDITION(p_game.nbPlayers()             == m_nbPlayers);
+
+    std::vector<std::uint8_t> columns;
+    columns.reserve(p_game.completedMovePositions().size());
+
+    for(const Position& position : p_game.completedMovePositions())
+    {
+        columns.push_back(cxutil::narrow_cast<std::uint8_t>(position.column().value()));
+    }
+
+    return add(columns.data(), columns.size());
+}
+
+
+cxutil::ReturnCode PositionGraphBuilder::write(const std::string& p_path) const
+{
+    const std::size_t nbNodes  {m_keys.size()};
+    const std::size_t nbPlayers{static_cast<std::size_t>(m_nbPlayers)};
+
+    // Nodes are sorted by key, for lookups:
+    std::vector<std::uint32_t> order(nbNodes);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [this](std::uint32_t p_lhs, std::uint32_t p_rhs){return m_keys[p_lhs] < m_keys[p_rhs];});
+
+    std::vector<std::uint32_t> ranks(nbNodes);
+
+    for(std::size_t rank{0}; rank < nbNodes; ++rank)
+    {
+        ranks[order[rank]] = cxutil::narrow_cast<std::uint32_t>(rank);
+    }
+
+    std::vector<PositionGraph::Node> nodes(nbNodes);
+    std::vector<std::uint32_t>       wins(nbNodes * nbPlayers);
+
+    for(std::size_t rank{0}; rank < nbNodes; ++rank)
+    {
+        const std::uint32_t node{order[rank]};
+
+        nodes[rank] = PositionGraph::Node{m_keys[node], m_nbVisits[node], m_nbDraws[node], 0, 0};
+        std::copy_n(m_nbWins.begin() + static_cast<std::ptrdiff_t>(node * nbPlayers), nbPlayers, wins.begin() + static_cast<std::ptrdiff_t>(rank * nbPlayers));
+    }
+
+    // Edges are sorted by origin node, then by Column:
+    std::vector<std::pair<std::uint64_t, PositionGraph::Edge>> sortedEdges;
+    sortedEdges.reserve(m_edges.size());
+
+    for(const auto& edge : m_edges)
+    {
+        const std::uint8_t column{static_cast<std::uint8_t>(edge.first & 0xFF)};
+
+        sortedEdges.emplace_back(edgeKey(ranks[edge.first >> 8], column),
+                                 PositionGraph::Edge{ranks[edge.second.m_child], edge.second.m_nbVisits, column, {0, 0, 0}});
+    }
+
+    std::sort(sortedEdges.begin(), sortedEdges.end(), [](const std::pair<std::uint64_t, PositionGraph::Edge>& p_lhs,
+                                                         const std::pair<std::uint64_t, PositionGraph::Edge>& p_rhs)
+                                                      {
+                                                          return p_lhs.first < p_rhs.first;
+                                                      });
+
+    std::vector<PositionGraph::Edge> edges;
+    edges.reserve(sortedEdges.size());
+
+    for(const auto& edge : sortedEdges)
+    {
+        PositionGraph::Node& parent{nodes[edge.first >> 8]};
+
+        if(parent.m_nbEdges == 0)
+        {
+            parent.m_firstEdge = cxutil::narrow_cast<std::uint32_t>(edges.size());
+        }
+
+        ++parent.m_nbEdges;
+        edges.push_back(edge.second);
+    }
+
+    PositionGraph::Header header;
+    std::memset(&header, 0, sizeof(header));
+
+    std::memcpy(header.m_magic, PositionGraph::magic(), sizeof(header.m_magic));
+    header.m_version   = PositionGraph::version();
+    header.m_nbRows    = cxutil::narrow_cast<std::uint8_t>(m_game->gameboard().nbRows());
+    header.m_nbColumns = cxutil::narrow_cast<std::uint8_t>(m_game->gameboard().nbColumns());
+    header.m_inARow    = cxutil::narrow_cast<std::uint8_t>(m_game->inARowValue());
+    header.m_nbPlayers = cxutil::narrow_cast<std::uint8_t>(m_nbPlayers);
+    header.m_nbNodes   = nbNodes;
+    header.m_nbEdges   = edges.size();
+
+    const auto root = m_indexes.find(m_game->canonicalHash());
+    header.m_root = root != m_indexes.end() ? ranks[root->second] : 0;
+
+    std::ofstream file{p_path, std::ios::binary | std::ios::trunc};
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(nodes.data()), static_cast<std::streamsize>(nodes.size() * sizeof(PositionGraph::Node)));
+    file.write(reinterpret_cast<const char*>(edges.data()), static_cast<std::streamsize>(edges.size() * sizeof(PositionGraph::Edge)));
+    file.write(reinterpret_cast<const char*>(wins.data()), static_cast<std::streamsize>(wins.size() * sizeof(std::uint32_t)));
+    file.close();
+
+    if(!file)
+    {
+        return cxutil::ReturnCode{cxutil::ReturnCode::Code::ERROR, "Unable to write " + p_path + "."};
+    }
+
+    return cxutil::ReturnCode{};
+}
+
+
+/***********************************************************************************************//**
+ * Finds the node of a position, creating it if the position is new.
+ *
+ * @param[in] p_key The position canonical Game hash.
+ *
+ * @return The index of the node.
+ *
+ **************************************************************************************************/
+std::uint32_t PositionGraphBuilder::nodeIndex(std::uint64_t p_key)
+{
+    const auto inserted = m_indexes.emplace(p_key, cxutil::narrow_cast<std::uint32_t>(m_keys.size()));
+
+    if(inserted.second)
+    {
+        m_keys.push_back(p_key);
+        m_nbVisits.push_back(0);
+        m_nbDraws.push_back(0);
+        m_nbWins.resize(m_nbWins.size() + static_cast<std::size_t>(m_nbPlayers), 0);
+    }
+
+    return inserted.first->second;
+}
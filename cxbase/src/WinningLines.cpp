@@ -0,0 +1,234 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    WinningLines.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a winning line geometry utility.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/WinningLines.h"
+
+
+using namespace cxbase;
+
+
+namespace
+{
+
+/***********************************************************************************************//**
+ * Gives the Row and Column increments from one Position to the next in a window.
+ *
+ * @param[in]  p_direction  The window direction.
+ * @param[out] p_rowStep    The Row increment.
+ * @param[out] p_columnStep The Column increment.
+ *
+ **************************************************************************************************/
+void steps(WinningLines::Direction p_direction, int& p_rowStep, int& p_columnStep)
+{
+    switch(p_direction)
+    {
+        case WinningLines::Direction::Horizontal:       p_rowStep =  0; p_columnStep = 1; break;
+        case WinningLines::Direction::Vertical:         p_rowStep =  1; p_columnStep = 0; break;
+        case WinningLines::Direction::DiagonalUpward:   p_rowStep =  1; p_columnStep = 1; break;
+        case WinningLines::Direction::DiagonalDownward: p_rowStep = -1; p_columnStep = 1; break;
+    }
+}
+
+} // unamed namespace
+
+
+WinningLines::~WinningLines() = default;
+
+
+WinningLines::WinningLines(int p_nbRows, int p_nbColumns, int p_inARow): m_nbRows{p_nbRows},
+                                                                         m_nbColumns{p_nbColumns},
+                                                                         m_inARow{p_inARow}
+{
+    PRECONDITION(p_inARow >= 2);
+    PRECONDITION(p_inARow <= p_nbRows);
+    PRECONDITION(p_inARow <= p_nbColumns);
+
+    // Windows, direction by direction. Each one is identified by its first Position:
+    const int lastStart{m_inARow - 1};
+
+    for(int row{0}; row < m_nbRows; ++row)
+    {
+        for(int column{0}; column < m_nbColumns - lastStart; ++column)
+        {
+            addWindow(Direction::Horizontal, row, column);
+        }
+    }
+
+    for(int row{0}; row < m_nbRows - lastStart; ++row)
+    {
+        for(int column{0}; column < m_nbColumns; ++column)
+        {
+            addWindow(Direction::Vertical, row, column);
+        }
+    }
+
+    for(int row{0}; row < m_nbRows - lastStart; ++row)
+    {
+        for(int column{0}; column < m_nbColumns - lastStart; ++column)
+        {
+            addWindow(Direction::DiagonalUpward, row, column);
+        }
+    }
+
+    for(int row{lastStart}; row < m_nbRows; ++row)
+    {
+        for(int column{0}; column < m_nbColumns - lastStart; ++column)
+        {
+            addWindow(Direction::DiagonalDownward, row, column);
+        }
+    }
+
+    // Position to windows index. Counted first, then filled:
+    const std::size_t nbPositions{cxutil::narrow_cast<std::size_t>(m_nbRows * m_nbColumns)};
+
+    m_positionOffsets.assign(nbPositions + 1, 0);
+
+    for(const auto& position : m_positions)
+    {
+        ++m_positionOffsets[cxutil::narrow_cast<std::size_t>(position.rowValue() * m_nbColumns + position.columnValue()) + 1];
+    }
+
+    std::partial_sum(m_positionOffsets.cbegin(), m_positionOffsets.cend(), m_positionOffsets.begin());
+
+    std::vector<int> nextSlots{m_positionOffsets.cbegin(), m_positionOffsets.cend() - 1};
+    m_positionWindows.resize(m_positions.size());
+
+    for(std::size_t index{0}; index < m_positions.size(); ++index)
+    {
+        const Position&   position{m_positions[index]};
+        const std::size_t cell{cxutil::narrow_cast<std::size_t>(position.rowValue() * m_nbColumns + position.columnValue())};
+
+        m_positionWindows[cxutil::narrow_cast<std::size_t>(nextSlots[cell]++)] = cxutil::narrow_cast<int>(index / cxutil::narrow_cast<std::size_t>(m_inARow));
+    }
+
+    INVARIANTS();
+}
+
+
+std::shared_ptr<const WinningLines> WinningLines::forShape(int p_nbRows, int p_nbColumns, int p_inARow)
+{
+    using Shape = std::tuple<int, int, int>;
+
+    static std::mutex                                           s_mutex;
+    static std::map<Shape, std::shared_ptr<const WinningLines>> s_tables;
+
+    std::lock_guard<std::mutex> lock{s_mutex};
+
+    std::shared_ptr<const WinningLines>& table{s_tables[Shape{p_nbRows, p_nbColumns, p_inARow}]};
+
+    if(!table)
+    {
+        table = std::make_shared<const WinningLines>(p_nbRows, p_nbColumns, p_inARow);
+    }
+
+    return table;
+}
+
+
+WinningLines::Direction WinningLines::direction(int p_window) const
+{
+    PRECONDITION(p_window >= 0);
+    PRECONDITION(p_window < nbWindows());
+
+    return m_directions[cxutil::narrow_cast<std::size_t>(p_window)];
+}
+
+
+Position WinningLines::position(int p_window, int p_offset) const
+{
+    PRECONDITION(p_window >= 0);
+    PRECONDITION(p_window < nbWindows());
+    PRECONDITION(p_offset >= 0);
+    PRECONDITION(p_offset < m_inARow);
+
+    return m_positions[cxutil::narrow_cast<std::size_t>(p_window * m_inARow + p_offset)];
+}
+
+
+WinningLines::WindowRange WinningLines::windows(const Position& p_position) const
+{
+    PRECONDITION(p_position.rowValue() >= 0);
+    PRECONDITION(p_position.rowValue() < m_nbRows);
+    PRECONDITION(p_position.columnValue() >= 0);
+    PRECONDITION(p_position.columnValue() < m_nbColumns);
+
+    const std::size_t cell{cxutil::narrow_cast<std::size_t>(p_position.rowValue() * m_nbColumns + p_position.columnValue())};
+    const int*        first{m_positionWindows.data()};
+
+    return WindowRange{first + m_positionOffsets[cell], first + m_positionOffsets[cell + 1]};
+}
+
+
+void WinningLines::checkInvariant() const
+{
+    INVARIANT(m_positions.size() == m_directions.size() * cxutil::narrow_cast<std::size_t>(m_inARow));
+    INVARIANT(m_positionWindows.size() == m_positions.size());
+
+    INVARIANT(std::all_of(m_positions.cbegin(), m_positions.cend(), [this](const Position& p_position)
+    {
+        return p_position.rowValue()    >= 0 && p_position.rowValue()    < m_nbRows &&
+               p_position.columnValue() >= 0 && p_position.columnValue() < m_nbColumns;
+    }));
+}
+
+
+/***********************************************************************************************//**
+ * Adds a window to the table.
+ *
+ * @param[in] p_direction   The window direction.
+ * @param[in] p_startRow    The Row of the first Position in the window.
+ * @param[in] p_startColumn The Column of the first Position in the window.
+ *
+ **************************************************************************************************/
+void WinningLines::addWindow(Direction p_direction, int p_startRow, int p_startColumn)
+{
+    int rowStep{0};
+    int columnStep{0};
+
+    steps(p_direction, rowStep, columnStep);
+
+    m_directions.push_back(p_direction);
+
+    for(int offset{0}; offset < m_inARow; ++offset)
+    {
+        m_positions.push_back(Position{Row{p_startRow + offset * rowStep}, Column{p_startColumn + offset * columnStep}});
+    }
+}
@@ -0,0 +1,144 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    Zobrist.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a Zobrist hashing utility.
+ *
+ **************************************************************************************************/
+
+#include <array>
+
+#include <cxutil/include/narrow_cast.h>
+
+#include "../include/Zobrist.h"
+
+
+using namespace cxbase;
+
+
+namespace
+{
+
+const int           NB_SUBSCRIPTS_MAX{64};
+const std::uint64_t SEED             {0x436F6E6E65637458}; // "ConnectX"
+
+
+/***********************************************************************************************//**
+ * SplitMix64 finalizer. Spreads every input bit over the whole 64 bits output.
+ *
+ * @param[in] p_value The value to mix.
+ *
+ * @return The mixed value.
+ *
+ **************************************************************************************************/
+std::uint64_t mix(std::uint64_t p_value)
+{
+    p_value = (p_value ^ (p_value >> 30)) * 0xBF58476D1CE4E5B9;
+    p_value = (p_value ^ (p_value >> 27)) * 0x94D049BB133111EB;
+
+    return p_value ^ (p_value >> 31);
+}
+
+
+/***********************************************************************************************//**
+ * Gives access to the per Position keys, generated once from a fixed seed.
+ *
+ * @return The keys, indexed by @c row * 64 + column.
+ *
+ **************************************************************************************************/
+const std::array<std::uint64_t, NB_SUBSCRIPTS_MAX * NB_SUBSCRIPTS_MAX>& positionKeys()
+{
+    static const std::array<std::uint64_t, NB_SUBSCRIPTS_MAX * NB_SUBSCRIPTS_MAX> s_keys = []()
+    {
+        std::array<std::uint64_t, NB_SUBSCRIPTS_MAX * NB_SUBSCRIPTS_MAX> keys;
+
+        std::uint64_t state{SEED};
+
+        for(auto& key : keys)
+        {
+            state += 0x9E3779B97F4A7C15;
+            key = mix(state);
+        }
+
+        return keys;
+    }();
+
+    return s_keys;
+}
+
+} // unamed namespace
+
+
+std::uint64_t Zobrist::discKey(const Disc& p_disc)
+{
+    if(p_disc == Disc::noDisc())
+    {
+        return 0;
+    }
+
+    const cxutil::Color color{p_disc.color()};
+
+    const std::uint64_t rgba{(std::uint64_t{color.r()} << 24) |
+                             (std::uint64_t{color.g()} << 16) |
+                             (std::uint64_t{color.b()} <<  8) |
+                              std::uint64_t{color.a()}};
+
+    return mix(SEED ^ rgba);
+}
+
+
+std::uint64_t Zobrist::positionKey(int p_row, int p_column, std::uint64_t p_discKey)
+{
+    PRECONDITION(p_row >= 0);
+    PRECONDITION(p_row < NB_SUBSCRIPTS_MAX);
+    PRECONDITION(p_column >= 0);
+    PRECONDITION(p_column < NB_SUBSCRIPTS_MAX);
+
+    const std::size_t index{cxutil::narrow_cast<std::size_t>(p_row * NB_SUBSCRIPTS_MAX + p_column)};
+
+    return mix(positionKeys()[index] ^ p_discKey);
+}
+
+
+std::uint64_t Zobrist::positionKey(const Position& p_position, const Disc& p_disc)
+{
+    return positionKey(p_position.rowValue(), p_position.columnValue(), discKey(p_disc));
+}
+
+
+std::uint64_t Zobrist::turnKey(int p_turn)
+{
+    PRECONDITION(p_turn >= 0);
+
+    if(p_turn == 0)
+    {
+        return 0;
+    }
+
+    return mix(~SEED + cxutil::narrow_cast<std::uint64_t>(p_turn));
+}
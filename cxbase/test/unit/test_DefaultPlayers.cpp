@@ -0,0 +1,95 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_DefaultPlayers.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the defaultPlayers() factory and the isValidGameShape() check.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <cxbase/include/DefaultPlayers.h>
+
+
+using namespace cxbase;
+
+
+TEST(DefaultPlayers, DefaultPlayers_NegativeNumber_ExceptionThrown)
+{
+    ASSERT_THROW(defaultPlayers(-1), PreconditionException);
+}
+
+
+TEST(DefaultPlayers, DefaultPlayers_TwoPlayers_BlackThenRed)
+{
+    const auto t_players = defaultPlayers(2);
+
+    ASSERT_EQ(t_players.size(), 2u);
+
+    ASSERT_EQ(t_players[0]->name(), cxutil::Name{"Player 1"});
+    ASSERT_EQ(t_players[0]->disc(), Disc::blackDisc());
+    ASSERT_EQ(t_players[1]->name(), cxutil::Name{"Player 2"});
+    ASSERT_EQ(t_players[1]->disc(), Disc::redDisc());
+}
+
+
+TEST(DefaultPlayers, DefaultPlayers_TenPlayers_AllDiscsDifferent)
+{
+    const auto t_players = defaultPlayers(10);
+
+    ASSERT_EQ(t_players.size(), 10u);
+
+    for(std::size_t first{0}; first < t_players.size(); ++first)
+    {
+        for(std::size_t second{first + 1}; second < t_players.size(); ++second)
+        {
+            ASSERT_NE(t_players[first]->disc(), t_players[second]->disc());
+        }
+    }
+}
+
+
+TEST(DefaultPlayers, IsValidGameShape_ClassicShape_True)
+{
+    ASSERT_TRUE(isValidGameShape(6, 7, 4, 2));
+    ASSERT_TRUE(isValidGameShape(64, 64, 9, 2));
+    ASSERT_TRUE(isValidGameShape(6, 7, 2, 21));
+}
+
+
+TEST(DefaultPlayers, IsValidGameShape_InvalidShapes_False)
+{
+    ASSERT_FALSE(isValidGameShape(5, 7, 4, 2));     // Too few Rows.
+    ASSERT_FALSE(isValidGameShape(6, 65, 4, 2));    // Too many Columns.
+    ASSERT_FALSE(isValidGameShape(6, 7, 6, 2));     // inARow not smaller than the Rows.
+    ASSERT_FALSE(isValidGameShape(6, 7, 1, 2));     // inARow too small.
+    ASSERT_FALSE(isValidGameShape(6, 7, 4, 1));     // A single Player.
+    ASSERT_FALSE(isValidGameShape(6, 7, 4, 4));     // Positions not shared evenly.
+    ASSERT_FALSE(isValidGameShape(6, 7, 2, 42));    // More Players than alignments fit.
+}
@@ -0,0 +1,91 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_DiscPalette.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for a the DiscPalette class.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <cxbase/include/DiscPalette.h>
+
+
+using namespace cxbase;
+
+
+TEST(DiscPalette, Constructor_Default_ContainsOnlyNoDisc)
+{
+    DiscPalette t_palette;
+
+    ASSERT_EQ(t_palette.size(), 1u);
+    ASSERT_TRUE(t_palette.contains(Disc::noDisc()));
+    ASSERT_EQ(t_palette.id(Disc::noDisc()), DiscPalette::noDiscId());
+    ASSERT_EQ(t_palette.disc(DiscPalette::noDiscId()), Disc::noDisc());
+}
+
+
+TEST(DiscPalette, Intern_NewDisc_ReturnsNextIdentifier)
+{
+    DiscPalette t_palette;
+
+    ASSERT_EQ(t_palette.intern(Disc::redDisc()), 1);
+    ASSERT_EQ(t_palette.intern(Disc::blackDisc()), 2);
+
+    ASSERT_EQ(t_palette.size(), 3u);
+    ASSERT_EQ(t_palette.disc(1), Disc::redDisc());
+    ASSERT_EQ(t_palette.disc(2), Disc::blackDisc());
+}
+
+
+TEST(DiscPalette, Intern_KnownDisc_ReturnsSameIdentifier)
+{
+    DiscPalette t_palette;
+
+    const DiscId redId{t_palette.intern(Disc::redDisc())};
+
+    ASSERT_EQ(t_palette.intern(Disc{cxutil::Color::red()}), redId);
+    ASSERT_EQ(t_palette.intern(Disc::noDisc()), DiscPalette::noDiscId());
+    ASSERT_EQ(t_palette.size(), 2u);
+}
+
+
+TEST(DiscPalette, Id_UnknownDisc_ExceptionThrown)
+{
+    DiscPalette t_palette;
+
+    ASSERT_FALSE(t_palette.contains(Disc::redDisc()));
+    ASSERT_THROW(t_palette.id(Disc::redDisc()), PreconditionException);
+}
+
+
+TEST(DiscPalette, Disc_UnknownIdentifier_ExceptionThrown)
+{
+    DiscPalette t_palette;
+
+    ASSERT_THROW(t_palette.disc(1), PreconditionException);
+}
@@ -0,0 +1,106 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    test_EvaluationWeights.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for a the EvaluationWeights class.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <include/EvaluationWeights.h>
+
+
+using namespace cxbase;
+
+
+TEST(EvaluationWeights, Weight_GivenWeights_ReturnsThemByNumberOfDiscs)
+{
+    const EvaluationWeights t_weights{4, {1, 10, 100, 1000}};
+
+    ASSERT_EQ(t_weights.inARow(), 4);
+    ASSERT_EQ(t_weights.weight(1), 1);
+    ASSERT_EQ(t_weights.weight(3), 100);
+    ASSERT_EQ(t_weights.weight(4), 1000);
+
+    ASSERT_EQ(t_weights.cumulatedWeight(0), 0);
+    ASSERT_EQ(t_weights.cumulatedWeight(2), 11);
+    ASSERT_EQ(t_weights.cumulatedWeight(4), 1111);
+}
+
+
+TEST(EvaluationWeights, Constructor_WrongNumberOfWeights_ExceptionThrown)
+{
+    ASSERT_THROW((EvaluationWeights{4, {1, 10, 100}}), PreconditionException);
+    ASSERT_THROW((EvaluationWeights{1, {1}}), PreconditionException);
+}
+
+
+TEST(EvaluationWeights, Constructor_NegativeWeight_ExceptionThrown)
+{
+    ASSERT_THROW((EvaluationWeights{4, {1, -10, 100, 1000}}), PreconditionException);
+}
+
+
+TEST(EvaluationWeights, Weight_NumberOfDiscsOutOfRange_ExceptionThrown)
+{
+    const EvaluationWeights t_weights{4, {1, 10, 100, 1000}};
+
+    ASSERT_THROW(t_weights.weight(0), PreconditionException);
+    ASSERT_THROW(t_weights.weight(5), PreconditionException);
+    ASSERT_THROW(t_weights.cumulatedWeight(-1), PreconditionException);
+}
+
+
+TEST(EvaluationWeights, ForShape_NothingRegistered_ReturnsSharedDefaultWeights)
+{
+    const std::shared_ptr<const EvaluationWeights> t_weights{EvaluationWeights::forShape(6, 7, 4)};
+
+    ASSERT_EQ(t_weights, EvaluationWeights::forShape(6, 7, 4));
+    ASSERT_EQ(t_weights->inARow(), 4);
+
+    // Each additional Disc weighs four times more:
+    ASSERT_EQ(t_weights->weight(1), 1);
+    ASSERT_EQ(t_weights->weight(2), 4);
+    ASSERT_EQ(t_weights->weight(3), 16);
+
+    // Weights stop growing for long windows:
+    const std::shared_ptr<const EvaluationWeights> t_long{EvaluationWeights::forShape(64, 64, 63)};
+
+    ASSERT_EQ(t_long->weight(63), t_long->weight(21));
+}
+
+
+TEST(EvaluationWeights, RegisterShape_CustomWeights_ReturnedForThisShapeOnly)
+{
+    const std::shared_ptr<const EvaluationWeights> t_custom{std::make_shared<const EvaluationWeights>(5, std::vector<std::int64_t>{2, 3, 5, 7, 11})};
+
+    EvaluationWeights::registerShape(11, 13, t_custom);
+
+    ASSERT_EQ(EvaluationWeights::forShape(11, 13, 5), t_custom);
+    ASSERT_NE(EvaluationWeights::forShape(11, 13, 4), t_custom);
+    ASSERT_NE(EvaluationWeights::forShape(13, 11, 5), t_custom);
+}
@@ -0,0 +1,350 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_FixedGameBoard.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for a the FixedGameBoard class template.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <include/FixedGameBoard.h>
+#include <include/GameBoard.h>
+
+
+using namespace cxbase;
+
+
+using ClassicGameBoard = FixedGameBoard<6, 7, 4>;
+
+static_assert(ClassicGameBoard::nbPositions() == 42, "Storage size must be known at compile time.");
+static_assert(ClassicGameBoard::nbWinningLines() == 69, "The classic board has 69 winning lines.");
+static_assert(ClassicGameBoard::columnMask() == 0x3F, "Six rows, six bits.");
+static_assert(ClassicGameBoard::leftValidationLimit(2) == 0, "Left limit is clipped by the grid.");
+static_assert(ClassicGameBoard::rightValidationLimit(2) == 5, "Right limit is inARow - 1 away.");
+static_assert(ClassicGameBoard::upperValidationLimit(4) == 5, "Upper limit is clipped by the grid.");
+static_assert(FixedGameBoard<64, 64, 9>::columnMask() == ~std::uint64_t{0}, "A 64 rows column fills a word.");
+static_assert(FixedGameBoard<64, 64, 9>::nbWinningLines() == 2 * 64 * 56 + 2 * 56 * 56, "Rows and columns, then both diagonals.");
+static_assert(ClassicGameBoard::verticalLineMask(2) == 0x3C, "Rows 2 to 5.");
+static_assert(ClassicGameBoard::windowStartRows(WinningLines::Direction::Horizontal) == 0x3F, "Any Row.");
+static_assert(ClassicGameBoard::windowStartRows(WinningLines::Direction::Vertical) == 0x07, "Rows 0 to 2.");
+static_assert(ClassicGameBoard::windowStartRows(WinningLines::Direction::DiagonalUpward) == 0x07, "Rows 0 to 2.");
+static_assert(ClassicGameBoard::windowStartRows(WinningLines::Direction::DiagonalDownward) == 0x38, "Rows 3 to 5.");
+static_assert(ClassicGameBoard::nbWindowStartColumns(WinningLines::Direction::Vertical) == 7, "Any Column.");
+static_assert(ClassicGameBoard::nbWindowStartColumns(WinningLines::Direction::Horizontal) == 4, "Columns 0 to 3.");
+
+
+class FixedGameBoardTests: public::testing::Test
+{
+
+public:
+
+    FixedGameBoardTests() {}
+
+    ClassicGameBoard t_gameBoard;
+};
+
+
+TEST_F(FixedGameBoardTests, Constructor_Default_CreatesEmptyBoard)
+{
+    for(int row{0}; row < t_gameBoard.nbRows(); ++row)
+    {
+        for(int column{0}; column < t_gameBoard.nbColumns(); ++column)
+        {
+            ASSERT_EQ(t_gameBoard(Position{Row{row}, Column{column}}), Disc::noDisc());
+        }
+    }
+}
+
+
+TEST_F(FixedGameBoardTests, PlaceDisc_ValidDiscAsParameter_DiscInsertedOverPrevious)
+{
+    t_gameBoard.placeDisc(Column{0}, Disc::redDisc());
+
+    ASSERT_EQ(t_gameBoard.placeDisc(Column{0}, Disc::blackDisc()), (Position{Row{1}, Column{0}}));
+    ASSERT_EQ(t_gameBoard(Position{Row{0}, Column{0}}), Disc::redDisc());
+    ASSERT_EQ(t_gameBoard(Position{Row{1}, Column{0}}), Disc::blackDisc());
+    ASSERT_EQ(t_gameBoard(Position{Row{2}, Column{0}}), Disc::noDisc());
+}
+
+
+TEST_F(FixedGameBoardTests, PlaceDisc_InvalidDiscAsParameter_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.placeDisc(Column{0}, Disc::noDisc()), PreconditionException);
+}
+
+
+TEST_F(FixedGameBoardTests, PlaceDisc_ColumnTooLargeAsParameter_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.placeDisc(Column{7}, Disc::redDisc()), PreconditionException);
+}
+
+
+TEST_F(FixedGameBoardTests, IsColumnFull_FullAndNotFullColumns_ReturnsAccordingly)
+{
+    for(int row{0}; row < 5; ++row)
+    {
+        t_gameBoard.placeDisc(Column{6}, Disc::redDisc());
+    }
+
+    ASSERT_FALSE(t_gameBoard.isColumnFull(Column{6}));
+
+    t_gameBoard.placeDisc(Column{6}, Disc::redDisc());
+
+    ASSERT_TRUE(t_gameBoard.isColumnFull(Column{6}));
+    ASSERT_EQ(t_gameBoard.placeDisc(Column{6}, Disc::redDisc()), (Position{Row{5}, Column{6}}));
+}
+
+
+TEST_F(FixedGameBoardTests, RegisterDisc_TooManyDiscs_ExceptionThrown)
+{
+    for(std::uint8_t value{1}; value < ClassicGameBoard::NB_DISCS_MAX; ++value)
+    {
+        t_gameBoard.registerDisc(Disc{cxutil::Color{cxutil::RGBA{value, 0, 0, 255}}});
+    }
+
+    ASSERT_THROW(t_gameBoard.registerDisc(Disc{cxutil::Color{cxutil::RGBA{200, 0, 0, 255}}}), PreconditionException);
+}
+
+
+TEST_F(FixedGameBoardTests, EqualToOperator_SameDiscsPlacedInDifferentOrder_ReturnsTrue)
+{
+    ClassicGameBoard t_gameBoard2;
+
+    t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{1}, Disc::redDisc());
+
+    t_gameBoard2.placeDisc(Column{1}, Disc::redDisc());
+    t_gameBoard2.placeDisc(Column{0}, Disc::blackDisc());
+
+    ASSERT_TRUE(t_gameBoard == t_gameBoard2);
+
+    t_gameBoard2.placeDisc(Column{0}, Disc::blackDisc());
+
+    ASSERT_TRUE(t_gameBoard != t_gameBoard2);
+}
+
+
+TEST_F(FixedGameBoardTests, IsWinningPosition_Horizontal_ReturnsTrue)
+{
+    Position last{Row{0}, Column{0}};
+
+    for(int column{3}; column < 7; ++column)
+    {
+        last = t_gameBoard.placeDisc(Column{column}, Disc::redDisc());
+    }
+
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(last));
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(Position{Row{0}, Column{4}}));
+}
+
+
+TEST_F(FixedGameBoardTests, IsWinningPosition_Vertical_ReturnsTrue)
+{
+    t_gameBoard.placeDisc(Column{2}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{2}, Disc::blackDisc());
+
+    for(int row{0}; row < 3; ++row)
+    {
+        t_gameBoard.placeDisc(Column{2}, Disc::redDisc());
+    }
+
+    ASSERT_FALSE(t_gameBoard.isWinningPosition(Position{Row{4}, Column{2}}));
+
+    const Position last{t_gameBoard.placeDisc(Column{2}, Disc::redDisc())};
+
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(last));
+    ASSERT_FALSE(t_gameBoard.isWinningPosition(Position{Row{1}, Column{2}}));
+}
+
+
+TEST_F(FixedGameBoardTests, IsWinningPosition_DiagonalUpward_ReturnsTrue)
+{
+    //   3 |   |   |   | R |
+    //   2 |   |   | R | B |
+    //   1 |   | R | B | B |
+    //   0 | R | B | B | B |
+    //       0   1   2   3
+    for(int column{1}; column < 4; ++column)
+    {
+        for(int row{0}; row < column; ++row)
+        {
+            t_gameBoard.placeDisc(Column{column}, Disc::blackDisc());
+        }
+    }
+
+    Position last{Row{0}, Column{0}};
+
+    for(int column{0}; column < 4; ++column)
+    {
+        ASSERT_FALSE(t_gameBoard.isWinningPosition(last));
+
+        last = t_gameBoard.placeDisc(Column{column}, Disc::redDisc());
+    }
+
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(last));
+}
+
+
+TEST_F(FixedGameBoardTests, IsWinningPosition_DiagonalDownward_ReturnsTrue)
+{
+    //   3 | R |   |   |   |
+    //   2 | B | R |   |   |
+    //   1 | B | B | R |   |
+    //   0 | B | B | B | R |
+    //       3   4   5   6
+    for(int column{3}; column < 6; ++column)
+    {
+        for(int row{0}; row < 6 - column; ++row)
+        {
+            t_gameBoard.placeDisc(Column{column}, Disc::blackDisc());
+        }
+    }
+
+    for(int column{3}; column < 6; ++column)
+    {
+        t_gameBoard.placeDisc(Column{column}, Disc::redDisc());
+    }
+
+    ASSERT_FALSE(t_gameBoard.isWinningPosition(Position{Row{1}, Column{5}}));
+
+    const Position last{t_gameBoard.placeDisc(Column{6}, Disc::redDisc())};
+
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(last));
+}
+
+
+TEST_F(FixedGameBoardTests, IsWinningPosition_EmptyPosition_ReturnsFalse)
+{
+    ASSERT_FALSE(t_gameBoard.isWinningPosition(Position{Row{3}, Column{3}}));
+}
+
+
+TEST(FixedGameBoard, IsWinningPosition_LargestBoardTopRows_ReturnsTrue)
+{
+    FixedGameBoard<64, 64, 9> t_gameBoard;
+
+    for(int row{0}; row < 64; ++row)
+    {
+        t_gameBoard.placeDisc(Column{63}, row < 55 ? Disc::blackDisc() : Disc::redDisc());
+    }
+
+    ASSERT_TRUE(t_gameBoard.isColumnFull(Column{63}));
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(Position{Row{63}, Column{63}}));
+    ASSERT_TRUE(t_gameBoard.isWinningPosition(Position{Row{40}, Column{63}}));
+}
+
+
+TEST_F(FixedGameBoardTests, RemoveDisc_WinningDisc_NoLongerWinning)
+{
+    for(int row{0}; row < 4; ++row)
+    {
+        t_gameBoard.placeDisc(Column{1}, Disc::redDisc());
+    }
+
+    ASSERT_EQ(t_gameBoard.removeDisc(Column{1}), (Position{Row{3}, Column{1}}));
+    ASSERT_FALSE(t_gameBoard.isWinningPosition(Position{Row{2}, Column{1}}));
+    ASSERT_EQ(t_gameBoard(Position{Row{3}, Column{1}}), Disc::noDisc());
+
+    ASSERT_THROW(t_gameBoard.removeDisc(Column{0}), PreconditionException);
+}
+
+
+TEST_F(FixedGameBoardTests, Hash_SameDiscsAsGameBoard_SameHashes)
+{
+    GameBoard t_runtimeGameBoard;
+
+    const int t_columns[]{3, 3, 4, 0, 6, 6, 6};
+
+    for(std::size_t move{0}; move < sizeof(t_columns) / sizeof(t_columns[0]); ++move)
+    {
+        const Disc& t_disc{move % 2 == 0 ? Disc::redDisc() : Disc::blackDisc()};
+
+        t_gameBoard.placeDisc(Column{t_columns[move]}, t_disc);
+        t_runtimeGameBoard.placeDisc(Column{t_columns[move]}, t_disc);
+
+        ASSERT_EQ(t_gameBoard.hash(), t_runtimeGameBoard.hash());
+        ASSERT_EQ(t_gameBoard.mirroredHash(), t_runtimeGameBoard.mirroredHash());
+        ASSERT_EQ(t_gameBoard.canonicalHash(), t_runtimeGameBoard.canonicalHash());
+    }
+
+    ASSERT_EQ(t_gameBoard.canonicalColumn(Column{1}), t_runtimeGameBoard.canonicalColumn(Column{1}));
+    ASSERT_EQ(std::hash<ClassicGameBoard>{}(t_gameBoard), std::hash<GameBoard>{}(t_runtimeGameBoard));
+}
+
+
+TEST_F(FixedGameBoardTests, Hash_MirroredBoards_SameCanonicalHash)
+{
+    ClassicGameBoard t_mirrored;
+
+    t_gameBoard.placeDisc(Column{0}, Disc::redDisc());
+    t_gameBoard.placeDisc(Column{1}, Disc::blackDisc());
+
+    t_mirrored.placeDisc(Column{6}, Disc::redDisc());
+    t_mirrored.placeDisc(Column{5}, Disc::blackDisc());
+
+    ASSERT_NE(t_gameBoard.hash(), t_mirrored.hash());
+    ASSERT_EQ(t_gameBoard.mirroredHash(), t_mirrored.hash());
+    ASSERT_EQ(t_gameBoard.canonicalHash(), t_mirrored.canonicalHash());
+
+    // A Column of the canonical Grid maps back to the matching Column on each side:
+    const Column t_canonical{t_gameBoard.canonicalColumn(Column{1})};
+
+    ASSERT_EQ(t_mirrored.canonicalColumn(t_canonical), Column{5});
+}
+
+
+TEST_F(FixedGameBoardTests, RemoveDisc_AfterPlaceDisc_HashesRestored)
+{
+    t_gameBoard.placeDisc(Column{2}, Disc::redDisc());
+
+    const std::uint64_t t_hash{t_gameBoard.hash()};
+    const std::uint64_t t_mirroredHash{t_gameBoard.mirroredHash()};
+
+    t_gameBoard.placeDisc(Column{2}, Disc::blackDisc());
+    t_gameBoard.removeDisc(Column{2});
+
+    ASSERT_EQ(t_gameBoard.hash(), t_hash);
+    ASSERT_EQ(t_gameBoard.mirroredHash(), t_mirroredHash);
+}
+
+
+TEST_F(FixedGameBoardTests, ColumnBits_SomeDiscs_RowsOfEachDisc)
+{
+    const DiscId t_red  {t_gameBoard.registerDisc(Disc::redDisc())};
+    const DiscId t_black{t_gameBoard.registerDisc(Disc::blackDisc())};
+
+    t_gameBoard.placeDisc(Column{4}, t_red);
+    t_gameBoard.placeDisc(Column{4}, t_black);
+    t_gameBoard.placeDisc(Column{4}, t_red);
+
+    ASSERT_EQ(t_gameBoard.columnBits(t_red, Column{4}), 0x5u);
+    ASSERT_EQ(t_gameBoard.columnBits(t_black, Column{4}), 0x2u);
+    ASSERT_EQ(t_gameBoard.columnBits(t_red, Column{3}), 0x0u);
+
+    ASSERT_THROW(t_gameBoard.columnBits(DiscPalette::noDiscId(), Column{4}), PreconditionException);
+}
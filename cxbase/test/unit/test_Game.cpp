@@ -29,6 +29,9 @@
  *
  **************************************************************************************************/
 
+#include <algorithm>
+#include <random>
+
 #include <gtest/gtest.h>
 
 #include <include/Game.h>
@@ -1114,6 +1117,29 @@ TEST_F(GameTests, IsEarlyDraw_9by8GameBoardConnect7ThreePlayersEdgeCaseDiagonalD
 }
 
 
+TEST_F(GameTests, IsEarlyDraw_ClassicGameBoardConnect5VerticalStillPossible_ReturnsFalse)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFive()};
+
+    const std::vector<int> columns{0, 5, 0, 2, 5, 2, 6, 6, 6, 2, 1, 1, 1, 1, 3, 0, 5, 5, 3, 6,
+                                   3, 0, 1, 0, 0, 2, 2, 4, 2, 6, 4, 4, 6, 5, 1, 5, 3, 4, 4};
+
+    for(const int column : columns)
+    {
+        t_game.makeMove(Column{column});
+
+        ASSERT_FALSE(t_game.isWon());
+        ASSERT_FALSE(t_game.isEarlyDraw());
+    }
+
+    // Column 3 still has room for a vertical string, and the second Player can move elsewhere:
+    t_game.makeMove(Column{4});     ASSERT_FALSE(t_game.isWon());
+    ASSERT_FALSE(t_game.isEarlyDraw());
+
+    t_game.makeMove(Column{3});     ASSERT_TRUE(t_game.isWon());
+}
+
+
 TEST_F(GameTests, IsWon_ClassicGameBoardNoDiscs_ReturnsFalse)
 {
     Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
@@ -2550,3 +2576,618 @@ TEST_F(GameTests, makeMove_ColumnValueTooLarge_ExceptionThrown)
     ASSERT_THROW(t_game.makeMove(Column{CLASSIC_GAMEBOARD->nbColumns()}), PreconditionException);
 }
 
+
+
+TEST_F(GameTests, Hash_NewGame_EqualsGameBoardHash)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_EQ(t_game.hash(), CLASSIC_GAMEBOARD->hash());
+}
+
+
+TEST_F(GameTests, Hash_SameGridDifferentTurn_ReturnsDifferentHashes)
+{
+    // Same Grid, but the first Game has the first Player to move while the other one has the
+    // third Player to move:
+    const std::shared_ptr<GameBoard> t_gameBoard2{std::make_shared<GameBoard>()};
+
+    Game t_game {THREE_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+    Game t_game2{THREE_PLAYERS, t_gameBoard2,      Game::connectFour()};
+
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{2});
+
+    t_gameBoard2->placeDisc(Column{2}, Disc::yellowDisc());
+    t_game2.makeMove(Column{0});
+    t_game2.makeMove(Column{1});
+
+    ASSERT_TRUE(*CLASSIC_GAMEBOARD == *t_gameBoard2);
+    ASSERT_EQ(CLASSIC_GAMEBOARD->hash(), t_gameBoard2->hash());
+    ASSERT_NE(t_game.currentTurn(), t_game2.currentTurn());
+    ASSERT_NE(t_game.hash(), t_game2.hash());
+    ASSERT_NE(std::hash<Game>{}(t_game), std::hash<Game>{}(t_game2));
+}
+
+
+TEST_F(GameTests, Hash_TranspositionReached_ReturnsSameHash)
+{
+    const std::shared_ptr<GameBoard> t_gameBoard2{std::make_shared<GameBoard>()};
+
+    Game t_game {TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+    Game t_game2{TWO_PLAYERS, t_gameBoard2,      Game::connectFour()};
+
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{2});
+
+    t_game2.makeMove(Column{2});
+    t_game2.makeMove(Column{1});
+    t_game2.makeMove(Column{0});
+
+    ASSERT_EQ(t_game.hash(), t_game2.hash());
+}
+
+
+TEST_F(GameTests, CanonicalHash_MirroredGames_ReturnsSameHash)
+{
+    const std::shared_ptr<GameBoard> t_gameBoard2{std::make_shared<GameBoard>()};
+
+    Game t_game {THREE_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+    Game t_game2{THREE_PLAYERS, t_gameBoard2,      Game::connectFour()};
+
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{5});
+
+    t_game2.makeMove(Column{6});
+    t_game2.makeMove(Column{5});
+    t_game2.makeMove(Column{5});
+    t_game2.makeMove(Column{1});
+
+    ASSERT_NE(t_game.hash(), t_game2.hash());
+    ASSERT_EQ(t_game.canonicalHash(), t_game2.canonicalHash());
+    ASSERT_EQ(t_game.canonicalHash(), std::min(t_game.hash(), t_game2.hash()));
+
+    // The same move in both Games is the same canonical move:
+    ASSERT_EQ(t_game.canonicalColumn(Column{2}), t_game2.canonicalColumn(Column{4}));
+
+    t_game.makeMove(Column{2});
+    t_game2.makeMove(Column{4});
+
+    ASSERT_EQ(t_game.canonicalHash(), t_game2.canonicalHash());
+
+    t_game.undoMove();
+
+    ASSERT_NE(t_game.canonicalHash(), t_game2.canonicalHash());
+}
+
+
+TEST_F(GameTests, CanonicalColumn_ColumnTooLarge_ExceptionThrown)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_THROW(t_game.canonicalColumn(Column{7}), PreconditionException);
+}
+
+
+TEST_F(GameTests, UndoMove_CompletedMoves_GameRestored)
+{
+    Game t_game{THREE_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    t_game.makeMove(Column{3});
+
+    const GameBoard     boardBefore{*CLASSIC_GAMEBOARD};
+    const std::uint64_t hashBefore {t_game.hash()};
+
+    t_game.makeMove(Column{3});
+    t_game.makeMove(Column{4});
+
+    t_game.undoMove();
+    t_game.undoMove();
+
+    ASSERT_EQ(t_game.currentTurn(), 1);
+    ASSERT_EQ(t_game.nbOfCompletedMoves(), 1);
+    ASSERT_EQ(t_game.activePlayer(), *SECOND_PLAYER);
+    ASSERT_EQ(t_game.hash(), hashBefore);
+    ASSERT_TRUE(*CLASSIC_GAMEBOARD == boardBefore);
+
+    t_game.undoMove();
+
+    ASSERT_EQ(t_game.currentTurn(), 0);
+    ASSERT_EQ(t_game.nbOfCompletedMoves(), 0);
+    ASSERT_EQ(CLASSIC_GAMEBOARD->hash(), 0u);
+}
+
+
+TEST_F(GameTests, UndoMove_WinningMove_GameNoLongerWon)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    for(int move{0}; move < 3; ++move)
+    {
+        t_game.makeMove(Column{0});
+        t_game.makeMove(Column{1});
+    }
+
+    t_game.makeMove(Column{0});
+
+    ASSERT_TRUE(t_game.isWon());
+
+    t_game.undoMove();
+
+    ASSERT_FALSE(t_game.isWon());
+    ASSERT_EQ(t_game.activePlayer(), *FIRST_PLAYER);
+
+    t_game.makeMove(Column{2});
+
+    ASSERT_FALSE(t_game.isWon());
+}
+
+
+TEST_F(GameTests, UndoMove_NoMoveCompleted_ExceptionThrown)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_THROW(t_game.undoMove(), PreconditionException);
+}
+
+
+TEST_F(GameTests, WinningPositions_NotWon_ReturnsEmptyList)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_TRUE(t_game.winningPositions().empty());
+
+    t_game.makeMove(Column{0});
+
+    ASSERT_TRUE(t_game.winningPositions().empty());
+}
+
+
+TEST_F(GameTests, WinningPositions_HorizontalWin_ReturnsWinningString)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{2});
+    t_game.makeMove(Column{2});
+    t_game.makeMove(Column{4});
+    t_game.makeMove(Column{4});
+    t_game.makeMove(Column{3});
+
+    ASSERT_TRUE(t_game.isWon());
+
+    const std::vector<Position> expected{Position{Row{0}, Column{3}},
+                                         Position{Row{0}, Column{1}},
+                                         Position{Row{0}, Column{2}},
+                                         Position{Row{0}, Column{4}}};
+
+    ASSERT_EQ(t_game.winningPositions(), expected);
+}
+
+
+TEST_F(GameTests, WinningPositions_TwoWinningStrings_ReturnsBothStrings)
+{
+    //   2 | A | A | A |   |   |   |   |
+    //   1 | B | B | A |   |   |   |   |
+    //   0 | B | B | A |   |   | B | A |
+    //       0   1   2   3   4   5   6
+    //
+    // The last A, at (2, 2), completes both a horizontal and a vertical string of three.
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectThree()};
+
+    t_game.makeMove(Column{2});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{2});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{1});
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{6});
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{5});
+
+    ASSERT_FALSE(t_game.isWon());
+
+    t_game.makeMove(Column{2});
+
+    ASSERT_TRUE(t_game.isWon());
+
+    const std::vector<Position> expected{Position{Row{2}, Column{2}},
+                                         Position{Row{2}, Column{0}},
+                                         Position{Row{2}, Column{1}},
+                                         Position{Row{0}, Column{2}},
+                                         Position{Row{1}, Column{2}}};
+
+    ASSERT_EQ(t_game.winningPositions(), expected);
+
+    t_game.undoMove();
+
+    ASSERT_TRUE(t_game.winningPositions().empty());
+}
+
+
+TEST_F(GameTests, Threats_LinesOfThreeDiscs_ReturnsEmptyPositionsCompletingThem)
+{
+    // See the threats() documentation:
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    for(const int column : {1, 4, 2, 4, 3, 5, 3, 6, 3})
+    {
+        ASSERT_TRUE(t_game.makeMove(Column{column}));
+    }
+
+    ASSERT_EQ(t_game.threats(0, Column{0}), 0x1u);
+    ASSERT_EQ(t_game.threats(0, Column{3}), 0x8u);
+    ASSERT_EQ(t_game.threats(0, Column{4}), 0x0u);
+
+    // The second Player's line in Row 0 is blocked on both sides:
+    for(int column{0}; column < CLASSIC_GAMEBOARD->nbColumns(); ++column)
+    {
+        ASSERT_EQ(t_game.threats(1, Column{column}), 0x0u);
+    }
+
+    // The second Player must block both threats, which it can't:
+    ASSERT_EQ(t_game.winningColumns(0), 0x9u);
+    ASSERT_EQ(t_game.winningColumns(1), 0x0u);
+
+    ASSERT_TRUE(t_game.makeMove(Column{3}));
+
+    ASSERT_EQ(t_game.threats(0, Column{3}), 0x0u);
+    ASSERT_EQ(t_game.winningColumns(0), 0x1u);
+
+    t_game.undoMove();
+
+    ASSERT_EQ(t_game.threats(0, Column{3}), 0x8u);
+    ASSERT_EQ(t_game.winningColumns(0), 0x9u);
+}
+
+
+TEST_F(GameTests, Threats_ThreatAboveNextFreeRow_NotAWinningColumn)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    // The first Player's diagonal needs Row 3 of Column 3, which is not reachable yet:
+    for(const int column : {0, 1, 1, 2, 2, 3, 2, 6, 3})
+    {
+        ASSERT_TRUE(t_game.makeMove(Column{column}));
+    }
+
+    ASSERT_EQ(t_game.threats(0, Column{3}), 0x8u);
+    ASSERT_EQ(t_game.winningColumns(0) & 0x8u, 0x0u);
+
+    ASSERT_TRUE(t_game.makeMove(Column{3}));
+
+    ASSERT_EQ(t_game.winningColumns(0) & 0x8u, 0x8u);
+
+    ASSERT_TRUE(t_game.makeMove(Column{3}));
+    ASSERT_TRUE(t_game.isWon());
+}
+
+
+TEST_F(GameTests, Threats_RandomGames_SameAsCheckingEachPosition)
+{
+    // Checks, one Position at a time, if a Disc there would complete a string:
+    const auto t_isThreat = [](const GameBoard& p_gameBoard, DiscId p_discId, int p_inARow, int p_row, int p_column)
+    {
+        const int t_directions[4][2]{{0, 1}, {1, 0}, {1, 1}, {-1, 1}};
+
+        for(const auto& t_direction : t_directions)
+        {
+            int t_nbDiscs{1};
+
+            for(const int t_sign : {-1, 1})
+            {
+                int t_row   {p_row    + t_sign * t_direction[0]};
+                int t_column{p_column + t_sign * t_direction[1]};
+
+                while(t_row    >= 0 && t_row    < p_gameBoard.nbRows()    &&
+                      t_column >= 0 && t_column < p_gameBoard.nbColumns() &&
+                      p_gameBoard.discId(Position{Row{t_row}, Column{t_column}}) == p_discId)
+                {
+                    ++t_nbDiscs;
+
+                    t_row    += t_sign * t_direction[0];
+                    t_column += t_sign * t_direction[1];
+                }
+            }
+
+            if(t_nbDiscs >= p_inARow)
+            {
+                return true;
+            }
+        }
+
+        return false;
+    };
+
+    const std::vector<std::shared_ptr<GameBoard>> t_gameBoards{CLASSIC_GAMEBOARD, A_9_BY_9_GAMEBOARD, A_6_BY_10_GAMEBOARD};
+
+    std::mt19937 t_random{2026};
+
+    for(std::size_t t_iteration{0}; t_iteration < 12; ++t_iteration)
+    {
+        const std::shared_ptr<GameBoard> t_gameBoard{std::make_shared<GameBoard>(*t_gameBoards[t_iteration % 3])};
+        const int                        t_inARow   {t_iteration % 2 == 0 ? Game::connectFour() : Game::connectFive()};
+
+        // Three Players on the 9 by 9 GameBoard, so that it is evenly shared:
+        Game t_game{(t_iteration % 3 == 1 || t_iteration >= 6) ? THREE_PLAYERS : TWO_PLAYERS, t_gameBoard, t_inARow};
+
+        std::uniform_int_distribution<int> t_columns{0, t_gameBoard->nbColumns() - 1};
+
+        while(!t_game.isWon() && !t_game.isDraw())
+        {
+            const int t_move{t_columns(t_random)};
+
+            if(!t_game.makeMove(Column{t_move}))
+            {
+                continue;
+            }
+
+            // A move and its take back must leave everything as it was:
+            if(t_random() % 4 == 0)
+            {
+                t_game.undoMove();
+                ASSERT_TRUE(t_game.makeMove(Column{t_move}));
+            }
+
+            for(int t_player{0}; t_player < t_game.nbPlayers(); ++t_player)
+            {
+                std::uint64_t t_winningColumns{0};
+
+                for(int t_column{0}; t_column < t_gameBoard->nbColumns(); ++t_column)
+                {
+                    std::uint64_t t_threats{0};
+                    int           t_nextFreeRow{t_gameBoard->nbRows()};
+
+                    for(int t_row{t_gameBoard->nbRows() - 1}; t_row >= 0; --t_row)
+                    {
+                        if(t_gameBoard->discId(Position{Row{t_row}, Column{t_column}}) != DiscPalette::noDiscId())
+                        {
+                            break;
+                        }
+
+                        t_nextFreeRow = t_row;
+
+                        if(t_isThreat(*t_gameBoard, t_game.discIdOf(t_player), t_inARow, t_row, t_column))
+                        {
+                            t_threats |= std::uint64_t{1} << t_row;
+                        }
+                    }
+
+                    ASSERT_EQ(t_game.threats(t_player, Column{t_column}), t_threats);
+
+                    if(t_nextFreeRow < t_gameBoard->nbRows() && (t_threats >> t_nextFreeRow) & 1u)
+                    {
+                        t_winningColumns |= std::uint64_t{1} << t_column;
+                    }
+                }
+
+                ASSERT_EQ(t_game.winningColumns(t_player), t_winningColumns);
+            }
+        }
+    }
+}
+
+
+TEST_F(GameTests, Threats_InvalidArguments_ExceptionThrown)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_THROW(t_game.threats(-1, Column{0}), PreconditionException);
+    ASSERT_THROW(t_game.threats(2, Column{0}), PreconditionException);
+    ASSERT_THROW(t_game.threats(0, Column{7}), PreconditionException);
+    ASSERT_THROW(t_game.winningColumns(2), PreconditionException);
+}
+
+
+TEST_F(GameTests, Score_FirstMove_CountsWindowsHoldingIt)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_EQ(t_game.score(0), 0);
+    ASSERT_EQ(t_game.score(1), 0);
+    ASSERT_EQ(t_game.evaluation(), 0);
+
+    // Four horizontal windows, one vertical and one in each diagonal direction, with one Disc:
+    ASSERT_TRUE(t_game.makeMove(Column{3}));
+
+    ASSERT_EQ(t_game.score(0), 7 * t_game.evaluationWeights().weight(1));
+    ASSERT_EQ(t_game.score(1), 0);
+    ASSERT_EQ(t_game.evaluation(), -t_game.score(0));
+
+    // The second Player closes the vertical window and both share nothing else:
+    ASSERT_TRUE(t_game.makeMove(Column{3}));
+
+    ASSERT_EQ(t_game.score(0), 6 * t_game.evaluationWeights().weight(1));
+
+    t_game.undoMove();
+    t_game.undoMove();
+
+    ASSERT_EQ(t_game.score(0), 0);
+}
+
+
+TEST_F(GameTests, Score_RandomGames_SameAsCountingEachWindow)
+{
+    const std::vector<std::shared_ptr<GameBoard>> t_gameBoards{CLASSIC_GAMEBOARD, A_9_BY_9_GAMEBOARD, A_6_BY_10_GAMEBOARD};
+
+    std::mt19937 t_random{2026};
+
+    for(std::size_t t_iteration{0}; t_iteration < 12; ++t_iteration)
+    {
+        const std::shared_ptr<GameBoard> t_gameBoard{std::make_shared<GameBoard>(*t_gameBoards[t_iteration % 3])};
+        const int                        t_inARow   {t_iteration % 2 == 0 ? Game::connectFour() : Game::connectFive()};
+
+        // Three Players on the 9 by 9 GameBoard, so that it is evenly shared:
+        Game t_game{(t_iteration % 3 == 1 || t_iteration >= 6) ? THREE_PLAYERS : TWO_PLAYERS, t_gameBoard, t_inARow};
+
+        if(t_iteration >= 9)
+        {
+            std::vector<std::int64_t> t_weights;
+
+            for(int t_nbDiscs{1}; t_nbDiscs <= t_inARow; ++t_nbDiscs)
+            {
+                t_weights.push_back(t_nbDiscs * t_nbDiscs * t_nbDiscs);
+            }
+
+            t_game.setEvaluationWeights(std::make_shared<const EvaluationWeights>(t_inARow, t_weights));
+        }
+
+        const WinningLines t_lines{t_gameBoard->nbRows(), t_gameBoard->nbColumns(), t_inARow};
+
+        std::uniform_int_distribution<int> t_columns{0, t_gameBoard->nbColumns() - 1};
+
+        while(!t_game.isWon() && !t_game.isDraw())
+        {
+            const int t_move{t_columns(t_random)};
+
+            if(!t_game.makeMove(Column{t_move}))
+            {
+                continue;
+            }
+
+            // A move and its take back must leave everything as it was:
+            if(t_random() % 4 == 0)
+            {
+                t_game.undoMove();
+                ASSERT_TRUE(t_game.makeMove(Column{t_move}));
+            }
+
+            std::vector<std::int64_t> t_scores(static_cast<std::size_t>(t_game.nbPlayers()), 0);
+
+            for(int t_window{0}; t_window < t_lines.nbWindows(); ++t_window)
+            {
+                int t_owner  {-1};
+                int t_nbDiscs{0};
+
+                for(int t_offset{0}; t_offset < t_inARow && t_owner != -2; ++t_offset)
+                {
+                    const DiscId t_discId{t_gameBoard->discId(t_lines.position(t_window, t_offset))};
+
+                    if(t_discId != DiscPalette::noDiscId())
+                    {
+                        const int t_player{t_discId == t_game.discIdOf(0) ? 0 : (t_discId == t_game.discIdOf(1) ? 1 : 2)};
+
+                        t_owner = (t_nbDiscs == 0 || t_owner == t_player) ? t_player : -2;
+                        ++t_nbDiscs;
+                    }
+                }
+
+                if(t_owner >= 0)
+                {
+                    t_scores[static_cast<std::size_t>(t_owner)] += t_game.evaluationWeights().weight(t_nbDiscs);
+                }
+            }
+
+            for(int t_player{0}; t_player < t_game.nbPlayers(); ++t_player)
+            {
+                ASSERT_EQ(t_game.score(t_player), t_scores[static_cast<std::size_t>(t_player)]);
+            }
+        }
+    }
+}
+
+
+TEST_F(GameTests, SetEvaluationWeights_NewWeights_ScoresComputedAgain)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_TRUE(t_game.makeMove(Column{3}));
+    ASSERT_TRUE(t_game.makeMove(Column{0}));
+
+    t_game.setEvaluationWeights(std::make_shared<const EvaluationWeights>(4, std::vector<std::int64_t>{10, 0, 0, 0}));
+
+    // The bottom row window holding both Discs counts for nobody:
+    ASSERT_EQ(t_game.score(0), 60);
+    ASSERT_EQ(t_game.score(1), 20);
+    ASSERT_EQ(t_game.evaluation(), 60 - 20);
+}
+
+
+TEST_F(GameTests, SetEvaluationWeights_InvalidWeights_ExceptionThrown)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_THROW(t_game.setEvaluationWeights(nullptr), PreconditionException);
+    ASSERT_THROW(t_game.setEvaluationWeights(EvaluationWeights::forShape(6, 7, 5)), PreconditionException);
+    ASSERT_THROW(t_game.score(2), PreconditionException);
+}
+
+
+TEST_F(GameTests, UndoMove_EarlyDraw_NoLongerEarlyDraw)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    // Same moves as the vertical early draw edge case:
+    const std::vector<int> columns{4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 1, 2,
+                                   2, 1, 1, 2, 2, 1, 1, 2, 2, 1, 6, 5, 5, 6, 6, 5, 5, 5};
+
+    for(const int column : columns)
+    {
+        t_game.makeMove(Column{column});
+    }
+
+    ASSERT_FALSE(t_game.isEarlyDraw());
+
+    t_game.makeMove(Column{5});
+
+    ASSERT_TRUE(t_game.isEarlyDraw());
+
+    t_game.undoMove();
+
+    ASSERT_FALSE(t_game.isEarlyDraw());
+
+    // Undoing everything gives back a brand new Game:
+    while(t_game.nbOfCompletedMoves() > 0)
+    {
+        t_game.undoMove();
+
+        ASSERT_FALSE(t_game.isEarlyDraw());
+    }
+}
+
+
+TEST_F(GameTests, ActivePlayerIndex_MovesCompleted_FollowsTurns)
+{
+    Game t_game{THREE_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_EQ(t_game.nbPlayers(), 3);
+    ASSERT_EQ(t_game.activePlayerIndex(), 0);
+
+    t_game.makeMove(Column{0});
+    t_game.makeMove(Column{0});
+
+    ASSERT_EQ(t_game.activePlayerIndex(), 2);
+    ASSERT_EQ(t_game.activePlayer(), *THIRD_PLAYER);
+
+    t_game.makeMove(Column{0});
+
+    ASSERT_EQ(t_game.activePlayerIndex(), 0);
+}
+
+
+TEST_F(GameTests, DiscIdOf_ValidIndexes_ReturnsPlayerDiscIdentifiers)
+{
+    Game t_game{THREE_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_EQ(CLASSIC_GAMEBOARD->palette().disc(t_game.discIdOf(0)), FIRST_PLAYER->disc());
+    ASSERT_EQ(CLASSIC_GAMEBOARD->palette().disc(t_game.discIdOf(2)), THIRD_PLAYER->disc());
+
+    t_game.makeMove(Column{4});
+
+    ASSERT_EQ(CLASSIC_GAMEBOARD->discId(Position{Row{0}, Column{4}}), t_game.discIdOf(0));
+}
+
+
+TEST_F(GameTests, DiscIdOf_InvalidIndexes_ExceptionThrown)
+{
+    Game t_game{TWO_PLAYERS, CLASSIC_GAMEBOARD, Game::connectFour()};
+
+    ASSERT_THROW(t_game.discIdOf(-1), PreconditionException);
+    ASSERT_THROW(t_game.discIdOf(2), PreconditionException);
+}
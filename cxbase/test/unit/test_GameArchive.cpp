@@ -0,0 +1,309 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    test_GameArchive.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the GameArchive and GameArchiveWriter classes.
+ *
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/GameArchive.h>
+#include <include/GameArchiveWriter.h>
+
+
+using namespace cxbase;
+
+
+class GameArchiveTests: public::testing::Test
+{
+
+public:
+
+    void TearDown() override
+    {
+        std::remove(ARCHIVE_PATH.c_str());
+    }
+
+    std::unique_ptr<Game> classicGame() const
+    {
+        return std::unique_ptr<Game>{new Game{TWO_PLAYERS, std::make_shared<GameBoard>(), Game::connectFour()}};
+    }
+
+    const std::string                           ARCHIVE_PATH  {"cxbase_test_GameArchive.cxg"};
+
+    const std::shared_ptr<Player>               FIRST_PLAYER  {std::make_shared<Player>(cxutil::Name{"First Player" }, Disc::blackDisc())};
+    const std::shared_ptr<Player>               SECOND_PLAYER {std::make_shared<Player>(cxutil::Name{"Second Player"}, Disc::redDisc()  )};
+
+    const std::vector<std::shared_ptr<Player>>  TWO_PLAYERS   {FIRST_PLAYER, SECOND_PLAYER};
+
+    // First Player wins vertically in Column 0:
+    const std::vector<std::uint8_t>             A_WON_GAME    {0, 1, 0, 1, 0, 1, 0};
+    const std::vector<std::uint8_t>             A_SHORT_GAME  {3, 3, 4};
+
+};
+
+
+TEST_F(GameArchiveTests, WriteAndOpen_SomeGames_RecordsAreReadBackInOrder)
+{
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 7, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    std::unique_ptr<Game> t_game{classicGame()};
+
+    for(const std::uint8_t column : A_SHORT_GAME)
+    {
+        ASSERT_TRUE(t_game->makeMove(Column{column}));
+    }
+
+    t_writer.write(*t_game);
+    t_writer.write(A_WON_GAME.data(), A_WON_GAME.size());
+    t_writer.write(nullptr, 0);
+    ASSERT_EQ(t_writer.size(), 3u);
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+    ASSERT_FALSE(t_writer.isOpen());
+
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open(ARCHIVE_PATH)};
+    ASSERT_TRUE(t_opened.isOk());
+
+    ASSERT_EQ(t_archive.nbRows(), 6);
+    ASSERT_EQ(t_archive.nbColumns(), 7);
+    ASSERT_EQ(t_archive.inARow(), 4);
+    ASSERT_EQ(t_archive.nbPlayers(), 2);
+    ASSERT_EQ(t_archive.size(), 3u);
+
+    // One byte per move, and one per Game:
+    ASSERT_EQ(t_archive.end() - t_archive.begin(), 3 + 1 + 7 + 1 + 1);
+
+    const std::uint8_t*  t_cursor{t_archive.begin()};
+    GameArchive::Record  t_record;
+
+    ASSERT_TRUE(t_archive.next(t_cursor, t_record));
+    ASSERT_EQ(std::vector<std::uint8_t>(t_record.begin(), t_record.end()), A_SHORT_GAME);
+
+    ASSERT_TRUE(t_archive.next(t_cursor, t_record));
+    ASSERT_EQ(std::vector<std::uint8_t>(t_record.begin(), t_record.end()), A_WON_GAME);
+    ASSERT_EQ(t_record.column(0), Column{0});
+
+    ASSERT_TRUE(t_archive.next(t_cursor, t_record));
+    ASSERT_EQ(t_record.nbMoves(), 0);
+
+    ASSERT_FALSE(t_archive.next(t_cursor, t_record));
+    ASSERT_EQ(t_cursor, t_archive.end());
+}
+
+
+TEST_F(GameArchiveTests, Replay_ValidRecord_GameIsReplayedAndCanBeUndone)
+{
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 7, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    t_writer.write(A_WON_GAME.data(), A_WON_GAME.size());
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open(ARCHIVE_PATH)};
+    ASSERT_TRUE(t_opened.isOk());
+
+    const std::uint8_t*  t_cursor{t_archive.begin()};
+    GameArchive::Record  t_record;
+    ASSERT_TRUE(t_archive.next(t_cursor, t_record));
+
+    std::unique_ptr<Game> t_game{classicGame()};
+
+    ASSERT_EQ(t_archive.replay(t_record, *t_game), 7);
+    ASSERT_TRUE(t_game->isWon());
+    ASSERT_EQ(t_game->completedMovePositions().front(), (Position{Row{0}, Column{0}}));
+
+    for(int move{0}; move < 7; ++move)
+    {
+        t_game->undoMove();
+    }
+
+    ASSERT_EQ(t_game->nbOfCompletedMoves(), 0);
+    ASSERT_EQ(t_archive.replay(t_record, *t_game), 7);
+}
+
+
+TEST_F(GameArchiveTests, Replay_MoveAfterWin_ReplayStops)
+{
+    std::vector<std::uint8_t> t_moves{A_WON_GAME};
+    t_moves.push_back(2);
+
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 7, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    t_writer.write(t_moves.data(), t_moves.size());
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open(ARCHIVE_PATH)};
+    ASSERT_TRUE(t_opened.isOk());
+
+    const std::uint8_t*  t_cursor{t_archive.begin()};
+    GameArchive::Record  t_record;
+    ASSERT_TRUE(t_archive.next(t_cursor, t_record));
+
+    std::unique_ptr<Game> t_game{classicGame()};
+
+    ASSERT_EQ(t_archive.replay(t_record, *t_game), 7);
+}
+
+
+TEST_F(GameArchiveTests, Align_AnyPoint_EveryRecordIsInExactlyOneChunk)
+{
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 7, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    for(int game{0}; game < 10; ++game)
+    {
+        t_writer.write(A_WON_GAME.data(), static_cast<std::size_t>(game % A_WON_GAME.size()));
+    }
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open(ARCHIVE_PATH)};
+    ASSERT_TRUE(t_opened.isOk());
+
+    // Whatever the split points, all records are found once:
+    for(std::ptrdiff_t chunkSize{1}; chunkSize <= t_archive.end() - t_archive.begin(); ++chunkSize)
+    {
+        std::size_t t_nbRecords{0};
+
+        for(const std::uint8_t* t_from{t_archive.begin()}; t_from < t_archive.end(); t_from += std::min(chunkSize, t_archive.end() - t_from))
+        {
+            const std::uint8_t* t_cursor{t_archive.align(t_from)};
+            const std::uint8_t* t_last  {t_archive.align(t_from + std::min(chunkSize, t_archive.end() - t_from))};
+
+            GameArchive::Record t_record;
+
+            while(t_cursor != t_last && t_archive.next(t_cursor, t_record))
+            {
+                ++t_nbRecords;
+            }
+        }
+
+        ASSERT_EQ(t_nbRecords, t_archive.size());
+    }
+}
+
+
+TEST_F(GameArchiveTests, Open_MissingFile_ErrorReturned)
+{
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open("cxbase_test_NoSuchArchive.cxg")};
+
+    ASSERT_FALSE(t_opened.isOk());
+    ASSERT_FALSE(t_archive.isOpen());
+}
+
+
+TEST_F(GameArchiveTests, Open_NotAnArchive_ErrorReturned)
+{
+    {
+        std::ofstream t_file{ARCHIVE_PATH, std::ios::binary};
+        t_file << "This is not a game archive, but it is long enough to hold a header.";
+    }
+
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open(ARCHIVE_PATH)};
+
+    ASSERT_FALSE(t_opened.isOk());
+    ASSERT_FALSE(t_archive.isOpen());
+}
+
+
+TEST_F(GameArchiveTests, Open_TruncatedArchive_ErrorReturned)
+{
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 7, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    t_writer.write(A_WON_GAME.data(), A_WON_GAME.size());
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+
+    // The last marker is cut off:
+    std::ifstream t_in{ARCHIVE_PATH, std::ios::binary};
+    std::string   t_content{std::istreambuf_iterator<char>{t_in}, std::istreambuf_iterator<char>{}};
+    t_in.close();
+
+    std::ofstream t_out{ARCHIVE_PATH, std::ios::binary | std::ios::trunc};
+    t_out.write(t_content.data(), static_cast<std::streamsize>(t_content.size() - 1));
+    t_out.close();
+
+    GameArchive t_archive;
+    cxutil::ReturnCode t_opened{t_archive.open(ARCHIVE_PATH)};
+
+    ASSERT_FALSE(t_opened.isOk());
+}
+
+
+TEST_F(GameArchiveTests, Write_ColumnOutsideGameBoard_ExceptionThrown)
+{
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 7, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    const std::uint8_t t_column{7};
+
+    ASSERT_THROW(t_writer.write(&t_column, 1), PreconditionException);
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+}
+
+
+TEST_F(GameArchiveTests, Write_GameOfAnotherShape_ExceptionThrown)
+{
+    GameArchiveWriter t_writer;
+    cxutil::ReturnCode t_created{t_writer.open(ARCHIVE_PATH, 6, 8, 4, 2)};
+    ASSERT_TRUE(t_created.isOk());
+
+    ASSERT_THROW(t_writer.write(*classicGame()), PreconditionException);
+
+    cxutil::ReturnCode t_written{t_writer.close()};
+    ASSERT_TRUE(t_written.isOk());
+}
@@ -32,6 +32,7 @@
 #include <gtest/gtest.h>
 
 #include <include/GameBoard.h>
+#include <include/Zobrist.h>
 
 
 using namespace std;
@@ -431,3 +432,280 @@ TEST_F(GameBoardTests, FunctionOperator_ColumnTooSmallInPositionParameter_Except
 }
 
 
+
+
+TEST_F(GameBoardTests, FunctionOperator_EmptyPositionAsParameter_ReturnsNoDisc)
+{
+    t_gameBoard.placeDisc(Column{2}, Disc::blackDisc());
+
+    ASSERT_EQ(Disc::noDisc(), t_gameBoard(Position{Row{1}, Column{2}}));
+    ASSERT_EQ(Disc::noDisc(), t_gameBoard(Position{Row{0}, Column{3}}));
+}
+
+
+TEST(GameBoard, PlaceDisc_LargestGameBoardFullColumn_AllRowsAccessible)
+{
+    GameBoard t_gameBoard{64, 64};
+
+    for(int row{0}; row < 64; ++row)
+    {
+        ASSERT_FALSE(t_gameBoard.isColumnFull(Column{63}));
+
+        const Disc disc{row % 2 == 0 ? Disc::redDisc() : Disc::blackDisc()};
+
+        ASSERT_EQ(t_gameBoard.placeDisc(Column{63}, disc), (Position{Row{row}, Column{63}}));
+    }
+
+    ASSERT_TRUE(t_gameBoard.isColumnFull(Column{63}));
+    ASSERT_FALSE(t_gameBoard.isColumnFull(Column{62}));
+
+    ASSERT_EQ(t_gameBoard(Position{Row{0},  Column{63}}), Disc::redDisc());
+    ASSERT_EQ(t_gameBoard(Position{Row{63}, Column{63}}), Disc::blackDisc());
+}
+
+
+TEST_F(GameBoardTests, EqualToOperator_SameDiscsPlacedInDifferentOrder_ReturnsTrue)
+{
+    GameBoard t_gameBoard2;
+
+    t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{1}, Disc::redDisc());
+
+    t_gameBoard2.placeDisc(Column{1}, Disc::redDisc());
+    t_gameBoard2.placeDisc(Column{0}, Disc::blackDisc());
+
+    ASSERT_TRUE(t_gameBoard == t_gameBoard2);
+}
+
+
+TEST_F(GameBoardTests, EqualToOperator_DifferenceOnUpperRow_ReturnsFalse)
+{
+    GameBoard t_gameBoard2;
+
+    t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{0}, Disc::redDisc());
+
+    t_gameBoard2.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard2.placeDisc(Column{0}, Disc::blackDisc());
+
+    ASSERT_FALSE(t_gameBoard == t_gameBoard2);
+}
+
+
+TEST_F(GameBoardTests, PlaceDisc_FullColumn_ReturnsTopMostPosition)
+{
+    for(int row{0}; row < NB_ROWS_MIN; ++row)
+    {
+        t_gameBoard.placeDisc(Column{3}, Disc::redDisc());
+    }
+
+    ASSERT_EQ(t_gameBoard.placeDisc(Column{3}, Disc::blackDisc()), (Position{Row{NB_ROWS_MIN - 1}, Column{3}}));
+    ASSERT_EQ(t_gameBoard(Position{Row{NB_ROWS_MIN - 1}, Column{3}}), Disc::redDisc());
+}
+
+
+TEST_F(GameBoardTests, DiscId_PlacedDisc_ReturnsRegisteredIdentifier)
+{
+    const DiscId redId{t_gameBoard.registerDisc(Disc::redDisc())};
+
+    t_gameBoard.placeDisc(Column{4}, Disc::redDisc());
+
+    ASSERT_EQ(t_gameBoard.discId(Position{Row{0}, Column{4}}), redId);
+    ASSERT_EQ(t_gameBoard.discId(Position{Row{1}, Column{4}}), DiscPalette::noDiscId());
+    ASSERT_EQ(t_gameBoard.palette().disc(redId), Disc::redDisc());
+}
+
+
+TEST_F(GameBoardTests, PlaceDisc_ValidDiscIdAsParameter_DiscInsertedInGameboard)
+{
+    const DiscId blackId{t_gameBoard.registerDisc(Disc::blackDisc())};
+
+    ASSERT_EQ(t_gameBoard.placeDisc(Column{1}, blackId), (Position{Row{0}, Column{1}}));
+    ASSERT_EQ(t_gameBoard(Position{Row{0}, Column{1}}), Disc::blackDisc());
+}
+
+
+TEST_F(GameBoardTests, PlaceDisc_NoDiscIdAsParameter_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.placeDisc(Column{1}, DiscPalette::noDiscId()), PreconditionException);
+}
+
+
+TEST_F(GameBoardTests, PlaceDisc_UnregisteredDiscIdAsParameter_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.placeDisc(Column{1}, DiscId{1}), PreconditionException);
+}
+
+
+TEST_F(GameBoardTests, RegisterDisc_NoDiscAsParameter_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.registerDisc(Disc::noDisc()), PreconditionException);
+}
+
+
+TEST_F(GameBoardTests, Hash_EmptyGameBoards_ReturnsZero)
+{
+    ASSERT_EQ(t_gameBoard.hash(), 0u);
+    ASSERT_EQ(GameBoard(64, 64).hash(), 0u);
+}
+
+
+TEST_F(GameBoardTests, Hash_SameDiscsPlacedInDifferentOrder_ReturnsSameHash)
+{
+    GameBoard t_gameBoard2;
+
+    // The second GameBoard registers its Discs in the reverse order:
+    t_gameBoard2.registerDisc(Disc::redDisc());
+
+    t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{1}, Disc::redDisc());
+    t_gameBoard.placeDisc(Column{1}, Disc::blackDisc());
+
+    t_gameBoard2.placeDisc(Column{1}, Disc::redDisc());
+    t_gameBoard2.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard2.placeDisc(Column{1}, Disc::blackDisc());
+
+    ASSERT_TRUE(t_gameBoard == t_gameBoard2);
+    ASSERT_EQ(t_gameBoard.hash(), t_gameBoard2.hash());
+    ASSERT_EQ(std::hash<GameBoard>{}(t_gameBoard), std::hash<GameBoard>{}(t_gameBoard2));
+}
+
+
+TEST_F(GameBoardTests, Hash_DifferentDiscsAtSamePositions_ReturnsDifferentHashes)
+{
+    GameBoard t_gameBoard2;
+
+    t_gameBoard.placeDisc(Column{3}, Disc::blackDisc());
+    t_gameBoard2.placeDisc(Column{3}, Disc::redDisc());
+
+    ASSERT_NE(t_gameBoard.hash(), t_gameBoard2.hash());
+    ASSERT_NE(t_gameBoard.hash(), 0u);
+}
+
+
+TEST_F(GameBoardTests, Hash_DiscPlaced_IsIncrementallyUpdated)
+{
+    const Position position{t_gameBoard.placeDisc(Column{5}, Disc::yellowDisc())};
+
+    ASSERT_EQ(t_gameBoard.hash(), Zobrist::positionKey(position, Disc::yellowDisc()));
+
+    const std::uint64_t hashBefore{t_gameBoard.hash()};
+    const Position      position2{t_gameBoard.placeDisc(Column{5}, Disc::blueDisc())};
+
+    ASSERT_EQ(t_gameBoard.hash(), hashBefore ^ Zobrist::positionKey(position2, Disc::blueDisc()));
+}
+
+
+TEST_F(GameBoardTests, Hash_FullColumn_IsNotUpdated)
+{
+    for(int row{0}; row < t_gameBoard.nbRows(); ++row)
+    {
+        t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+    }
+
+    const std::uint64_t hashBefore{t_gameBoard.hash()};
+
+    t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+
+    ASSERT_EQ(t_gameBoard.hash(), hashBefore);
+}
+
+
+TEST_F(GameBoardTests, MirroredHash_DiscsPlaced_ReturnsHashOfMirrorImage)
+{
+    GameBoard t_mirror;
+
+    t_gameBoard.placeDisc(Column{0}, Disc::redDisc());
+    t_gameBoard.placeDisc(Column{0}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{4}, Disc::redDisc());
+
+    t_mirror.placeDisc(Column{6}, Disc::redDisc());
+    t_mirror.placeDisc(Column{6}, Disc::blackDisc());
+    t_mirror.placeDisc(Column{2}, Disc::redDisc());
+
+    ASSERT_EQ(t_gameBoard.mirroredHash(), t_mirror.hash());
+    ASSERT_EQ(t_mirror.mirroredHash(), t_gameBoard.hash());
+    ASSERT_NE(t_gameBoard.hash(), t_mirror.hash());
+    ASSERT_EQ(t_gameBoard.canonicalHash(), t_mirror.canonicalHash());
+}
+
+
+TEST_F(GameBoardTests, MirroredHash_SymmetricGameBoard_ReturnsHash)
+{
+    t_gameBoard.placeDisc(Column{3}, Disc::redDisc());
+    t_gameBoard.placeDisc(Column{2}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{4}, Disc::blackDisc());
+
+    ASSERT_EQ(t_gameBoard.mirroredHash(), t_gameBoard.hash());
+    ASSERT_EQ(t_gameBoard.canonicalHash(), t_gameBoard.hash());
+    ASSERT_EQ(t_gameBoard.canonicalColumn(Column{1}), Column{1});
+}
+
+
+TEST_F(GameBoardTests, CanonicalColumn_MirrorImages_ReturnsSameCanonicalMove)
+{
+    GameBoard t_mirror;
+
+    t_gameBoard.placeDisc(Column{1}, Disc::redDisc());
+    t_mirror.placeDisc(Column{5}, Disc::redDisc());
+
+    // The same move, seen from both GameBoards, is the same move on the canonical GameBoard:
+    ASSERT_EQ(t_gameBoard.canonicalColumn(Column{2}), t_mirror.canonicalColumn(Column{4}));
+    ASSERT_EQ(t_gameBoard.canonicalColumn(Column{3}), t_mirror.canonicalColumn(Column{3}));
+
+    // The mapping works both ways:
+    ASSERT_EQ(t_gameBoard.canonicalColumn(t_gameBoard.canonicalColumn(Column{0})), Column{0});
+}
+
+
+TEST_F(GameBoardTests, CanonicalColumn_ColumnTooLarge_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.canonicalColumn(Column{7}), PreconditionException);
+}
+
+
+TEST_F(GameBoardTests, RemoveDisc_PlacedDiscs_GameBoardRestored)
+{
+    GameBoard t_reference;
+
+    t_gameBoard.placeDisc(Column{2}, Disc::redDisc());
+    t_reference.placeDisc(Column{2}, Disc::redDisc());
+
+    t_gameBoard.placeDisc(Column{2}, Disc::blackDisc());
+    t_gameBoard.placeDisc(Column{3}, Disc::blackDisc());
+
+    ASSERT_EQ(t_gameBoard.removeDisc(Column{2}), (Position{Row{1}, Column{2}}));
+    ASSERT_EQ(t_gameBoard.removeDisc(Column{3}), (Position{Row{0}, Column{3}}));
+
+    ASSERT_EQ(t_gameBoard(Position{Row{1}, Column{2}}), Disc::noDisc());
+    ASSERT_TRUE(t_gameBoard == t_reference);
+    ASSERT_EQ(t_gameBoard.hash(), t_reference.hash());
+    ASSERT_EQ(t_gameBoard.mirroredHash(), t_reference.mirroredHash());
+
+    ASSERT_EQ(t_gameBoard.placeDisc(Column{2}, Disc::yellowDisc()), (Position{Row{1}, Column{2}}));
+}
+
+
+TEST_F(GameBoardTests, RemoveDisc_FullColumn_ColumnNoLongerFull)
+{
+    for(int row{0}; row < t_gameBoard.nbRows(); ++row)
+    {
+        t_gameBoard.placeDisc(Column{6}, Disc::redDisc());
+    }
+
+    t_gameBoard.removeDisc(Column{6});
+
+    ASSERT_FALSE(t_gameBoard.isColumnFull(Column{6}));
+}
+
+
+TEST_F(GameBoardTests, RemoveDisc_EmptyColumn_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.removeDisc(Column{0}), PreconditionException);
+}
+
+
+TEST_F(GameBoardTests, RemoveDisc_ColumnTooLarge_ExceptionThrown)
+{
+    ASSERT_THROW(t_gameBoard.removeDisc(Column{7}), PreconditionException);
+}
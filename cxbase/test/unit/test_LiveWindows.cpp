@@ -0,0 +1,168 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_LiveWindows.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for a the LiveWindows class.
+ *
+ **************************************************************************************************/
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <include/LiveWindows.h>
+
+
+using namespace cxbase;
+
+
+namespace
+{
+
+/***********************************************************************************************//**
+ * Creates the windows of a classic connect four game, with weights 1, 10, 100 and 1000.
+ *
+ * @param p_withVerticalWindows @c true to count vertical windows.
+ *
+ **************************************************************************************************/
+LiveWindows classicWindows(bool p_withVerticalWindows)
+{
+    return LiveWindows{WinningLines::forShape(6, 7, 4),
+                       2,
+                       std::make_shared<const EvaluationWeights>(4, std::vector<std::int64_t>{1, 10, 100, 1000}),
+                       p_withVerticalWindows};
+}
+
+} // unamed namespace
+
+
+TEST(LiveWindows, Constructor_ClassicShape_AllWindowsEmpty)
+{
+    const LiveWindows t_all       {classicWindows(true)};
+    const LiveWindows t_noVertical{classicWindows(false)};
+
+    ASSERT_EQ(t_all.nbEmptyWindows(), 69);
+    ASSERT_EQ(t_noVertical.nbEmptyWindows(), 69 - 21);
+
+    ASSERT_EQ(t_all.score(0), 0);
+    ASSERT_EQ(t_all.score(1), 0);
+    ASSERT_EQ(t_all.nbLiveWindows(0, 3), 0);
+}
+
+
+TEST(LiveWindows, Constructor_OnePlayer_ExceptionThrown)
+{
+    ASSERT_THROW((LiveWindows{WinningLines::forShape(6, 7, 4), 1, EvaluationWeights::forShape(6, 7, 4), true}),
+                 PreconditionException);
+}
+
+
+TEST(LiveWindows, AddDisc_TwoPlayers_SharedWindowsNotCounted)
+{
+    LiveWindows t_windows{classicWindows(true)};
+
+    // Horizontal, vertical and diagonal upward windows:
+    t_windows.addDisc(Position{Row{0}, Column{0}}, 0);
+
+    ASSERT_EQ(t_windows.score(0), 3);
+    ASSERT_EQ(t_windows.nbLiveWindows(0, 3), 3);
+    ASSERT_EQ(t_windows.nbEmptyWindows(), 69 - 3);
+
+    // Two more horizontal windows, one of them shared:
+    t_windows.addDisc(Position{Row{0}, Column{1}}, 1);
+
+    ASSERT_EQ(t_windows.score(0), 2);
+    ASSERT_EQ(t_windows.score(1), 3);
+    ASSERT_EQ(t_windows.nbLiveWindows(1, 3), 3);
+    ASSERT_EQ(t_windows.nbEmptyWindows(), 69 - 3 - 3);
+}
+
+
+TEST(LiveWindows, AddDisc_NoVerticalWindows_VerticalWindowsNotCounted)
+{
+    LiveWindows t_windows{classicWindows(false)};
+
+    t_windows.addDisc(Position{Row{0}, Column{0}}, 0);
+    t_windows.addDisc(Position{Row{1}, Column{0}}, 0);
+
+    // The horizontal and diagonal upward windows of both Discs:
+    ASSERT_EQ(t_windows.score(0), 4);
+}
+
+
+TEST(LiveWindows, AddDisc_CompletedWindow_CountedWithoutEmptyPositions)
+{
+    LiveWindows t_windows{classicWindows(true)};
+
+    for(int column{0}; column < 4; ++column)
+    {
+        ASSERT_EQ(t_windows.nbLiveWindows(0, 0), 0);
+
+        t_windows.addDisc(Position{Row{0}, Column{column}}, 0);
+    }
+
+    ASSERT_EQ(t_windows.nbLiveWindows(0, 0), 1);
+    ASSERT_EQ(t_windows.nbLiveWindows(0, 1), 1);
+}
+
+
+TEST(LiveWindows, AddDisc_DiscOfNoPlayer_WindowsNotWinnable)
+{
+    LiveWindows t_windows{classicWindows(true)};
+
+    t_windows.addDisc(Position{Row{0}, Column{0}}, -1);
+    t_windows.addDisc(Position{Row{1}, Column{0}}, 0);
+
+    // The vertical window from Row 0 can not be won anymore, the three others can:
+    ASSERT_EQ(t_windows.score(0), 3);
+    ASSERT_EQ(t_windows.score(1), 0);
+}
+
+
+TEST(LiveWindows, RemoveDisc_AfterAddDisc_CountsRestored)
+{
+    LiveWindows t_windows{classicWindows(true)};
+
+    t_windows.addDisc(Position{Row{0}, Column{0}}, 0);
+    t_windows.addDisc(Position{Row{0}, Column{1}}, 0);
+    t_windows.addDisc(Position{Row{0}, Column{2}}, 1);
+
+    const std::int64_t t_score{t_windows.score(0)};
+
+    // The windows shared with the last Disc are open again once it is removed:
+    t_windows.removeDisc(Position{Row{0}, Column{2}}, 1);
+
+    ASSERT_GT(t_windows.score(0), t_score);
+    ASSERT_EQ(t_windows.score(1), 0);
+
+    t_windows.removeDisc(Position{Row{0}, Column{1}}, 0);
+    t_windows.removeDisc(Position{Row{0}, Column{0}}, 0);
+
+    ASSERT_EQ(t_windows.score(0), 0);
+    ASSERT_EQ(t_windows.nbLiveWindows(0, 3), 0);
+    ASSERT_EQ(t_windows.nbEmptyWindows(), 69);
+}
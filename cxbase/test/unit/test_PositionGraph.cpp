@@ -0,0 +1,245 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+/***********************************************************************************************//**
+ * @file    test_PositionGraph.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for the PositionGraph and PositionGraphBuilder classes.
+ *
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/ContractException.h>
+
+#include <include/PositionGraph.h>
+#include <include/PositionGraphBuilder.h>
+
+
+using namespace cxbase;
+
+
+class PositionGraphTests: public::testing::Test
+{
+
+public:
+
+    void TearDown() override
+    {
+        std::remove(GRAPH_PATH.c_str());
+    }
+
+    const std::string                           GRAPH_PATH    {"cxbase_test_PositionGraph.cxp"};
+
+    const std::shared_ptr<Player>               FIRST_PLAYER  {std::make_shared<Player>(cxutil::Name{"First Player" }, Disc::blackDisc())};
+    const std::shared_ptr<Player>               SECOND_PLAYER {std::make_shared<Player>(cxutil::Name{"Second Player"}, Disc::redDisc()  )};
+
+    const std::vector<std::shared_ptr<Player>>  TWO_PLAYERS   {FIRST_PLAYER, SECOND_PLAYER};
+
+    // Both reach the same position, through different moves:
+    const std::vector<std::uint8_t>             A_GAME            {3, 4, 2, 5};
+    const std::vector<std::uint8_t>             A_TRANSPOSED_GAME {2, 5, 3, 4};
+    const std::vector<std::uint8_t>             A_MIRRORED_GAME   {3, 2, 4, 1};
+
+    // First Player wins vertically in Column 0:
+    const std::vector<std::uint8_t>             A_WON_GAME        {0, 1, 0, 1, 0, 1, 0};
+
+};
+
+
+TEST_F(PositionGraphTests, Add_TransposedGames_PositionsAreMerged)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+
+    ASSERT_TRUE(t_builder.add(A_GAME.data(), A_GAME.size()));
+    ASSERT_TRUE(t_builder.add(A_TRANSPOSED_GAME.data(), A_TRANSPOSED_GAME.size()));
+
+    // The empty GameBoard and the last position are shared:
+    ASSERT_EQ(t_builder.nbGames(), 2u);
+    ASSERT_EQ(t_builder.nbPositions(), 10u);
+    ASSERT_EQ(t_builder.size(), 8u);
+    ASSERT_EQ(t_builder.nbEdges(), 8u);
+
+    // The same Game again adds no position:
+    ASSERT_TRUE(t_builder.add(A_GAME.data(), A_GAME.size()));
+    ASSERT_EQ(t_builder.size(), 8u);
+    ASSERT_EQ(t_builder.nbEdges(), 8u);
+}
+
+
+TEST_F(PositionGraphTests, Add_MirroredGames_PositionsAreMerged)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+
+    ASSERT_TRUE(t_builder.add(A_GAME.data(), A_GAME.size()));
+    ASSERT_TRUE(t_builder.add(A_MIRRORED_GAME.data(), A_MIRRORED_GAME.size()));
+
+    // Every position is the mirror image of one of the first Game. Only the second moves differ:
+    // after the first move, the position is its own mirror image, so both Columns are kept:
+    ASSERT_EQ(t_builder.size(), 5u);
+    ASSERT_EQ(t_builder.nbEdges(), 5u);
+}
+
+
+TEST_F(PositionGraphTests, Add_InvalidGame_NothingAdded)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+
+    std::vector<std::uint8_t> t_afterWin{A_WON_GAME};
+    t_afterWin.push_back(2);
+
+    const std::vector<std::uint8_t> t_outside{3, 7};
+    const std::vector<std::uint8_t> t_fullColumn{0, 0, 0, 1, 0, 0, 0, 0};
+
+    ASSERT_FALSE(t_builder.add(t_afterWin.data(), t_afterWin.size()));
+    ASSERT_FALSE(t_builder.add(t_outside.data(), t_outside.size()));
+    ASSERT_FALSE(t_builder.add(t_fullColumn.data(), t_fullColumn.size()));
+
+    ASSERT_EQ(t_builder.nbGames(), 0u);
+    ASSERT_EQ(t_builder.size(), 0u);
+}
+
+
+TEST_F(PositionGraphTests, Add_Game_SameAsItsMoves)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+    Game                 t_game{TWO_PLAYERS, std::make_shared<GameBoard>(), Game::connectFour()};
+
+    for(const std::uint8_t column : A_WON_GAME)
+    {
+        ASSERT_TRUE(t_game.makeMove(Column{column}));
+    }
+
+    ASSERT_TRUE(t_builder.add(t_game));
+    ASSERT_TRUE(t_builder.add(A_WON_GAME.data(), A_WON_GAME.size()));
+
+    ASSERT_EQ(t_builder.size(), A_WON_GAME.size() + 1);
+}
+
+
+TEST_F(PositionGraphTests, WriteAndOpen_SomeGames_GraphIsReadBack)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+
+    ASSERT_TRUE(t_builder.add(A_GAME.data(), A_GAME.size()));
+    ASSERT_TRUE(t_builder.add(A_TRANSPOSED_GAME.data(), A_TRANSPOSED_GAME.size()));
+    ASSERT_TRUE(t_builder.add(A_WON_GAME.data(), A_WON_GAME.size()));
+
+    cxutil::ReturnCode t_written{t_builder.write(GRAPH_PATH)};
+    ASSERT_TRUE(t_written.isOk());
+
+    PositionGraph t_graph;
+    cxutil::ReturnCode t_opened{t_graph.open(GRAPH_PATH)};
+    ASSERT_TRUE(t_opened.isOk());
+
+    ASSERT_EQ(t_graph.nbRows(), 6);
+    ASSERT_EQ(t_graph.nbColumns(), 7);
+    ASSERT_EQ(t_graph.inARow(), 4);
+    ASSERT_EQ(t_graph.nbPlayers(), 2);
+    ASSERT_EQ(t_graph.size(), t_builder.size());
+    ASSERT_EQ(t_graph.nbEdges(), t_builder.nbEdges());
+
+    // Every Game goes through the root, and one of them was won by the first Player:
+    const PositionGraph::Node& t_root{t_graph.node(t_graph.root())};
+
+    ASSERT_EQ(t_root.m_nbVisits, 3u);
+    ASSERT_EQ(t_root.m_nbDraws, 0u);
+    ASSERT_EQ(t_graph.nbWins(t_graph.root(), 0), 1u);
+    ASSERT_EQ(t_graph.nbWins(t_graph.root(), 1), 0u);
+
+    // Moves from the root are sorted by Column:
+    ASSERT_EQ(t_graph.endEdges(t_root) - t_graph.beginEdges(t_root), 3);
+    ASSERT_EQ(t_graph.beginEdges(t_root)[0].m_column, 0u);
+    ASSERT_EQ(t_graph.beginEdges(t_root)[1].m_column, 2u);
+    ASSERT_EQ(t_graph.beginEdges(t_root)[2].m_column, 3u);
+
+    // Following a Game from the root leads to the position of its canonical Game hash:
+    Game          t_game{TWO_PLAYERS, std::make_shared<GameBoard>(), Game::connectFour()};
+    std::size_t   t_node{t_graph.root()};
+
+    for(const std::uint8_t move : A_GAME)
+    {
+        const int column{t_game.canonicalColumn(Column{move}).value()};
+        ASSERT_TRUE(t_game.makeMove(Column{move}));
+
+        const PositionGraph::Node& t_parent{t_graph.node(t_node)};
+        const PositionGraph::Edge* t_edge{std::find_if(t_graph.beginEdges(t_parent), t_graph.endEdges(t_parent),
+                                                       [column](const PositionGraph::Edge& p_edge){return p_edge.m_column == column;})};
+
+        ASSERT_NE(t_edge, t_graph.endEdges(t_parent));
+        t_node = t_edge->m_child;
+    }
+
+    ASSERT_EQ(t_graph.find(t_game.canonicalHash()), t_node);
+    ASSERT_EQ(t_graph.node(t_node).m_nbVisits, 2u);
+
+    // No Game started in the second Column, or in its mirror image, the sixth one:
+    Game t_unknown{TWO_PLAYERS, std::make_shared<GameBoard>(), Game::connectFour()};
+    ASSERT_TRUE(t_unknown.makeMove(Column{1}));
+
+    ASSERT_EQ(t_graph.find(t_unknown.canonicalHash()), t_graph.size());
+}
+
+
+TEST_F(PositionGraphTests, Open_TruncatedGraph_ErrorReturned)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+    ASSERT_TRUE(t_builder.add(A_GAME.data(), A_GAME.size()));
+
+    cxutil::ReturnCode t_written{t_builder.write(GRAPH_PATH)};
+    ASSERT_TRUE(t_written.isOk());
+
+    std::ifstream t_in{GRAPH_PATH, std::ios::binary};
+    std::string   t_content{std::istreambuf_iterator<char>{t_in}, std::istreambuf_iterator<char>{}};
+    t_in.close();
+
+    std::ofstream t_out{GRAPH_PATH, std::ios::binary | std::ios::trunc};
+    t_out.write(t_content.data(), static_cast<std::streamsize>(t_content.size() - 1));
+    t_out.close();
+
+    PositionGraph t_graph;
+    cxutil::ReturnCode t_opened{t_graph.open(GRAPH_PATH)};
+
+    ASSERT_FALSE(t_opened.isOk());
+    ASSERT_FALSE(t_graph.isOpen());
+}
+
+
+TEST_F(PositionGraphTests, NbWins_InvalidSeat_ExceptionThrown)
+{
+    PositionGraphBuilder t_builder{TWO_PLAYERS, 6, 7, 4};
+    ASSERT_TRUE(t_builder.add(A_GAME.data(), A_GAME.size()));
+
+    cxutil::ReturnCode t_written{t_builder.write(GRAPH_PATH)};
+    ASSERT_TRUE(t_written.isOk());
+
+    PositionGraph t_graph;
+    cxutil::ReturnCode t_opened{t_graph.open(GRAPH_PATH)};
+    ASSERT_TRUE(t_opened.isOk());
+
+    ASSERT_THROW(t_graph.nbWins(t_graph.root(), 2), PreconditionException);
+}
@@ -0,0 +1,122 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_WinningLines.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for a the WinningLines class.
+ *
+ **************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include <include/FixedGameBoard.h>
+#include <include/WinningLines.h>
+
+
+using namespace cxbase;
+
+
+TEST(WinningLines, NbWindows_ClassicShape_Returns69)
+{
+    const WinningLines t_lines{6, 7, 4};
+
+    ASSERT_EQ(t_lines.nbWindows(), 69);
+    ASSERT_EQ(t_lines.nbWindows(), (FixedGameBoard<6, 7, 4>::nbWinningLines()));
+}
+
+
+TEST(WinningLines, Windows_ClassicShape_ReturnsWindowsContainingPosition)
+{
+    const WinningLines t_lines{6, 7, 4};
+
+    ASSERT_EQ(t_lines.windows(Position{Row{0}, Column{0}}).size(), 3);
+    ASSERT_EQ(t_lines.windows(Position{Row{2}, Column{3}}).size(), 13);
+
+    for(int row{0}; row < t_lines.nbRows(); ++row)
+    {
+        for(int column{0}; column < t_lines.nbColumns(); ++column)
+        {
+            const Position position{Row{row}, Column{column}};
+
+            for(const int window : t_lines.windows(position))
+            {
+                bool isPositionInWindow{false};
+
+                for(int offset{0}; offset < t_lines.inARow(); ++offset)
+                {
+                    isPositionInWindow |= (t_lines.position(window, offset) == position);
+                }
+
+                ASSERT_TRUE(isPositionInWindow);
+            }
+        }
+    }
+}
+
+
+TEST(WinningLines, Position_DiagonalDownwardWindow_GoesDownRight)
+{
+    const WinningLines t_lines{6, 7, 4};
+
+    for(int window{0}; window < t_lines.nbWindows(); ++window)
+    {
+        if(t_lines.direction(window) == WinningLines::Direction::DiagonalDownward)
+        {
+            const Position first{t_lines.position(window, 0)};
+            const Position last{t_lines.position(window, 3)};
+
+            ASSERT_EQ(last.rowValue(), first.rowValue() - 3);
+            ASSERT_EQ(last.columnValue(), first.columnValue() + 3);
+        }
+    }
+}
+
+
+TEST(WinningLines, ForShape_SameShape_ReturnsSharedTable)
+{
+    const auto t_lines {WinningLines::forShape(9, 8, 7)};
+    const auto t_lines2{WinningLines::forShape(9, 8, 7)};
+    const auto t_lines3{WinningLines::forShape(9, 8, 6)};
+
+    ASSERT_EQ(t_lines, t_lines2);
+    ASSERT_NE(t_lines, t_lines3);
+    ASSERT_EQ(t_lines3->inARow(), 6);
+}
+
+
+TEST(WinningLines, Constructor_InARowTooLarge_ExceptionThrown)
+{
+    ASSERT_THROW((WinningLines{6, 7, 7}), PreconditionException);
+    ASSERT_THROW((WinningLines{6, 7, 1}), PreconditionException);
+}
+
+
+TEST(WinningLines, Windows_PositionOutsideGrid_ExceptionThrown)
+{
+    const WinningLines t_lines{6, 7, 4};
+
+    ASSERT_THROW(t_lines.windows(Position{Row{6}, Column{0}}), PreconditionException);
+}
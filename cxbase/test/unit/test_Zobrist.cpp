@@ -0,0 +1,83 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    test_Zobrist.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Unit tests for a the Zobrist class.
+ *
+ **************************************************************************************************/
+
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <include/Zobrist.h>
+
+
+using namespace cxbase;
+
+
+TEST(Zobrist, DiscKey_NoDisc_ReturnsZero)
+{
+    ASSERT_EQ(Zobrist::discKey(Disc::noDisc()), 0u);
+    ASSERT_NE(Zobrist::discKey(Disc::redDisc()), 0u);
+    ASSERT_NE(Zobrist::discKey(Disc::redDisc()), Zobrist::discKey(Disc::blackDisc()));
+}
+
+
+TEST(Zobrist, PositionKey_AllPositions_ReturnsDistinctKeys)
+{
+    std::set<std::uint64_t> keys;
+
+    for(int row{0}; row < 64; ++row)
+    {
+        for(int column{0}; column < 64; ++column)
+        {
+            keys.insert(Zobrist::positionKey(Position{Row{row}, Column{column}}, Disc::redDisc()));
+            keys.insert(Zobrist::positionKey(Position{Row{row}, Column{column}}, Disc::yellowDisc()));
+        }
+    }
+
+    ASSERT_EQ(keys.size(), 2u * 64u * 64u);
+}
+
+
+TEST(Zobrist, PositionKey_SubscriptsOutOfRange_ExceptionThrown)
+{
+    const std::uint64_t redKey{Zobrist::discKey(Disc::redDisc())};
+
+    ASSERT_THROW(Zobrist::positionKey(-1, 0, redKey), PreconditionException);
+    ASSERT_THROW(Zobrist::positionKey(0, 64, redKey), PreconditionException);
+}
+
+
+TEST(Zobrist, TurnKey_FirstTurn_ReturnsZero)
+{
+    ASSERT_EQ(Zobrist::turnKey(0), 0u);
+    ASSERT_NE(Zobrist::turnKey(1), 0u);
+    ASSERT_NE(Zobrist::turnKey(1), Zobrist::turnKey(2));
+    ASSERT_THROW(Zobrist::turnKey(-1), PreconditionException);
+}
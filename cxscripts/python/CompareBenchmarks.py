@@ -0,0 +1,216 @@
+#!/usr/bin/python
+#coding=utf-8
+
+#***************************************************************************************************
+ #
+ # Copyright (C) 2016 Connect X team
+ #
+ # This file is part of Connect X.
+ #
+ # Connect X is free software: you can redistribute it and/or modify
+ # it under the terms of the GNU General Public License as published by
+ # the Free Software Foundation, either version 3 of the License, or
+ # (at your option) any later version.
+ #
+ # Connect X is distributed in the hope that it will be useful,
+ # but WITHOUT ANY WARRANTY; without even the implied warranty of
+ # MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ # GNU General Public License for more details.
+ #
+ # You should have received a copy of the GNU General Public License
+ # along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ #
+#**************************************************************************************************#
+
+#***************************************************************************************************
+ # @file        CompareBenchmarks.py
+ # @author      agent
+ # @date        October 2026
+ # @version     1
+ #
+ # Script to compare two Google Benchmark runs (JSON output) and catch regressions.
+ #
+#**************************************************************************************************#
+
+import os
+import sys
+import getopt
+import json
+
+# Error codes:
+NB_ARGUMENTS_ERROR         = 1
+COMMAND_SYNTAX_ERROR       = 2
+BENCHMARKS_HAVE_REGRESSED  = 3
+OTHER_ERROR                = 4
+
+# Other:
+DEFAULT_THRESHOLD          = 10.0   # In percents.
+
+def printHelp():
+    """
+    Prints an help page.
+    """
+    script = os.path.basename(__file__)
+
+    print("\nUsage:")
+    print("\t" + script + " OPTION\n")
+    print("Options:")
+    print("\t-h, --help\tPrint help.")
+    print("\t-b, --baseline\tBaseline results (JSON, full path).")
+    print("\t-c, --current\tCurrent results (JSON, full path).")
+    print("\t-t, --threshold\tSlowdown, in percents, above which a benchmark has")
+    print("\t\t\tregressed (default: " + str(DEFAULT_THRESHOLD) + ").\n")
+    print("Examples:")
+    print("\t" + script + " -b /home/user/baseline.json -c /home/user/current.json")
+    print("\t" + script + " -b /home/user/baseline.json -c /home/user/current.json -t 5")
+    print("\t" + script + " --baseline=/home/user/baseline.json --current=/home/user/current.json")
+    print("\t" + script + " -h")
+    print("\t" + script + " --help\n")
+
+
+def readTimes(resultsFile):
+    """
+    Reads the CPU time of every benchmark in a Google Benchmark JSON output. When
+    repetitions were asked for, only the mean is kept.
+
+    Args:
+        resultsFile    The JSON file.
+
+    Returns:
+        A dictionary from the benchmark names to their CPU times (in nanoseconds).
+    """
+
+    with open(resultsFile, 'r') as results:
+        benchmarks = json.load(results)["benchmarks"]
+
+    scales = {"ns": 1.0, "us": 1.0e3, "ms": 1.0e6, "s": 1.0e9}
+    times  = {}
+
+    for benchmark in benchmarks:
+
+        if benchmark.get("run_type") == "aggregate" and benchmark.get("aggregate_name") != "mean":
+            continue
+
+        name = benchmark.get("run_name", benchmark["name"])
+        times[name] = benchmark["cpu_time"] * scales[benchmark.get("time_unit", "ns")]
+
+    return times
+
+
+def compare(baselineFile, currentFile, threshold):
+    """
+    Compares two benchmark runs and prints, for every benchmark, both CPU times
+    and the change between them. Benchmarks found in only one of the runs are
+    listed, but not compared.
+
+    Args:
+        baselineFile    The baseline JSON file.
+        currentFile     The current JSON file.
+        threshold       The slowdown, in percents, above which a benchmark has regressed.
+
+    Returns:
+        The names of the benchmarks which have regressed.
+    """
+
+    baseline = readTimes(baselineFile)
+    current  = readTimes(currentFile)
+
+    nameWidth = max([len(name) for name in list(baseline.keys()) + list(current.keys())] + [9])
+
+    print("Benchmark".ljust(nameWidth) + "  " + "Baseline (ns)".rjust(14) + "  " + "Current (ns)".rjust(14) + "  " + "Change".rjust(8))
+
+    regressions = []
+
+    for name in sorted(baseline.keys()):
+
+        if name not in current:
+            print(name.ljust(nameWidth) + "  " + ("%14.1f" % baseline[name]) + "  " + "missing".rjust(14))
+            continue
+
+        change = 100.0 * (current[name] - baseline[name]) / baseline[name] if baseline[name] > 0.0 else 0.0
+        flag   = ""
+
+        if change > threshold:
+            regressions.append(name)
+            flag = "  REGRESSION"
+
+        print(name.ljust(nameWidth) + "  " + ("%14.1f" % baseline[name]) + "  " + ("%14.1f" % current[name]) + "  " + ("%+7.1f%%" % change) + flag)
+
+    for name in sorted(current.keys()):
+
+        if name not in baseline:
+            print(name.ljust(nameWidth) + "  " + "new".rjust(14) + "  " + ("%14.1f" % current[name]))
+
+    return regressions
+
+
+def main(argv):
+    """
+    Compares two benchmark runs passed as arguments. Exits with a non zero exit
+    code if any benchmark has regressed. The user can also call for help with the
+    following options: "-h" or "--help".
+
+    Args:
+        argv    A list containing all the arguments.
+    """
+
+    if len(argv) == 0:
+        print("Error: number of arguments.")
+        sys.exit(NB_ARGUMENTS_ERROR)
+
+    if (len(argv) == 1) and (argv[0] in ("-h", "--help")):
+        printHelp()
+        sys.exit()
+
+    try:
+        options, arguments = getopt.gnu_getopt(argv, "b:c:t:", ["baseline=", "current=", "threshold="])
+
+    except getopt.GetoptError:
+        print("Error: Arguments!")
+        sys.exit(COMMAND_SYNTAX_ERROR)
+
+    baseline  = ""
+    current   = ""
+    threshold = DEFAULT_THRESHOLD
+
+    for option, argument in options:
+
+        if option == "-b" or option == "--baseline":
+            baseline = argument
+
+        elif option == "-c" or option == "--current":
+            current = argument
+
+        elif option == "-t" or option == "--threshold":
+            try:
+                threshold = float(argument)
+
+            except ValueError:
+                print("Error: threshold.")
+                sys.exit(COMMAND_SYNTAX_ERROR)
+
+        else:
+            print("Error: other")
+            sys.exit(OTHER_ERROR)
+
+    if baseline == "" or current == "" or arguments:
+        print("Error: Arguments!")
+        sys.exit(COMMAND_SYNTAX_ERROR)
+
+    try:
+        regressions = compare(baseline, current, threshold)
+
+    except (IOError, ValueError, KeyError) as error:
+        print("Error: " + str(error))
+        sys.exit(OTHER_ERROR)
+
+    if regressions:
+        print("\n" + str(len(regressions)) + " benchmark(s) have regressed by more than " + str(threshold) + "%.")
+        sys.exit(BENCHMARKS_HAVE_REGRESSED)
+
+    sys.exit()
+
+
+
+if __name__ == "__main__":
+    main(sys.argv[1:])
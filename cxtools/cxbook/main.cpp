@@ -0,0 +1,148 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    main.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for the cxbook opening book builder.
+ *
+ * Solves every position of a board shape up to a number of moves and writes them as an
+ * opening book, which cxsolve (option @c -b) and cxai::Solver::setOpeningBook() can use.
+ * Usage:
+ *
+ *     cxbook [-r <rows>] [-c <columns>] [-n <in a row>] [-d <moves>] [-t <threads>] <book>
+ *
+ * The default board is the classic 6 by 7, connect four board and the default depth is four
+ * (4) moves. The number of positions, the build time and the book size are printed on the
+ * standard error.
+ *
+ * A one (1) move book of the classic board ships as cxtools/cxbook/books/connect4_6x7.book
+ * (the @c cxbookclassic make target rebuilds it). Its five (5) positions take about twenty
+ * (20) minutes to solve on one core. With it, <tt>cxsolve -b</tt> answers the empty board
+ * in milliseconds instead of minutes.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <cxai/include/OpeningBookBuilder.h>
+
+
+namespace
+{
+
+struct Options
+{
+    int m_nbRows    {6};
+    int m_nbColumns {7};
+    int m_inARow    {4};
+    int m_maxNbMoves{4};
+    int m_nbThreads {1};
+
+    std::string m_path;
+};
+
+
+bool parseOptions(int argc, char** argv, Options& p_options)
+{
+    for(int index{1}; index < argc; ++index)
+    {
+        const std::string option{argv[index]};
+
+        if(index + 1 < argc && (option == "-r" || option == "-c" || option == "-n" || option == "-d" || option == "-t"))
+        {
+            const int value{std::atoi(argv[++index])};
+
+            (option == "-r" ? p_options.m_nbRows     :
+             option == "-c" ? p_options.m_nbColumns  :
+             option == "-n" ? p_options.m_inARow     :
+             option == "-d" ? p_options.m_maxNbMoves : p_options.m_nbThreads) = value;
+        }
+        else if(index + 1 == argc && option[0] != '-')
+        {
+            p_options.m_path = option;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return !p_options.m_path.empty()                                                 &&
+           p_options.m_nbRows > 0                                                    &&
+           p_options.m_nbColumns > 0                                                 &&
+           (p_options.m_nbRows + 1) * p_options.m_nbColumns <= 64                    &&
+           p_options.m_inARow >= 2                                                   &&
+           p_options.m_inARow <= std::max(p_options.m_nbRows, p_options.m_nbColumns) &&
+           p_options.m_maxNbMoves >= 0                                               &&
+           p_options.m_maxNbMoves < p_options.m_nbRows * p_options.m_nbColumns       &&
+           p_options.m_nbThreads > 0;
+}
+
+} // unamed namespace
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if(!parseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: cxbook [-r <rows>] [-c <columns>] [-n <in a row>] [-d <moves>] [-t <threads>] <book>" << std::endl;
+        std::cerr << "       (rows + 1) * columns must be at most 64." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    cxai::OpeningBookBuilder builder{options.m_nbRows, options.m_nbColumns, options.m_inARow, options.m_maxNbMoves};
+
+    std::cerr << builder.entries().size() << " positions to solve..." << std::endl;
+
+    builder.build(options.m_nbThreads);
+
+    cxutil::ReturnCode status{builder.write(options.m_path)};
+
+    if(!status.isOk())
+    {
+        std::cerr << status.message() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    const auto   end = std::chrono::steady_clock::now();
+    const double seconds{std::chrono::duration<double>(end - start).count()};
+
+    std::cerr << builder.entries().size() << " positions solved in " << seconds << " s, "
+              << sizeof(cxai::OpeningBook::Header) + builder.entries().size() * sizeof(cxai::OpeningBook::Entry)
+              << " bytes written to " << options.m_path << std::endl;
+
+    return EXIT_SUCCESS;
+}
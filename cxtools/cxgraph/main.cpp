@@ -0,0 +1,275 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    main.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for the cxgraph position graph indexer.
+ *
+ * Replays every Game of one or more game archives (see cxbase::GameArchive) and merges their
+ * positions in a position graph (see cxbase::PositionGraph), where each distinct position
+ * appears once, with the number of Games which went through it and how they ended. Analyses
+ * can then be run once per distinct position instead of once per Game. Usage:
+ *
+ *     cxgraph -o <graph> <archive> [<archive> ...]
+ *     cxgraph <graph>
+ *
+ * All archives must hold Games of the same shape. Invalid records (a move outside the board,
+ * in a full Column or after a win) are counted and left out. The progress is printed every
+ * second, on the standard error.
+ *
+ * Without @c -o, a position graph is described instead: for each number of moves, the number
+ * of distinct positions and the number of times Games went through them. Their ratio measures
+ * how much work is saved by analyzing distinct positions only.
+ *
+ * Positions are keyed with the Disc colors cxperft and cxstats also use: black, red, yellow,
+ * blue, green, white and then shades of grey, in seat order.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cxbase/include/DefaultPlayers.h>
+#include <cxbase/include/GameArchive.h>
+#include <cxbase/include/PositionGraph.h>
+#include <cxbase/include/PositionGraphBuilder.h>
+
+
+namespace
+{
+
+/***********************************************************************************************//**
+ * Builds a position graph from game archives.
+ *
+ * @param[in] p_graph    The graph path.
+ * @param[in] p_archives The archive paths.
+ *
+ * @return @c true if the graph has been written.
+ *
+ **************************************************************************************************/
+bool build(const std::string& p_graph, const std::vector<std::string>& p_archives)
+{
+    std::unique_ptr<cxbase::PositionGraphBuilder> builder;
+
+    int nbRows   {0};
+    int nbColumns{0};
+    int inARow   {0};
+    int nbPlayers{0};
+
+    std::uint64_t nbInvalid{0};
+
+    const auto start = std::chrono::steady_clock::now();
+    auto       lastReport = start;
+
+    for(const std::string& path : p_archives)
+    {
+        cxbase::GameArchive archive;
+        cxutil::ReturnCode  opened{archive.open(path)};
+
+        if(!opened.isOk())
+        {
+            std::cerr << opened.message() << std::endl;
+
+            return false;
+        }
+
+        if(!builder)
+        {
+            nbRows    = archive.nbRows();
+            nbColumns = archive.nbColumns();
+            inARow    = archive.inARow();
+            nbPlayers = archive.nbPlayers();
+
+            // The shape of an archive is not checked when it is written:
+            if(!cxbase::isValidGameShape(nbRows, nbColumns, inARow, nbPlayers))
+            {
+                std::cerr << path << ": the Game shape is not valid for cxbase." << std::endl;
+
+                return false;
+            }
+
+            builder.reset(new cxbase::PositionGraphBuilder{cxbase::defaultPlayers(nbPlayers), nbRows, nbColumns, inARow});
+        }
+        else if(archive.nbRows() != nbRows || archive.nbColumns() != nbColumns || archive.inARow() != inARow || archive.nbPlayers() != nbPlayers)
+        {
+            std::cerr << path << ": the Game shape differs from the one of the first archive." << std::endl;
+
+            return false;
+        }
+
+        std::cerr << path << ": " << archive.size() << " games" << std::endl;
+
+        const std::uint8_t*         cursor{archive.begin()};
+        cxbase::GameArchive::Record record;
+
+        while(archive.next(cursor, record))
+        {
+            nbInvalid += builder->add(record.begin(), static_cast<std::size_t>(record.nbMoves())) ? 0 : 1;
+
+            // Checking the time for every Game would cost more than the Game itself:
+            if((builder->nbGames() + nbInvalid) % 4096 == 0 && std::chrono::steady_clock::now() - lastReport >= std::chrono::seconds{1})
+            {
+                lastReport = std::chrono::steady_clock::now();
+
+                const double seconds{std::chrono::duration<double>(lastReport - start).count()};
+
+                std::cerr << "  " << builder->nbGames() << " games, " << builder->size() << " distinct positions, "
+                          << std::fixed << std::setprecision(0) << static_cast<double>(builder->nbGames()) / seconds << " games/s" << std::endl;
+            }
+        }
+    }
+
+    std::cerr << "Writing " << p_graph << "..." << std::endl;
+
+    cxutil::ReturnCode written{builder->write(p_graph)};
+
+    if(!written.isOk())
+    {
+        std::cerr << written.message() << std::endl;
+
+        return false;
+    }
+
+    std::cout << builder->nbGames() << " games (" << nbInvalid << " invalid records left out), "
+              << builder->nbPositions() << " positions, " << builder->size() << " distinct positions, "
+              << builder->nbEdges() << " distinct moves" << std::endl;
+
+    return true;
+}
+
+
+/***********************************************************************************************//**
+ * Describes a position graph, by number of moves.
+ *
+ * @param[in] p_graph The graph path.
+ *
+ * @return @c true if the graph could be opened.
+ *
+ **************************************************************************************************/
+bool describe(const std::string& p_graph)
+{
+    cxbase::PositionGraph graph;
+    cxutil::ReturnCode    opened{graph.open(p_graph)};
+
+    if(!opened.isOk())
+    {
+        std::cerr << opened.message() << std::endl;
+
+        return false;
+    }
+
+    std::cout << graph.nbRows() << "x" << graph.nbColumns() << ", connect " << graph.inARow() << ", "
+              << graph.nbPlayers() << " players: " << graph.size() << " distinct positions, "
+              << graph.nbEdges() << " distinct moves" << std::endl;
+
+    if(graph.size() == 0)
+    {
+        return true;
+    }
+
+    // Each move adds a Disc, so the positions after n moves are exactly the children of the
+    // positions after n - 1 moves:
+    std::vector<bool>        isReached(graph.size(), false);
+    std::vector<std::size_t> layer{graph.root()};
+    std::vector<std::size_t> nextLayer;
+
+    std::cout << "moves distinct visits visits/distinct" << std::endl;
+
+    for(int nbMoves{0}; !layer.empty(); ++nbMoves)
+    {
+        std::uint64_t nbVisits{0};
+        nextLayer.clear();
+
+        for(const std::size_t node : layer)
+        {
+            nbVisits += graph.node(node).m_nbVisits;
+
+            for(const cxbase::PositionGraph::Edge* edge{graph.beginEdges(graph.node(node))}; edge != graph.endEdges(graph.node(node)); ++edge)
+            {
+                if(!isReached[edge->m_child])
+                {
+                    isReached[edge->m_child] = true;
+                    nextLayer.push_back(edge->m_child);
+                }
+            }
+        }
+
+        std::cout << nbMoves << " " << layer.size() << " " << nbVisits << " " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(nbVisits) / static_cast<double>(layer.size()) << std::endl;
+
+        layer.swap(nextLayer);
+    }
+
+    return true;
+}
+
+} // unamed namespace
+
+
+int main(int argc, char** argv)
+{
+    std::string              graph;
+    std::vector<std::string> paths;
+
+    for(int index{1}; index < argc; ++index)
+    {
+        const std::string option{argv[index]};
+
+        if(index + 1 < argc && option == "-o" && graph.empty())
+        {
+            graph = argv[++index];
+        }
+        else if(option[0] != '-')
+        {
+            paths.push_back(option);
+        }
+        else
+        {
+            paths.clear();
+            break;
+        }
+    }
+
+    if(paths.empty() || (graph.empty() && paths.size() != 1))
+    {
+        std::cerr << "Usage: cxgraph -o <graph> <archive> [<archive> ...]" << std::endl;
+        std::cerr << "       cxgraph <graph>" << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    const bool isDone{graph.empty() ? describe(paths.front()) : build(graph, paths)};
+
+    return isDone ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,588 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    main.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for the cxperft move generation counter.
+ *
+ * Plays every sequence of moves up to a depth with cxbase::Game, and counts:
+ *
+ *  @li The leaves: the positions reached after exactly @a depth moves.
+ *  @li The wins and the draws: the Games ended by a win or by a full board, at any depth up
+ *      to @a depth. Ended Games are not explored further.
+ *
+ * Counts are paths, not distinct positions: a position reached by two move orders counts
+ * twice. Since they only depend on the Game rules, they check that an optimized Game still
+ * follows the reference rules, and the rate at which they are computed measures raw rules
+ * throughput. Usage:
+ *
+ *     cxperft [-r <rows>] [-c <columns>] [-n <in a row>] [-p <players>] [-m <moves>] [-t <threads>] [-f] <depth>
+ *     cxperft -k [-t <threads>] [-f]
+ *
+ * The default Game is the classic 6 by 7, connect four Game for two (2) players. With @c -m,
+ * counting starts after the given moves, written as Columns from '1' for the leftmost one and
+ * separated by commas (for example, <tt>-m 4,4,3</tt>). The counts of every depth, from one (1)
+ * to @a depth, are printed with the time they took. With @c -t, the moves at the root are
+ * shared between threads, each counting on its own Game.
+ *
+ * With @c -k, the known-good counts of several board shapes are checked instead. The exit
+ * status is then non zero if any count differs.
+ *
+ * With @c -f, the moves are played directly on a cxbase::FixedGameBoard instead of a Game, the
+ * Players taking turns with their Discs. The counts must be the same, so that @c -k @c -f checks
+ * the FixedGameBoard rules and compares their throughput with the Game's. Since the board shape
+ * of a FixedGameBoard is fixed at compile time, only the shapes of the known counts can be used.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxbase/include/DefaultPlayers.h>
+#include <cxbase/include/FixedGameBoard.h>
+#include <cxbase/include/Game.h>
+
+
+namespace
+{
+
+struct Counts
+{
+    std::uint64_t m_nbLeaves;
+    std::uint64_t m_nbWins;
+    std::uint64_t m_nbDraws;
+
+    Counts& operator+=(const Counts& p_counts)
+    {
+        m_nbLeaves += p_counts.m_nbLeaves;
+        m_nbWins   += p_counts.m_nbWins;
+        m_nbDraws  += p_counts.m_nbDraws;
+
+        return *this;
+    }
+
+    bool operator==(const Counts& p_counts) const
+    {
+        return m_nbLeaves == p_counts.m_nbLeaves && m_nbWins == p_counts.m_nbWins && m_nbDraws == p_counts.m_nbDraws;
+    }
+};
+
+
+struct Setup
+{
+    int              m_nbRows;
+    int              m_nbColumns;
+    int              m_inARow;
+    int              m_nbPlayers;
+    std::vector<int> m_moves;
+};
+
+
+struct KnownCounts
+{
+    Setup  m_setup;
+    int    m_depth;
+    Counts m_counts;
+};
+
+
+// Checked against an independent implementation of the rules. After the 32 moves of the
+// second last entry, only ten (10) Positions are free, so that Games end in draws:
+const KnownCounts KNOWN_COUNTS[]
+{
+    {{ 6,  7, 4, 2, {}},  8, {5673234,  57462,    0}},
+    {{ 6,  7, 3, 2, {}},  7, { 732956,  90748,    0}},
+    {{ 6,  7, 3, 3, {}},  7, { 823536,  36532,    0}},
+    {{ 6,  7, 2, 6, {}},  7, { 823536, 225504,    0}},
+    {{ 7,  8, 4, 2, {}},  7, {2097152,  27944,    0}},
+    {{ 6,  7, 4, 2, {5, 6, 3, 5, 6, 4, 1, 4, 0, 5, 4, 1, 3, 2, 1, 2,
+                     1, 0, 4, 6, 1, 0, 4, 5, 6, 2, 5, 3, 6, 6, 0, 0}}, 10, {   1372,   3552, 1132}},
+    {{64, 64, 9, 2, {}},  3, { 262144,      0,    0}},
+};
+
+
+/***********************************************************************************************//**
+ * Creates a Game and plays its first moves.
+ *
+ * @param[in] p_setup The Game definition and its first moves.
+ *
+ * @return The Game, or @c nullptr if a move can not be played or ends the Game.
+ *
+ **************************************************************************************************/
+std::unique_ptr<cxbase::Game> createGame(const Setup& p_setup)
+{
+    std::unique_ptr<cxbase::Game> game{new cxbase::Game{cxbase::defaultPlayers(p_setup.m_nbPlayers),
+                                                        std::make_shared<cxbase::GameBoard>(p_setup.m_nbRows, p_setup.m_nbColumns),
+                                                        p_setup.m_inARow}};
+
+    for(const int column : p_setup.m_moves)
+    {
+        if(column < 0 || column >= p_setup.m_nbColumns || !game->makeMove(cxbase::Column{column}) || game->isWon() || game->isDraw())
+        {
+            return nullptr;
+        }
+    }
+
+    return game;
+}
+
+
+/***********************************************************************************************//**
+ * Plays the moves counted by perft() on a cxbase::Game.
+ *
+ **************************************************************************************************/
+class GameWalker
+{
+
+public:
+
+    static std::unique_ptr<GameWalker> create(const Setup& p_setup)
+    {
+        std::unique_ptr<cxbase::Game> game{createGame(p_setup)};
+
+        return game ? std::unique_ptr<GameWalker>{new GameWalker{std::move(game)}} : nullptr;
+    }
+
+    int  nbColumns() const         {return m_game->gameboard().nbColumns();}
+    bool play(int p_column)        {return m_game->makeMove(cxbase::Column{p_column});}
+    void undo()                    {m_game->undoMove();}
+    bool isWon() const             {return m_game->isWon();}
+    bool isDraw() const            {return m_game->isDraw();}
+
+private:
+
+    explicit GameWalker(std::unique_ptr<cxbase::Game> p_game): m_game{std::move(p_game)} {}
+
+    std::unique_ptr<cxbase::Game> m_game;
+
+};
+
+
+/***********************************************************************************************//**
+ * Plays the moves counted by perft() directly on a cxbase::FixedGameBoard. The Players take turns
+ * with the Discs of cxbase::defaultPlayers(): a move wins if the placed Disc is part of a
+ * winning line, and draws if it fills the grid.
+ *
+ **************************************************************************************************/
+template<int NbRows, int NbColumns, int InARow>
+class FixedBoardWalker
+{
+
+public:
+
+    static std::unique_ptr<FixedBoardWalker> create(const Setup& p_setup)
+    {
+        std::unique_ptr<FixedBoardWalker> walker{new FixedBoardWalker{p_setup.m_nbPlayers}};
+
+        for(const int column : p_setup.m_moves)
+        {
+            if(column < 0 || column >= NbColumns || !walker->play(column) || walker->isWon() || walker->isDraw())
+            {
+                return nullptr;
+            }
+        }
+
+        return walker;
+    }
+
+    int  nbColumns() const {return NbColumns;}
+
+    bool play(int p_column)
+    {
+        const cxbase::Column column{p_column};
+
+        if(m_board.isColumnFull(column))
+        {
+            return false;
+        }
+
+        m_lastPositions.push_back(m_board.placeDisc(column, m_discIds[m_lastPositions.size() % m_discIds.size()]));
+
+        return true;
+    }
+
+    void undo()
+    {
+        m_board.removeDisc(m_lastPositions.back().column());
+        m_lastPositions.pop_back();
+    }
+
+    bool isWon() const  {return !m_lastPositions.empty() && m_board.isWinningPosition(m_lastPositions.back());}
+    bool isDraw() const {return !isWon() && m_lastPositions.size() == static_cast<std::size_t>(NbRows * NbColumns);}
+
+private:
+
+    explicit FixedBoardWalker(int p_nbPlayers)
+    {
+        for(const std::shared_ptr<cxbase::Player>& player : cxbase::defaultPlayers(p_nbPlayers))
+        {
+            m_discIds.push_back(m_board.registerDisc(player->disc()));
+        }
+
+        m_lastPositions.reserve(static_cast<std::size_t>(NbRows * NbColumns));
+    }
+
+    cxbase::FixedGameBoard<NbRows, NbColumns, InARow> m_board;
+    std::vector<cxbase::DiscId>                       m_discIds;
+    std::vector<cxbase::Position>                     m_lastPositions;
+
+};
+
+
+/***********************************************************************************************//**
+ * Counts from a position. The position is explored in place and restored before returning.
+ *
+ * @param[in,out] p_walker The position.
+ * @param[in]     p_depth  The number of moves to play.
+ *
+ * @return The counts.
+ *
+ **************************************************************************************************/
+template<typename Walker>
+Counts perft(Walker& p_walker, int p_depth)
+{
+    Counts counts{0, 0, 0};
+
+    const int nbColumns{p_walker.nbColumns()};
+
+    for(int column{0}; column < nbColumns; ++column)
+    {
+        if(!p_walker.play(column))
+        {
+            // Full Column:
+            continue;
+        }
+
+        if(p_walker.isWon())
+        {
+            ++counts.m_nbWins;
+            counts.m_nbLeaves += p_depth == 1 ? 1 : 0;
+        }
+        else if(p_walker.isDraw())
+        {
+            ++counts.m_nbDraws;
+            counts.m_nbLeaves += p_depth == 1 ? 1 : 0;
+        }
+        else if(p_depth == 1)
+        {
+            ++counts.m_nbLeaves;
+        }
+        else
+        {
+            counts += perft(p_walker, p_depth - 1);
+        }
+
+        p_walker.undo();
+    }
+
+    return counts;
+}
+
+
+/***********************************************************************************************//**
+ * Counts from a position, sharing the moves at the root between threads. Each thread plays on
+ * its own copy of the position.
+ *
+ * @param[in] p_setup     The position.
+ * @param[in] p_depth     The number of moves to play.
+ * @param[in] p_nbThreads The number of threads.
+ *
+ * @return The counts.
+ *
+ **************************************************************************************************/
+template<typename Walker>
+Counts parallelPerft(const Setup& p_setup, int p_depth, int p_nbThreads)
+{
+    std::vector<Counts> counts(static_cast<std::size_t>(p_setup.m_nbColumns), Counts{0, 0, 0});
+    std::atomic<int>    nextColumn{0};
+
+    const auto count = [&]()
+    {
+        for(int column{nextColumn++}; column < p_setup.m_nbColumns; column = nextColumn++)
+        {
+            std::unique_ptr<Walker> walker{Walker::create(p_setup)};
+
+            if(!walker->play(column))
+            {
+                // Full Column:
+                continue;
+            }
+
+            Counts& columnCounts{counts[static_cast<std::size_t>(column)]};
+
+            if(walker->isWon() || walker->isDraw())
+            {
+                columnCounts.m_nbWins   = walker->isWon() ? 1 : 0;
+                columnCounts.m_nbDraws  = walker->isWon() ? 0 : 1;
+                columnCounts.m_nbLeaves = p_depth == 1 ? 1 : 0;
+            }
+            else if(p_depth == 1)
+            {
+                columnCounts.m_nbLeaves = 1;
+            }
+            else
+            {
+                columnCounts = perft(*walker, p_depth - 1);
+            }
+        }
+    };
+
+    std::vector<std::thread> helpers;
+
+    for(int thread{1}; thread < p_nbThreads; ++thread)
+    {
+        helpers.emplace_back(count);
+    }
+
+    count();
+
+    for(std::thread& helper : helpers)
+    {
+        helper.join();
+    }
+
+    Counts total{0, 0, 0};
+
+    for(const Counts& columnCounts : counts)
+    {
+        total += columnCounts;
+    }
+
+    return total;
+}
+
+
+// The board shapes counted with -f. FixedGameBoard's shape is fixed at compile time, so only
+// these are available:
+bool isFixedShape(const Setup& p_setup)
+{
+    const int shape[]{p_setup.m_nbRows, p_setup.m_nbColumns, p_setup.m_inARow};
+
+    const int FIXED_SHAPES[][3]{{6, 7, 4}, {6, 7, 3}, {6, 7, 2}, {7, 8, 4}, {64, 64, 9}};
+
+    return std::any_of(std::begin(FIXED_SHAPES), std::end(FIXED_SHAPES), [&shape](const int (&p_fixed)[3])
+    {
+        return std::equal(std::begin(p_fixed), std::end(p_fixed), std::begin(shape));
+    });
+}
+
+
+/***********************************************************************************************//**
+ * Counts from a position, on a cxbase::Game or on a cxbase::FixedGameBoard.
+ *
+ * @param[in] p_setup     The position.
+ * @param[in] p_depth     The number of moves to play.
+ * @param[in] p_nbThreads The number of threads.
+ * @param[in] p_isFixed   @c true to count on a FixedGameBoard.
+ *
+ * @pre With a FixedGameBoard, the shape is one of the fixed shapes (see isFixedShape()).
+ *
+ * @return The counts.
+ *
+ **************************************************************************************************/
+Counts countMoves(const Setup& p_setup, int p_depth, int p_nbThreads, bool p_isFixed)
+{
+    if(!p_isFixed)
+    {
+        return parallelPerft<GameWalker>(p_setup, p_depth, p_nbThreads);
+    }
+
+    switch(p_setup.m_nbRows * 10000 + p_setup.m_nbColumns * 100 + p_setup.m_inARow)
+    {
+        case  60704: return parallelPerft<FixedBoardWalker< 6,  7, 4>>(p_setup, p_depth, p_nbThreads);
+        case  60703: return parallelPerft<FixedBoardWalker< 6,  7, 3>>(p_setup, p_depth, p_nbThreads);
+        case  60702: return parallelPerft<FixedBoardWalker< 6,  7, 2>>(p_setup, p_depth, p_nbThreads);
+        case  70804: return parallelPerft<FixedBoardWalker< 7,  8, 4>>(p_setup, p_depth, p_nbThreads);
+        default:     return parallelPerft<FixedBoardWalker<64, 64, 9>>(p_setup, p_depth, p_nbThreads);
+    }
+}
+
+
+bool parseMoves(const std::string& p_moves, std::vector<int>& p_columns)
+{
+    std::istringstream moves{p_moves};
+    std::string        move;
+
+    while(std::getline(moves, move, ','))
+    {
+        const int column{std::atoi(move.c_str())};
+
+        if(column < 1)
+        {
+            return false;
+        }
+
+        p_columns.push_back(column - 1);
+    }
+
+    return true;
+}
+
+
+struct Options
+{
+    Setup m_setup    {6, 7, 4, 2, {}};
+    int   m_depth    {0};
+    int   m_nbThreads{1};
+    bool  m_isCheck  {false};
+    bool  m_isFixed  {false};
+};
+
+
+bool parseOptions(int argc, char** argv, Options& p_options)
+{
+    for(int index{1}; index < argc; ++index)
+    {
+        const std::string option{argv[index]};
+
+        if(option == "-k")
+        {
+            p_options.m_isCheck = true;
+        }
+        else if(option == "-f")
+        {
+            p_options.m_isFixed = true;
+        }
+        else if(index + 1 < argc && option == "-m")
+        {
+            if(!parseMoves(argv[++index], p_options.m_setup.m_moves))
+            {
+                return false;
+            }
+        }
+        else if(index + 1 < argc && (option == "-r" || option == "-c" || option == "-n" || option == "-p" || option == "-t"))
+        {
+            const int value{std::atoi(argv[++index])};
+
+            (option == "-r" ? p_options.m_setup.m_nbRows    :
+             option == "-c" ? p_options.m_setup.m_nbColumns :
+             option == "-n" ? p_options.m_setup.m_inARow    :
+             option == "-p" ? p_options.m_setup.m_nbPlayers : p_options.m_nbThreads) = value;
+        }
+        else if(index + 1 == argc && option[0] != '-')
+        {
+            p_options.m_depth = std::atoi(option.c_str());
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return (p_options.m_isCheck || p_options.m_depth > 0) && p_options.m_nbThreads > 0 &&
+           (!p_options.m_isFixed || p_options.m_isCheck || isFixedShape(p_options.m_setup)) &&
+           cxbase::isValidGameShape(p_options.m_setup.m_nbRows, p_options.m_setup.m_nbColumns, p_options.m_setup.m_inARow, p_options.m_setup.m_nbPlayers);
+}
+
+
+std::string toString(const Setup& p_setup)
+{
+    std::ostringstream text;
+
+    text << p_setup.m_nbRows << "x" << p_setup.m_nbColumns << ", connect " << p_setup.m_inARow
+         << ", " << p_setup.m_nbPlayers << " players";
+
+    return text.str();
+}
+
+} // unamed namespace
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if(!parseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: cxperft [-r <rows>] [-c <columns>] [-n <in a row>] [-p <players>] [-m <moves>] [-t <threads>] [-f] <depth>" << std::endl;
+        std::cerr << "       cxperft -k [-t <threads>] [-f]" << std::endl;
+        std::cerr << "       The Game must be valid for cxbase: at least 6 rows and 7 columns, in a row" << std::endl;
+        std::cerr << "       smaller than both, and a number of players dividing the number of positions." << std::endl;
+        std::cerr << "       With -f, the shape must be 6x7 (in a row 2, 3 or 4), 7x8 (4) or 64x64 (9)." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    if(options.m_isCheck)
+    {
+        bool isEveryCountGood{true};
+
+        for(const KnownCounts& known : KNOWN_COUNTS)
+        {
+            const auto   start = std::chrono::steady_clock::now();
+            const Counts counts{countMoves(known.m_setup, known.m_depth, options.m_nbThreads, options.m_isFixed)};
+            const auto   end = std::chrono::steady_clock::now();
+
+            const bool isGood{counts == known.m_counts};
+
+            std::cout << (isGood ? "OK   " : "FAIL ") << toString(known.m_setup) << ", depth " << known.m_depth << ": "
+                      << counts.m_nbLeaves << " leaves, " << counts.m_nbWins << " wins, " << counts.m_nbDraws << " draws ("
+                      << std::chrono::duration<double>(end - start).count() << " s)" << std::endl;
+
+            if(!isGood)
+            {
+                std::cout << "     expected " << known.m_counts.m_nbLeaves << " leaves, " << known.m_counts.m_nbWins
+                          << " wins, " << known.m_counts.m_nbDraws << " draws" << std::endl;
+            }
+
+            isEveryCountGood = isEveryCountGood && isGood;
+        }
+
+        return isEveryCountGood ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if(!createGame(options.m_setup))
+    {
+        std::cerr << "Invalid moves: a Column is full, does not exist or ends the Game." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "depth leaves wins draws seconds leaves/s" << std::endl;
+
+    for(int depth{1}; depth <= options.m_depth; ++depth)
+    {
+        const auto   start = std::chrono::steady_clock::now();
+        const Counts counts{countMoves(options.m_setup, depth, options.m_nbThreads, options.m_isFixed)};
+        const auto   end = std::chrono::steady_clock::now();
+
+        const double seconds{std::chrono::duration<double>(end - start).count()};
+
+        std::cout << depth << " " << counts.m_nbLeaves << " " << counts.m_nbWins << " " << counts.m_nbDraws << " "
+                  << seconds << " " << (seconds > 0.0 ? static_cast<double>(counts.m_nbLeaves) / seconds : 0.0) << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
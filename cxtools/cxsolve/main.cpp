@@ -0,0 +1,223 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    main.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for the cxsolve benchmark tool.
+ *
+ * Reads positions from the standard input, one per line, solves them and prints the results.
+ * A position is a sequence of Columns, from '1' for the leftmost Column, played from the empty
+ * board. Anything following the sequence on a line (for example an expected score) is echoed
+ * as is. An empty line is the empty board. For each position, this is printed:
+ *
+ *     <sequence> <score> <best column> <explored nodes> <time in microseconds> [<rest of line>]
+ *
+ * The best Column is printed in the same notation as the sequence. Once the input is
+ * exhausted, totals are printed on the standard error. Usage:
+ *
+ *     cxsolve [-r <rows>] [-c <columns>] [-n <in a row>] [-t <threads>] [-b <book>] [-s]
+ *
+ * The default board is the classic 6 by 7, connect four board. With @c -s, only the score is
+ * computed, which is faster since no best Column is searched for. The best Column is then
+ * printed as zero (0). With @c -t, each position is searched by several threads: results are
+ * the same, only times change. Position files in the <tt>sequence score</tt> format, like the
+ * standard Connect Four benchmark sets, can be fed as is to compare times across thread counts.
+ * Three such sets ship in cxtools/cxsolve/positions. Their positions come from random play
+ * on the classic board, without a win and without a winning move for the Player to move, and
+ * their scores from cxsolve itself:
+ *
+ *  @li end_easy.txt: 100 positions with 28 to 36 moves played.
+ *  @li middle.txt: 50 positions with 12 to 16 moves played.
+ *  @li begin.txt: 10 positions with 8 to 12 moves played.
+ *
+ * The @c cxsolvebench make target solves each set with one (1), two (2), four (4) and eight
+ * (8) threads.
+ * With @c -b, the Solver consults an opening book made by cxbook, such as the classic board's
+ * cxtools/cxbook/books/connect4_6x7.book.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+#include <cxai/include/OpeningBook.h>
+#include <cxai/include/Solver.h>
+
+
+namespace
+{
+
+struct Options
+{
+    int  m_nbRows     {6};
+    int  m_nbColumns  {7};
+    int  m_inARow     {4};
+    int  m_nbThreads  {1};
+    bool m_isScoreOnly{false};
+
+    std::string m_bookPath;
+};
+
+
+bool parseOptions(int argc, char** argv, Options& p_options)
+{
+    for(int index{1}; index < argc; ++index)
+    {
+        const std::string option{argv[index]};
+
+        if(option == "-s")
+        {
+            p_options.m_isScoreOnly = true;
+        }
+        else if(index + 1 < argc && option == "-b")
+        {
+            p_options.m_bookPath = argv[++index];
+        }
+        else if(index + 1 < argc && (option == "-r" || option == "-c" || option == "-n" || option == "-t"))
+        {
+            const int value{std::atoi(argv[++index])};
+
+            (option == "-r" ? p_options.m_nbRows    :
+             option == "-c" ? p_options.m_nbColumns :
+             option == "-n" ? p_options.m_inARow    : p_options.m_nbThreads) = value;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return p_options.m_nbRows > 0                                                    &&
+           p_options.m_nbColumns > 0                                                 &&
+           (p_options.m_nbRows + 1) * p_options.m_nbColumns <= 64                    &&
+           p_options.m_inARow >= 2                                                   &&
+           p_options.m_inARow <= std::max(p_options.m_nbRows, p_options.m_nbColumns) &&
+           p_options.m_nbThreads > 0;
+}
+
+} // unamed namespace
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if(!parseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: cxsolve [-r <rows>] [-c <columns>] [-n <in a row>] [-t <threads>] [-b <book>] [-s]" << std::endl;
+        std::cerr << "       (rows + 1) * columns must be at most 64." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    cxai::Solver      solver{cxai::Solver::defaultNbTableEntries(), options.m_nbThreads};
+    cxai::OpeningBook book;
+
+    if(!options.m_bookPath.empty())
+    {
+        cxutil::ReturnCode status{book.open(options.m_bookPath)};
+
+        if(!status.isOk())
+        {
+            std::cerr << status.message() << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        solver.setOpeningBook(&book);
+    }
+
+    int                nbPositions{0};
+    std::uint64_t      totalNbNodes{0};
+    long long          totalMicroseconds{0};
+    std::string        line;
+
+    while(std::getline(std::cin, line))
+    {
+        std::istringstream fields{line};
+        std::string        sequence;
+        std::string        rest;
+
+        fields >> sequence;
+        std::getline(fields, rest);
+
+        cxai::BitBoard board{options.m_nbRows, options.m_nbColumns, options.m_inARow};
+
+        if(board.play(sequence) != static_cast<int>(sequence.size()))
+        {
+            std::cerr << "Invalid position: " << sequence << std::endl;
+            continue;
+        }
+
+        if(board.nbMoves() == board.nbPositions())
+        {
+            std::cerr << "Full board: " << sequence << std::endl;
+            continue;
+        }
+
+        solver.reset();
+
+        const auto start = std::chrono::steady_clock::now();
+
+        cxai::Solver::Result result{-1, 0};
+
+        if(options.m_isScoreOnly)
+        {
+            result.m_score = solver.solve(board);
+        }
+        else
+        {
+            result = solver.analyze(board);
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        const long long microseconds{std::chrono::duration_cast<std::chrono::microseconds>(end - start).count()};
+
+        std::cout << sequence << " " << result.m_score << " " << result.m_column + 1 << " "
+                  << solver.nbExploredNodes() << " " << microseconds << rest << std::endl;
+
+        ++nbPositions;
+        totalNbNodes      += solver.nbExploredNodes();
+        totalMicroseconds += microseconds;
+    }
+
+    if(nbPositions > 0)
+    {
+        const double seconds{static_cast<double>(totalMicroseconds) / 1e6};
+
+        std::cerr << nbPositions << " positions solved in " << seconds << " s: "
+                  << seconds / nbPositions << " s and " << static_cast<double>(totalNbNodes) / nbPositions
+                  << " nodes per position, "
+                  << (seconds > 0.0 ? static_cast<double>(totalNbNodes) / seconds : 0.0) << " nodes/s" << std::endl;
+    }
+
+    return EXIT_SUCCESS;
+}
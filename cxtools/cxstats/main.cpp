@@ -0,0 +1,582 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+
+/***********************************************************************************************//**
+ * @file    main.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for the cxstats game archive analyzer.
+ *
+ * Replays every Game of one or more game archives (see cxbase::GameArchive) with cxbase::Game
+ * and prints, for each Game shape:
+ *
+ *  @li The number of Games and their average length, in moves.
+ *  @li The number of wins, of draws (full board) and of unfinished Games, and the number of
+ *      Games in which an early draw (see cxbase::Game::isEarlyDraw()) was reached before the
+ *      Game ended. These are never won, so they are counted among the draws and unfinished
+ *      Games.
+ *  @li For each first Column, the number of Games and the share of them won by the first
+ *      Player, or drawn.
+ *  @li For each seat, the share of Games won by the Player in that seat. With N Players and
+ *      no seat advantage, it is the share of won Games divided by N.
+ *
+ * Invalid records (a move outside the board, in a full Column or after a win) are counted and
+ * left out. Usage:
+ *
+ *     cxstats [-t <threads>] [-k <chunk size, in KiB>] <archive> [<archive> ...]
+ *     cxstats -g <games> [-r <rows>] [-c <columns>] [-n <in a row>] [-p <players>] [-s <seed>] <archive>
+ *
+ * Each archive is split in chunks of records, which threads take in turn. Each thread replays
+ * its chunks on its own Game, in its own statistics, and all of them are added up at the end.
+ * The throughput is printed every second, on the standard error.
+ *
+ * With @c -g, an archive of random Games is written instead: every move is drawn uniformly
+ * among the Columns which are not full, until the Game is won or the board is full. The
+ * default Game is the classic 6 by 7, connect four Game for two (2) players.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <cxutil/include/ContractException.h>
+
+#include <cxbase/include/DefaultPlayers.h>
+#include <cxbase/include/Game.h>
+#include <cxbase/include/GameArchive.h>
+#include <cxbase/include/GameArchiveWriter.h>
+
+
+namespace
+{
+
+typedef std::tuple<int, int, int, int> Shape; // Rows, Columns, inARow value and Players.
+
+
+struct Statistics
+{
+    std::uint64_t              m_nbGames;
+    std::uint64_t              m_nbMoves;
+    std::uint64_t              m_nbWins;
+    std::uint64_t              m_nbDraws;
+    std::uint64_t              m_nbEarlyDraws;
+    std::uint64_t              m_nbInvalid;
+    std::vector<std::uint64_t> m_nbGamesByFirstColumn;
+    std::vector<std::uint64_t> m_nbFirstPlayerWinsByFirstColumn;
+    std::vector<std::uint64_t> m_nbDrawsByFirstColumn;
+    std::vector<std::uint64_t> m_nbWinsBySeat;
+
+    Statistics& operator+=(const Statistics& p_statistics)
+    {
+        m_nbGames      += p_statistics.m_nbGames;
+        m_nbMoves      += p_statistics.m_nbMoves;
+        m_nbWins       += p_statistics.m_nbWins;
+        m_nbDraws      += p_statistics.m_nbDraws;
+        m_nbEarlyDraws += p_statistics.m_nbEarlyDraws;
+        m_nbInvalid    += p_statistics.m_nbInvalid;
+
+        add(m_nbGamesByFirstColumn,           p_statistics.m_nbGamesByFirstColumn);
+        add(m_nbFirstPlayerWinsByFirstColumn, p_statistics.m_nbFirstPlayerWinsByFirstColumn);
+        add(m_nbDrawsByFirstColumn,           p_statistics.m_nbDrawsByFirstColumn);
+        add(m_nbWinsBySeat,                   p_statistics.m_nbWinsBySeat);
+
+        return *this;
+    }
+
+    static void add(std::vector<std::uint64_t>& p_counts, const std::vector<std::uint64_t>& p_otherCounts)
+    {
+        p_counts.resize(std::max(p_counts.size(), p_otherCounts.size()), 0);
+
+        for(std::size_t index{0}; index < p_otherCounts.size(); ++index)
+        {
+            p_counts[index] += p_otherCounts[index];
+        }
+    }
+};
+
+
+Statistics emptyStatistics(int p_nbColumns, int p_nbPlayers)
+{
+    const std::size_t nbColumns{static_cast<std::size_t>(p_nbColumns)};
+
+    return Statistics{0, 0, 0, 0, 0, 0,
+                      std::vector<std::uint64_t>(nbColumns, 0),
+                      std::vector<std::uint64_t>(nbColumns, 0),
+                      std::vector<std::uint64_t>(nbColumns, 0),
+                      std::vector<std::uint64_t>(static_cast<std::size_t>(p_nbPlayers), 0)};
+}
+
+
+std::unique_ptr<cxbase::Game> createGame(int p_nbRows, int p_nbColumns, int p_inARow, int p_nbPlayers)
+{
+    return std::unique_ptr<cxbase::Game>{new cxbase::Game{cxbase::defaultPlayers(p_nbPlayers),
+                                                          std::make_shared<cxbase::GameBoard>(p_nbRows, p_nbColumns),
+                                                          p_inARow}};
+}
+
+
+/***********************************************************************************************//**
+ * Replays a record and adds it to some statistics. The Game is restored before returning.
+ *
+ * Since an early draw stays one until the Game ends, a Game which ends in a draw has been an
+ * early draw if it was one before its last move, and a Game which ends in a win never is: its
+ * last move is taken back first to find out.
+ *
+ * @param[in]     p_archive    The archive holding the record.
+ * @param[in]     p_record     The record.
+ * @param[in,out] p_game       A Game of the archive shape, without any move.
+ * @param[in,out] p_statistics The statistics.
+ *
+ **************************************************************************************************/
+void analyze(const cxbase::GameArchive& p_archive, const cxbase::GameArchive::Record& p_record, cxbase::Game& p_game, Statistics& p_statistics)
+{
+    const int  nbMoves      {p_archive.replay(p_record, p_game)};
+    const bool isValidRecord{nbMoves == p_record.nbMoves()};
+    const bool isWon        {p_game.isWon()};
+    const bool isDraw       {!isWon && p_game.isDraw()};
+
+    int nbMovesToUndo{nbMoves};
+
+    if(isDraw)
+    {
+        p_game.undoMove();
+        --nbMovesToUndo;
+    }
+
+    const bool isEarlyDraw{!isWon && p_game.isEarlyDraw()};
+
+    if(isValidRecord)
+    {
+        ++p_statistics.m_nbGames;
+        p_statistics.m_nbMoves      += static_cast<std::uint64_t>(nbMoves);
+        p_statistics.m_nbEarlyDraws += isEarlyDraw ? 1 : 0;
+
+        // Once no Player can win, no Player does:
+        ASSERTION(!(isWon && isEarlyDraw));
+
+        if(isWon)
+        {
+            // The last Player to move won:
+            ++p_statistics.m_nbWins;
+            ++p_statistics.m_nbWinsBySeat[static_cast<std::size_t>((nbMoves - 1) % p_game.nbPlayers())];
+        }
+        else if(isDraw)
+        {
+            ++p_statistics.m_nbDraws;
+        }
+
+        if(nbMoves > 0)
+        {
+            const std::size_t firstColumn{*p_record.begin()};
+
+            ++p_statistics.m_nbGamesByFirstColumn[firstColumn];
+            p_statistics.m_nbFirstPlayerWinsByFirstColumn[firstColumn] += isWon && (nbMoves - 1) % p_game.nbPlayers() == 0 ? 1 : 0;
+            p_statistics.m_nbDrawsByFirstColumn[firstColumn]           += isDraw ? 1 : 0;
+        }
+    }
+    else
+    {
+        ++p_statistics.m_nbInvalid;
+    }
+
+    for(int move{0}; move < nbMovesToUndo; ++move)
+    {
+        p_game.undoMove();
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Replays every record of an archive, sharing chunks of records between threads.
+ *
+ * @param[in] p_archive   The archive.
+ * @param[in] p_nbThreads The number of threads.
+ * @param[in] p_chunkSize The size of a chunk, in bytes.
+ *
+ * @return The statistics of the archive.
+ *
+ **************************************************************************************************/
+Statistics analyze(const cxbase::GameArchive& p_archive, int p_nbThreads, std::size_t p_chunkSize)
+{
+    const std::size_t archiveSize{static_cast<std::size_t>(p_archive.end() - p_archive.begin())};
+    const std::size_t nbChunks   {(archiveSize + p_chunkSize - 1) / p_chunkSize};
+
+    std::vector<Statistics>    statistics(static_cast<std::size_t>(p_nbThreads), emptyStatistics(p_archive.nbColumns(), p_archive.nbPlayers()));
+    std::atomic<std::size_t>   nextChunk{0};
+    std::atomic<std::uint64_t> nbRecordsDone{0};
+    std::atomic<int>           nbThreadsDone{0};
+
+    const auto work = [&](std::size_t p_thread)
+    {
+        std::unique_ptr<cxbase::Game> game{createGame(p_archive.nbRows(), p_archive.nbColumns(), p_archive.inARow(), p_archive.nbPlayers())};
+        Statistics&                   threadStatistics{statistics[p_thread]};
+
+        for(std::size_t chunk{nextChunk++}; chunk < nbChunks; chunk = nextChunk++)
+        {
+            // Every record starting in the chunk belongs to it:
+            const std::uint8_t* cursor{p_archive.align(p_archive.begin() + chunk * p_chunkSize)};
+            const std::uint8_t* last  {p_archive.align(p_archive.begin() + std::min((chunk + 1) * p_chunkSize, archiveSize))};
+
+            std::uint64_t                nbRecords{0};
+            cxbase::GameArchive::Record  record;
+
+            while(cursor != last && p_archive.next(cursor, record))
+            {
+                analyze(p_archive, record, *game, threadStatistics);
+                ++nbRecords;
+            }
+
+            nbRecordsDone += nbRecords;
+        }
+
+        ++nbThreadsDone;
+    };
+
+    std::vector<std::thread> workers;
+
+    for(std::size_t thread{0}; thread < statistics.size(); ++thread)
+    {
+        workers.emplace_back(work, thread);
+    }
+
+    // Progress, while the workers are busy:
+    const auto start = std::chrono::steady_clock::now();
+    auto       lastReport = start;
+
+    while(nbThreadsDone < p_nbThreads)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{50});
+
+        const auto now = std::chrono::steady_clock::now();
+
+        if(now - lastReport >= std::chrono::seconds{1})
+        {
+            const double minutes{std::chrono::duration<double>(now - start).count() / 60.0};
+            const double nbRecords{static_cast<double>(nbRecordsDone.load())};
+
+            std::cerr << std::fixed << std::setprecision(1)
+                      << "  " << nbRecordsDone.load() << " games (" << 100.0 * nbRecords / std::max(1.0, static_cast<double>(p_archive.size())) << " %), "
+                      << nbRecords / minutes / 1.0e6 << " million games/min" << std::endl;
+
+            lastReport = now;
+        }
+    }
+
+    for(std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    Statistics total{emptyStatistics(p_archive.nbColumns(), p_archive.nbPlayers())};
+
+    for(const Statistics& threadStatistics : statistics)
+    {
+        total += threadStatistics;
+    }
+
+    return total;
+}
+
+
+double percent(std::uint64_t p_count, std::uint64_t p_total)
+{
+    return p_total > 0 ? 100.0 * static_cast<double>(p_count) / static_cast<double>(p_total) : 0.0;
+}
+
+
+void print(const Shape& p_shape, const Statistics& p_statistics)
+{
+    const int nbPlayers{std::get<3>(p_shape)};
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << std::get<0>(p_shape) << "x" << std::get<1>(p_shape) << ", connect " << std::get<2>(p_shape) << ", "
+              << nbPlayers << " players" << std::endl;
+
+    std::cout << "  games:           " << p_statistics.m_nbGames;
+
+    if(p_statistics.m_nbInvalid > 0)
+    {
+        std::cout << " (" << p_statistics.m_nbInvalid << " invalid records left out)";
+    }
+
+    std::cout << std::endl;
+    std::cout << "  average length:  " << (p_statistics.m_nbGames > 0 ? static_cast<double>(p_statistics.m_nbMoves) / static_cast<double>(p_statistics.m_nbGames) : 0.0) << " moves" << std::endl;
+    std::cout << "  wins:            " << percent(p_statistics.m_nbWins, p_statistics.m_nbGames) << " %" << std::endl;
+    std::cout << "  draws:           " << percent(p_statistics.m_nbDraws, p_statistics.m_nbGames) << " %" << std::endl;
+    std::cout << "  unfinished:      " << percent(p_statistics.m_nbGames - p_statistics.m_nbWins - p_statistics.m_nbDraws, p_statistics.m_nbGames) << " %" << std::endl;
+    std::cout << "  early draws:     " << percent(p_statistics.m_nbEarlyDraws, p_statistics.m_nbGames) << " %" << std::endl;
+
+    std::cout << "  first column     games   first player wins   draws" << std::endl;
+
+    for(std::size_t column{0}; column < p_statistics.m_nbGamesByFirstColumn.size(); ++column)
+    {
+        const std::uint64_t nbGames{p_statistics.m_nbGamesByFirstColumn[column]};
+
+        if(nbGames > 0)
+        {
+            std::cout << "  " << std::setw(12) << column + 1
+                      << std::setw(10) << nbGames
+                      << std::setw(18) << percent(p_statistics.m_nbFirstPlayerWinsByFirstColumn[column], nbGames) << " %"
+                      << std::setw(6)  << percent(p_statistics.m_nbDrawsByFirstColumn[column], nbGames) << " %" << std::endl;
+        }
+    }
+
+    // Compared to an even share of the wins:
+    const double evenShare{percent(p_statistics.m_nbWins, p_statistics.m_nbGames) / nbPlayers};
+
+    std::cout << "  seat             wins    advantage" << std::endl;
+
+    for(std::size_t seat{0}; seat < p_statistics.m_nbWinsBySeat.size(); ++seat)
+    {
+        const double share{percent(p_statistics.m_nbWinsBySeat[seat], p_statistics.m_nbGames)};
+
+        std::cout << "  " << std::setw(4) << seat + 1
+                  << std::setw(18) << share << " %"
+                  << std::setw(9) << std::showpos << share - evenShare << std::noshowpos << " %" << std::endl;
+    }
+}
+
+
+/***********************************************************************************************//**
+ * Writes an archive of random Games.
+ *
+ * @param[in] p_path    The archive path.
+ * @param[in] p_shape   The Game shape.
+ * @param[in] p_nbGames The number of Games.
+ * @param[in] p_seed    The random generator seed.
+ *
+ * @return @c true if the archive has been written.
+ *
+ **************************************************************************************************/
+bool generate(const std::string& p_path, const Shape& p_shape, std::uint64_t p_nbGames, std::uint32_t p_seed)
+{
+    const int nbRows   {std::get<0>(p_shape)};
+    const int nbColumns{std::get<1>(p_shape)};
+    const int nbPlayers{std::get<3>(p_shape)};
+
+    cxbase::GameArchiveWriter writer;
+    cxutil::ReturnCode        created{writer.open(p_path, nbRows, nbColumns, std::get<2>(p_shape), nbPlayers)};
+
+    if(!created.isOk())
+    {
+        std::cerr << created.message() << std::endl;
+
+        return false;
+    }
+
+    std::unique_ptr<cxbase::Game> game{createGame(nbRows, nbColumns, std::get<2>(p_shape), nbPlayers)};
+    std::mt19937                  generator{p_seed};
+    std::vector<int>              columns;
+
+    for(std::uint64_t index{0}; index < p_nbGames; ++index)
+    {
+        while(!game->isWon() && !game->isDraw())
+        {
+            columns.clear();
+
+            for(int column{0}; column < nbColumns; ++column)
+            {
+                if(!game->gameboard().isColumnFull(cxbase::Column{column}))
+                {
+                    columns.push_back(column);
+                }
+            }
+
+            std::uniform_int_distribution<std::size_t> pick{0, columns.size() - 1};
+            game->makeMove(cxbase::Column{columns[pick(generator)]});
+        }
+
+        writer.write(*game);
+
+        while(game->nbOfCompletedMoves() > 0)
+        {
+            game->undoMove();
+        }
+    }
+
+    cxutil::ReturnCode written{writer.close()};
+
+    if(!written.isOk())
+    {
+        std::cerr << written.message() << std::endl;
+
+        return false;
+    }
+
+    return true;
+}
+
+
+struct Options
+{
+    std::vector<std::string> m_archives;
+    int                      m_nbThreads {1};
+    std::size_t              m_chunkSize {1 << 20};
+    std::uint64_t            m_nbGames   {0};
+    std::uint32_t            m_seed      {0};
+    Shape                    m_shape     {6, 7, 4, 2};
+};
+
+
+bool parseOptions(int argc, char** argv, Options& p_options)
+{
+    for(int index{1}; index < argc; ++index)
+    {
+        const std::string option{argv[index]};
+
+        if(index + 1 < argc && option == "-t")
+        {
+            p_options.m_nbThreads = std::atoi(argv[++index]);
+        }
+        else if(index + 1 < argc && option == "-k")
+        {
+            p_options.m_chunkSize = static_cast<std::size_t>(std::max(0, std::atoi(argv[++index]))) * 1024;
+        }
+        else if(index + 1 < argc && option == "-g")
+        {
+            p_options.m_nbGames = std::strtoull(argv[++index], nullptr, 10);
+        }
+        else if(index + 1 < argc && option == "-s")
+        {
+            p_options.m_seed = static_cast<std::uint32_t>(std::strtoul(argv[++index], nullptr, 10));
+        }
+        else if(index + 1 < argc && (option == "-r" || option == "-c" || option == "-n" || option == "-p"))
+        {
+            const int value{std::atoi(argv[++index])};
+
+            (option == "-r" ? std::get<0>(p_options.m_shape) :
+             option == "-c" ? std::get<1>(p_options.m_shape) :
+             option == "-n" ? std::get<2>(p_options.m_shape) : std::get<3>(p_options.m_shape)) = value;
+        }
+        else if(option[0] != '-')
+        {
+            p_options.m_archives.push_back(option);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if(p_options.m_nbGames > 0)
+    {
+        return p_options.m_archives.size() == 1 &&
+               cxbase::isValidGameShape(std::get<0>(p_options.m_shape), std::get<1>(p_options.m_shape), std::get<2>(p_options.m_shape), std::get<3>(p_options.m_shape));
+    }
+
+    return !p_options.m_archives.empty() && p_options.m_nbThreads > 0 && p_options.m_chunkSize > 0;
+}
+
+} // unamed namespace
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if(!parseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: cxstats [-t <threads>] [-k <chunk size, in KiB>] <archive> [<archive> ...]" << std::endl;
+        std::cerr << "       cxstats -g <games> [-r <rows>] [-c <columns>] [-n <in a row>] [-p <players>] [-s <seed>] <archive>" << std::endl;
+        std::cerr << "       Generated Games must be valid for cxbase: at least 6 rows and 7 columns, in a row" << std::endl;
+        std::cerr << "       smaller than both, and a number of players dividing the number of positions." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    if(options.m_nbGames > 0)
+    {
+        return generate(options.m_archives.front(), options.m_shape, options.m_nbGames, options.m_seed) ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // Archives of the same shape are added up:
+    std::map<Shape, Statistics> statistics;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for(const std::string& path : options.m_archives)
+    {
+        cxbase::GameArchive archive;
+        cxutil::ReturnCode  opened{archive.open(path)};
+
+        if(!opened.isOk())
+        {
+            std::cerr << opened.message() << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        const Shape shape{archive.nbRows(), archive.nbColumns(), archive.inARow(), archive.nbPlayers()};
+
+        // The shape of an archive is not checked when it is written:
+        if(!cxbase::isValidGameShape(archive.nbRows(), archive.nbColumns(), archive.inARow(), archive.nbPlayers()))
+        {
+            std::cerr << path << ": the Game shape is not valid for cxbase." << std::endl;
+
+            return EXIT_FAILURE;
+        }
+
+        std::cerr << path << ": " << archive.size() << " games" << std::endl;
+
+        const Statistics archiveStatistics{analyze(archive, options.m_nbThreads, options.m_chunkSize)};
+        const auto       shapeStatistics = statistics.find(shape);
+
+        if(shapeStatistics == statistics.end())
+        {
+            statistics.emplace(shape, archiveStatistics);
+        }
+        else
+        {
+            shapeStatistics->second += archiveStatistics;
+        }
+    }
+
+    const double seconds{std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count()};
+
+    std::uint64_t nbGames{0};
+
+    for(const auto& shapeStatistics : statistics)
+    {
+        print(shapeStatistics.first, shapeStatistics.second);
+        nbGames += shapeStatistics.second.m_nbGames + shapeStatistics.second.m_nbInvalid;
+    }
+
+    std::cout << std::setprecision(2) << nbGames << " games in " << seconds << " s ("
+              << (seconds > 0.0 ? static_cast<double>(nbGames) / seconds * 60.0 / 1.0e6 : 0.0) << " million games/min)" << std::endl;
+
+    return EXIT_SUCCESS;
+}
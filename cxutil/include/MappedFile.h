@@ -0,0 +1,119 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    MappedFile.h
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Interface for a read-only memory-mapped file.
+ *
+ **************************************************************************************************/
+
+#ifndef MAPPEDFILE_H_E6A93C50_28D1_4B7F_8F04_1C5D72B9A3E6
+#define MAPPEDFILE_H_E6A93C50_28D1_4B7F_8F04_1C5D72B9A3E6
+
+#include <cstddef>
+#include <string>
+
+#include "ReturnCode.h"
+#include "UnCopyable.h"
+
+
+namespace cxutil
+{
+
+/***********************************************************************************************//**
+ * @class MappedFile
+ *
+ * @brief A file mapped read-only in memory.
+ *
+ * The file content is accessed directly through a pointer, without being read in a buffer:
+ * pages are loaded by the operating system as they are first touched and shared between the
+ * processes mapping the same file. This suits large, read-only data files such as opening books
+ * or tablebases. The mapping is released when the object is closed or destroyed.
+ *
+ **************************************************************************************************/
+class MappedFile final : private UnCopyable
+{
+
+public:
+
+///@{ @name Object construction and destruction
+
+    /*******************************************************************************************//**
+     * Default constructor. No file is mapped.
+     *
+     **********************************************************************************************/
+    MappedFile() = default;
+
+
+    /*******************************************************************************************//**
+     * Destructor. Releases the mapping, if any.
+     *
+     **********************************************************************************************/
+    ~MappedFile();
+
+///@}
+
+///@{ @name Operations
+
+    /*******************************************************************************************//**
+     * Maps a file. Any file previously mapped is released first.
+     *
+     * @param[in] p_path The file path.
+     *
+     * @return A ReturnCode holding an error, with a message, if the file does not exist, is
+     *         empty or can not be mapped.
+     *
+     **********************************************************************************************/
+    ReturnCode open(const std::string& p_path);
+
+
+    /*******************************************************************************************//**
+     * Releases the mapping. Pointers to the file content become invalid.
+     *
+     **********************************************************************************************/
+    void close();
+
+///@}
+
+///@{ @name Data access
+
+    bool                 isOpen() const {return m_data != nullptr;}   ///< Checks if a file is mapped.
+    const unsigned char* data()   const {return m_data;}              ///< The file content, or @c nullptr.
+    std::size_t          size()   const {return m_size;}              ///< The file size, in bytes.
+
+///@}
+
+
+private:
+
+    const unsigned char* m_data{nullptr};  ///< The file content.
+    std::size_t          m_size{0};        ///< The file size, in bytes.
+
+};
+
+} // namespace cxutil
+
+#endif // MAPPEDFILE_H_E6A93C50_28D1_4B7F_8F04_1C5D72B9A3E6
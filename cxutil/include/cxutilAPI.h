@@ -38,6 +38,7 @@
 #include "Date.h"
 #include "LineSegment.h"
 #include "Logger.h"
+#include "MappedFile.h"
 #include "Name.h"
 #include "Point.h"
 #include "ReturnCode.h"
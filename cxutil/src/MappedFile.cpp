@@ -0,0 +1,96 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * @file    MappedFile.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ * Implementation for a read-only memory-mapped file.
+ *
+ **************************************************************************************************/
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "MappedFile.h"
+
+using namespace cxutil;
+
+
+MappedFile::~MappedFile()
+{
+    close();
+}
+
+
+ReturnCode MappedFile::open(const std::string& p_path)
+{
+    close();
+
+    const int descriptor{::open(p_path.c_str(), O_RDONLY)};
+
+    if(descriptor < 0)
+    {
+        return ReturnCode{ReturnCode::Code::ERROR, "Unable to open " + p_path + "."};
+    }
+
+    struct stat status;
+
+    if(::fstat(descriptor, &status) != 0 || status.st_size <= 0)
+    {
+        ::close(descriptor);
+
+        return ReturnCode{ReturnCode::Code::ERROR, p_path + " is empty or unreadable."};
+    }
+
+    const std::size_t size{static_cast<std::size_t>(status.st_size)};
+    void*             data{::mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0)};
+
+    // The mapping stays valid once the descriptor is closed:
+    ::close(descriptor);
+
+    if(data == MAP_FAILED)
+    {
+        return ReturnCode{ReturnCode::Code::ERROR, "Unable to map " + p_path + " in memory."};
+    }
+
+    m_data = static_cast<const unsigned char*>(data);
+    m_size = size;
+
+    return ReturnCode{};
+}
+
+
+void MappedFile::close()
+{
+    if(m_data != nullptr)
+    {
+        ::munmap(const_cast<unsigned char*>(m_data), m_size);
+    }
+
+    m_data = nullptr;
+    m_size = 0;
+}
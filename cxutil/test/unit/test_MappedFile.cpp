@@ -0,0 +1,109 @@
+/***************************************************************************************************
+ *
+ * Copyright (C) 2016 Connect X team
+ *
+ * This file is part of Connect X.
+ *
+ * Connect X is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Connect X is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with Connect X.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **************************************************************************************************/
+
+
+/***********************************************************************************************//**
+ * Unit tests for the MappedFile class.
+ *
+ * @file    test_MappedFile.cpp
+ * @author  agent
+ * @date    October 2026
+ * @version 1.0
+ *
+ **************************************************************************************************/
+
+#include <cstdio>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <cxutil/include/MappedFile.h>
+
+using namespace cxutil;
+
+
+namespace
+{
+
+const std::string TEST_FILE{"cxutil_test_MappedFile.bin"};
+
+} // unamed namespace
+
+
+TEST(MappedFile, Constructor_Default_NotOpen)
+{
+    const MappedFile t_file;
+
+    ASSERT_FALSE(t_file.isOpen());
+    ASSERT_EQ(t_file.data(), nullptr);
+    ASSERT_EQ(t_file.size(), 0u);
+}
+
+
+TEST(MappedFile, Open_ExistingFile_ContentMapped)
+{
+    {
+        std::ofstream t_out{TEST_FILE, std::ios::binary};
+        t_out << "Connect X";
+    }
+
+    MappedFile t_file;
+    ReturnCode t_returnCode{t_file.open(TEST_FILE)};
+
+    ASSERT_TRUE(t_returnCode.isOk());
+    ASSERT_TRUE(t_file.isOpen());
+    ASSERT_EQ(t_file.size(), 9u);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(t_file.data()), t_file.size()), "Connect X");
+
+    t_file.close();
+
+    ASSERT_FALSE(t_file.isOpen());
+
+    std::remove(TEST_FILE.c_str());
+}
+
+
+TEST(MappedFile, Open_MissingFile_ErrorReturned)
+{
+    MappedFile t_file;
+    ReturnCode t_returnCode{t_file.open("cxutil_test_no_such_file.bin")};
+
+    ASSERT_FALSE(t_returnCode.isOk());
+    ASSERT_TRUE(t_returnCode.isError());
+    ASSERT_TRUE(t_returnCode.holdsMessage());
+    ASSERT_FALSE(t_file.isOpen());
+}
+
+
+TEST(MappedFile, Open_EmptyFile_ErrorReturned)
+{
+    {
+        std::ofstream t_out{TEST_FILE, std::ios::binary};
+    }
+
+    MappedFile t_file;
+    ReturnCode t_returnCode{t_file.open(TEST_FILE)};
+
+    ASSERT_FALSE(t_returnCode.isOk());
+    ASSERT_FALSE(t_file.isOpen());
+
+    std::remove(TEST_FILE.c_str());
+}